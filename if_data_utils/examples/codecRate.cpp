@@ -0,0 +1,171 @@
+//============================================================================//
+//---------------------- if_data_utils/codecRate.cpp -----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Compresses a raw IF recording through IFDataFileWriter, reads it back
+// through IFDataFileReader and reports the compression ratio and the rates
+// of both directions
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFDataFileMap.hpp"
+#include "if_data_utils/IFDataFileReader.hpp"
+#include "if_data_utils/IFDataFileWriter.hpp"
+#include "if_data_utils/IFSampleData.hpp"
+
+#include <sys/stat.h>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace if_data_utils;
+
+namespace
+{
+const size_t blockSamples = 1 << 16;
+
+double elapsed(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+    .count();
+}
+
+template <typename samp_type>
+int run(const std::string&   rawFile,
+        const IFCompression& compression,
+        const std::string&   codedFile)
+{
+  auto noLog = [](const std::string& msg, const logutils::LogLevel& level) {
+    if (level == logutils::LogLevel::Error)
+    {
+      std::cout << msg << std::endl;
+    }
+  };
+
+  IFDataFileMap<samp_type> input(noLog);
+  if (!input.openFile(rawFile))
+  {
+    return 1;
+  }
+  const size_t numSamples = input.getNumberOfSamples();
+  const double rawMB = numSamples * sizeof(samp_type) / (1024.0 * 1024.0);
+
+  const samp_type* samples = input.getData();
+
+  IFDataFileWriter<samp_type> writer(1 << 20, noLog);
+  if (!writer.createFile(codedFile, false, false, compression))
+  {
+    return 1;
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (size_t first = 0; first < numSamples; first += blockSamples)
+  {
+    const size_t count = std::min(blockSamples, numSamples - first);
+    writer.writeSamplesToFile(samples + first, count);
+  }
+  if (!writer.closeFile())
+  {
+    return 1;
+  }
+  const double writeSeconds = elapsed(start);
+
+  struct stat codedStat;
+  stat(codedFile.c_str(), &codedStat);
+  std::cout << "Compression ratio: "
+            << numSamples * sizeof(samp_type) / (double)codedStat.st_size
+            << " (" << codedStat.st_size << " bytes)" << std::endl;
+  std::cout << "Write: " << rawMB / writeSeconds << " MB/s" << std::endl;
+
+  const char* names[2] = {"Read raw: ", "Read compressed: "};
+  const std::string files[2] = {rawFile, codedFile};
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    IFDataFileReader<samp_type> reader(4096, noLog);
+    if (!reader.openFile(files[pass]))
+    {
+      return 1;
+    }
+    std::vector<samp_type> block(blockSamples);
+    bool                   match = true;
+    start                        = std::chrono::steady_clock::now();
+    for (size_t first = 0; first < numSamples; first += blockSamples)
+    {
+      const size_t count = std::min(blockSamples, numSamples - first);
+      if (!reader.readSamplesFromFile(block.data(), count))
+      {
+        return 1;
+      }
+      match = match && (std::memcmp(block.data(), samples + first,
+                                    count * sizeof(samp_type)) == 0);
+    }
+    const double readSeconds = elapsed(start);
+    std::cout << names[pass] << rawMB / readSeconds << " MB/s"
+              << (match ? "" : " (MISMATCH)") << std::endl;
+    if (!match)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc < 4)
+  {
+    std::cout << "Usage: " << argv[0]
+              << " <raw file> <sc8|sc16> <coded file> [pack|delta]"
+              << std::endl;
+    return 0;
+  }
+  std::string   format      = argv[2];
+  IFCompression compression = IFCompression::Pack;
+  if ((argc > 4) && (std::string(argv[4]) == "delta"))
+  {
+    compression = IFCompression::Delta;
+  }
+
+  if (format == "sc8")
+  {
+    return run<IFSampleSC8>(argv[1], compression, argv[3]);
+  }
+  if (format == "sc16")
+  {
+    return run<IFSampleSC16>(argv[1], compression, argv[3]);
+  }
+  std::cout << "Unsupported data format: " << format << std::endl;
+  return 1;
+}
@@ -0,0 +1,236 @@
+//============================================================================//
+//------------ if_data_utils/getSamplesBenchmark.cpp -----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Compares IfData::getSamples against the original per-byte decoder on
+// generated sc2, sc8 and sc16 files and reports the throughput of each
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IfData.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace if_data_utils;
+
+namespace
+{
+// The decoder IfData::getSamples used before it was buffered, kept here as
+// the reference for both speed and output
+class LegacyReader
+{
+public:
+  bool open(const Settings& settings)
+  {
+    settings_ = settings;
+    file_.open(settings.dataFilename, std::ios::in | std::ios::binary);
+    return file_.is_open();
+  }
+
+  void getSamples(Eigen::VectorXf& samplesEigen)
+  {
+    size_t numSamples       = samplesEigen.size();
+    size_t samplesFromQueue = 0;
+    size_t bytesFromFile    = 0;
+    size_t samplesRead      = 0;
+
+    if (leftoverSamples_.size() > numSamples)
+    {
+      samplesFromQueue = numSamples;
+    }
+    else
+    {
+      samplesFromQueue = leftoverSamples_.size();
+      bytesFromFile    = ceil((numSamples - leftoverSamples_.size()) *
+                           settings_.bytesPerSample);
+    }
+
+    for (size_t ii = 0; ii < samplesFromQueue; ii++)
+    {
+      samplesEigen[samplesRead++] = leftoverSamples_.front();
+      leftoverSamples_.pop();
+    }
+
+    if (bytesFromFile == 0)
+    {
+      return;
+    }
+
+    char*    readData = new char[bytesFromFile];
+    uint16_t temp     = 0;
+    file_.read(readData, bytesFromFile);
+    for (size_t ii = 0; ii < bytesFromFile; ii++)
+    {
+      int     samplesPerByte = 1 / settings_.bytesPerSample;
+      int8_t* samples        = new int8_t[samplesPerByte];
+      if (samplesPerByte == 4)
+      {
+        convertSampleToSigned(readData[ii], samples);
+        for (size_t jj = 0; jj < 4; jj++)
+        {
+          if (samplesRead < numSamples)
+          {
+            samplesEigen[samplesRead++] = (float)samples[jj];
+          }
+          else
+          {
+            leftoverSamples_.push((float)samples[jj]);
+          }
+        }
+      }
+      else if (settings_.bytesPerSample == 2)
+      {
+        if (ii % 2 == 0)
+        {
+          temp = readData[ii];
+        }
+        else
+        {
+          temp                        = (temp << 8) | readData[ii];
+          samplesEigen[samplesRead++] = (float)temp;
+        }
+      }
+      else if (samplesRead < numSamples)
+      {
+        samplesEigen[samplesRead++] = (float)readData[ii];
+      }
+      delete[] samples;
+    }
+    delete[] readData;
+  }
+
+private:
+  Settings          settings_;
+  std::ifstream     file_;
+  std::queue<float> leftoverSamples_;
+};
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+    .count();
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  size_t fileMB    = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 64;
+  size_t blockSize = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 10001;
+  std::string filename = "getSamplesBenchmark.bin";
+
+  // random bytes are a valid recording in every format
+  {
+    std::mt19937                       rng(1);
+    std::vector<uint32_t>              data(fileMB * 1024 * 1024 / 4);
+    std::uniform_int_distribution<uint32_t> dist;
+    for (auto& word : data)
+    {
+      word = dist(rng);
+    }
+    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    out.write(reinterpret_cast<const char*>(data.data()),
+              data.size() * sizeof(uint32_t));
+  }
+
+  struct Format
+  {
+    const char* name;
+    float       bytesPerSample;
+    bool        compare;  // the original sc16 path did not sign extend
+  };
+  const Format formats[] = {
+    {"sc2", 0.25f, true}, {"sc8", 1.0f, true}, {"sc16", 2.0f, false}};
+
+  std::cout << "File: " << fileMB << " MB, " << blockSize
+            << " samples per call" << std::endl;
+
+  for (const auto& format : formats)
+  {
+    Settings settings;
+    settings.bytesPerSample = format.bytesPerSample;
+    settings.complex        = true;
+    settings.dataFilename   = filename;
+
+    size_t numBlocks = static_cast<size_t>(fileMB * 1024 * 1024 /
+                                           format.bytesPerSample) /
+                       blockSize;
+
+    LegacyReader    legacy;
+    IfData          ifData;
+    Eigen::VectorXf legacySamples(blockSize);
+    Eigen::VectorXf samples(blockSize);
+    legacy.open(settings);
+    ifData.open(settings);
+
+    double legacySeconds = 0.0;
+    double seconds       = 0.0;
+    size_t mismatches    = 0;
+    for (size_t ii = 0; ii < numBlocks; ++ii)
+    {
+      auto start = std::chrono::steady_clock::now();
+      legacy.getSamples(legacySamples);
+      legacySeconds += secondsSince(start);
+
+      start = std::chrono::steady_clock::now();
+      ifData.getSamples(samples);
+      seconds += secondsSince(start);
+
+      if (format.compare && samples != legacySamples)
+      {
+        ++mismatches;
+      }
+    }
+
+    double megabytes =
+      numBlocks * blockSize * format.bytesPerSample / (1024.0 * 1024.0);
+    std::cout << format.name << ": original " << megabytes / legacySeconds
+              << " MB/s, buffered " << megabytes / seconds << " MB/s ("
+              << legacySeconds / seconds << "x)";
+    if (format.compare)
+    {
+      std::cout << ", " << mismatches << " mismatched blocks";
+    }
+    std::cout << std::endl;
+  }
+
+  std::remove(filename.c_str());
+  return 0;
+}
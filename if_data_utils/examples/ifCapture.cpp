@@ -0,0 +1,281 @@
+//============================================================================//
+//---------------------- if_data_utils/ifCapture.cpp -----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Packs raw IF recordings into indexed capture files, describes them, and
+// extracts time windows from them
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFCaptureReader.hpp"
+#include "if_data_utils/IFCaptureWriter.hpp"
+#include "if_data_utils/IFDataFileMap.hpp"
+#include "if_data_utils/IniReader.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace if_data_utils;
+
+namespace
+{
+const size_t blockSize = 1 << 20;
+
+// the log callback used by the tool, which only reports problems
+void logProblems(const std::string& msg, const logutils::LogLevel& level)
+{
+  if (level != logutils::LogLevel::Info)
+  {
+    std::cout << msg << std::endl;
+  }
+}
+
+template <typename samp_type>
+int pack(const std::string&    rawFile,
+         const IFSampleHeader& header,
+         const std::string&    captureFile,
+         const uint64_t&       startTime)
+{
+  IFDataFileMap<samp_type> input(logProblems);
+  if (!input.openFile(rawFile))
+  {
+    return 1;
+  }
+  IFCaptureWriter<samp_type> output(logProblems);
+  if (!output.createFile(captureFile, header, startTime))
+  {
+    return 1;
+  }
+
+  const samp_type* samples;
+  size_t           remaining = input.getNumberOfSamples();
+  while (remaining > 0)
+  {
+    const size_t count = (remaining < blockSize) ? remaining : blockSize;
+    if ((!input.readSamples(samples, count)) ||
+        (!output.writeSamples(samples, count)))
+    {
+      return 1;
+    }
+    remaining -= count;
+  }
+  std::cout << "Packed " << output.getNumberOfSamples() << " samples into "
+            << output.getNumberOfChunks() << " chunks" << std::endl;
+  return output.closeFile() ? 0 : 1;
+}
+
+template <typename samp_type>
+int info(const std::string& captureFile)
+{
+  IFCaptureReader<samp_type> reader(logProblems);
+  if (!reader.openFile(captureFile))
+  {
+    return 1;
+  }
+  const IFSampleHeader header = reader.getHeader();
+  std::cout << "Samples: " << header.numSamples_ << " ("
+            << (double)header.numSamples_ / header.fs_ << " s)" << std::endl;
+  std::cout << "Sampling frequency: " << header.fs_ << " Hz" << std::endl;
+  std::cout << "IF frequency: " << header.if_ << " Hz" << std::endl;
+  std::cout << "Start time: " << reader.getStartTime() << " ns" << std::endl;
+  std::cout << "Chunks: " << reader.getNumberOfChunks() << " of "
+            << reader.getSamplesPerChunk() << " samples" << std::endl;
+
+  // without checksums only the chunk headers are checked
+  if (!(reader.getFileHeader().flags & ifCaptureChecksumFlag))
+  {
+    std::cout << "No checksums stored" << std::endl;
+  }
+  auto   start  = std::chrono::steady_clock::now();
+  size_t failed = 0;
+  for (size_t chunk = 0; chunk < reader.getNumberOfChunks(); ++chunk)
+  {
+    if (!reader.verifyChunk(chunk))
+    {
+      std::cout << "Chunk " << chunk << " failed verification" << std::endl;
+      ++failed;
+    }
+  }
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+  std::cout << "Verified " << reader.getNumberOfChunks() << " chunks in "
+            << elapsed.count() << " s, " << failed << " failed" << std::endl;
+  return failed ? 1 : 0;
+}
+
+template <typename samp_type>
+int extract(const std::string& captureFile,
+            const double&      offset,
+            const double&      duration,
+            const std::string& rawFile)
+{
+  IFCaptureReader<samp_type> reader(logProblems);
+  if (!reader.openFile(captureFile))
+  {
+    return 1;
+  }
+  std::ofstream output(rawFile, std::ios::out | std::ios::binary);
+  if (!output.is_open())
+  {
+    std::cout << "Cannot open " << rawFile << std::endl;
+    return 1;
+  }
+
+  reader.seekToTime(reader.getStartTime() + (uint64_t)(offset * 1e9));
+  size_t remaining =
+    (size_t)(duration * reader.getFileHeader().samplingFreq + 0.5);
+  const size_t     first = reader.tell();
+  const samp_type* samples;
+  while (remaining > 0)
+  {
+    const size_t count = reader.readSamples(samples, remaining);
+    if (count == 0)
+    {
+      break;
+    }
+    output.write(reinterpret_cast<const char*>(samples),
+                 count * sizeof(samp_type));
+    remaining -= count;
+  }
+  std::cout << "Extracted samples " << first << " to " << reader.tell()
+            << " starting at " << reader.getSampleTime(first) << " ns"
+            << std::endl;
+  return 0;
+}
+
+// Calls the function template instance for the sample type of a capture
+template <template <typename> class Command, typename... Args>
+int dispatch(const std::string& captureFile, Args... args)
+{
+  IFCaptureFileHeader header;
+  std::string         error;
+  if (!readIFCaptureHeader(captureFile, header, error))
+  {
+    std::cout << error << std::endl;
+    return 1;
+  }
+  switch ((IFSampleType)header.sampleType)
+  {
+    case IFSampleType::SC8:
+      return Command<IFSampleSC8>::run(captureFile, args...);
+    case IFSampleType::SC16:
+      return Command<IFSampleSC16>::run(captureFile, args...);
+    case IFSampleType::FC32:
+      return Command<std::complex<float>>::run(captureFile, args...);
+    case IFSampleType::FC64:
+      return Command<std::complex<double>>::run(captureFile, args...);
+  }
+  std::cout << "Unknown sample type in " << captureFile << std::endl;
+  return 1;
+}
+
+template <typename samp_type>
+struct Info
+{
+  static int run(const std::string& captureFile)
+  {
+    return info<samp_type>(captureFile);
+  }
+};
+
+template <typename samp_type>
+struct Extract
+{
+  static int run(const std::string& captureFile,
+                 double             offset,
+                 double             duration,
+                 std::string        rawFile)
+  {
+    return extract<samp_type>(captureFile, offset, duration, rawFile);
+  }
+};
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string command = (argc > 1) ? argv[1] : "";
+  if ((command == "pack") && ((argc == 4) || (argc == 5)))
+  {
+    INIReader reader(argv[2]);
+    if (reader.ParseError() < 0)
+    {
+      std::cout << "Can't load metadata file: " << argv[2] << std::endl;
+      return 1;
+    }
+    std::string rawFile    = reader.Get("ifDataFile", "fileName", "");
+    std::string dataFormat = reader.Get("ifDataFile", "data_format", "");
+    IFSampleHeader header;
+    header.fs_ =
+      reader.GetInteger("ifDataFile", "sampling_frequency", 16368000);
+    header.if_ = reader.GetInteger("ifDataFile", "if_frequency", 0);
+    if (!reader.GetBoolean("ifDataFile", "isComplex", false))
+    {
+      std::cout << "Only complex recordings can be packed" << std::endl;
+      return 1;
+    }
+
+    // start time of the recording in seconds
+    const uint64_t startTime =
+      (argc == 5) ? (uint64_t)(std::strtod(argv[4], nullptr) * 1e9) : 0;
+    if (dataFormat == "sc8")
+    {
+      return pack<IFSampleSC8>(rawFile, header, argv[3], startTime);
+    }
+    if (dataFormat == "sc16")
+    {
+      return pack<IFSampleSC16>(rawFile, header, argv[3], startTime);
+    }
+    std::cout << "Unsupported data format: " << dataFormat << std::endl;
+    return 1;
+  }
+  if ((command == "info") && (argc == 3))
+  {
+    return dispatch<Info>(argv[2]);
+  }
+  if ((command == "extract") && (argc == 6))
+  {
+    return dispatch<Extract>(argv[2],
+                             std::strtod(argv[3], nullptr),
+                             std::strtod(argv[4], nullptr),
+                             std::string(argv[5]));
+  }
+
+  std::cout << "Usage: " << argv[0] << " pack <metadata file> <capture file>"
+            << " [start time s]" << std::endl;
+  std::cout << "       " << argv[0] << " info <capture file>" << std::endl;
+  std::cout << "       " << argv[0] << " extract <capture file>"
+            << " <offset s> <duration s> <raw file>" << std::endl;
+  return 0;
+}
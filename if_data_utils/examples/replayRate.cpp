@@ -0,0 +1,112 @@
+//============================================================================//
+//--------------------- if_data_utils/replayRate.cpp -----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Measures the sustained rate at which an SC8 IF recording can be replayed
+// through IFDataFilePrefetcher, with a float conversion of each block
+// standing in for the processing
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFDataFilePrefetcher.hpp"
+
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace if_data_utils;
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cout << "Usage: " << argv[0]
+              << " <sc8 file> [samples per block] [queue depth]"
+              << " [auto|uring|thread]" << std::endl;
+    return 0;
+  }
+  std::string filename   = argv[1];
+  size_t      blockSize  = (argc > 2) ? std::strtoul(argv[2], nullptr, 10)
+                                      : 50000;
+  size_t      queueDepth = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 8;
+  std::string backendStr = (argc > 4) ? argv[4] : "auto";
+
+  AsyncBlockReader::Backend backend = AsyncBlockReader::Backend::Auto;
+  if (backendStr == "uring")
+  {
+    backend = AsyncBlockReader::Backend::IoUring;
+  }
+  else if (backendStr == "thread")
+  {
+    backend = AsyncBlockReader::Backend::Thread;
+  }
+
+  IFSampleHeader header(blockSize, IFSampleType::SC8, 0.0, 50e6);
+  IFDataFilePrefetcher<IFSampleSC8> prefetcher(header, queueDepth);
+  if (!prefetcher.openFile(filename, backend))
+  {
+    return 1;
+  }
+
+  std::vector<std::complex<float>> converted(blockSize);
+  double                           power     = 0.0;
+  size_t                           numBlocks = 0;
+  while (IFSampleData<IFSampleSC8>* block = prefetcher.getBlock())
+  {
+    const IFSampleSC8* samples = block->getBufferPtr();
+    for (size_t ii = 0; ii < block->getNumberOfSamples(); ++ii)
+    {
+      converted[ii] =
+        std::complex<float>(samples[ii].real(), samples[ii].imag());
+      power += std::norm(converted[ii]);
+    }
+    prefetcher.releaseBlock(block);
+    ++numBlocks;
+  }
+
+  std::cout << "Backend: "
+            << ((prefetcher.getBackend() == AsyncBlockReader::Backend::IoUring)
+                  ? "io_uring"
+                  : "pread thread")
+            << std::endl;
+  std::cout << "Blocks read: " << numBlocks << std::endl;
+  std::cout << "Sustained rate: " << prefetcher.getThroughput() << " MB/s"
+            << std::endl;
+  std::cout << "Average queue depth: " << prefetcher.getAverageQueueDepth()
+            << " / " << queueDepth << std::endl;
+  std::cout << "Mean sample power: "
+            << power / (double)(numBlocks ? numBlocks * blockSize : 1)
+            << std::endl;
+  return 0;
+}
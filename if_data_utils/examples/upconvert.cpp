@@ -46,6 +46,11 @@ int main(int argc, char* argv[])
     std::cout << "Too many input arguments" << std::endl;
     return 0;
   }
+  if (argc < 3)
+  {
+    std::cout << "Not enough input arguments" << std::endl;
+    return 0;
+  }
 
   // Make data and event structure for files
   std::string liveSkyFile = argv[1];
@@ -72,6 +77,25 @@ int main(int argc, char* argv[])
   // Upconvert Signal
   if_data_utils::UpConvert upconvert;
   upconvert.addFile(ifFile);
+
+  // Optional output settings (defaults give a real signal at fs / 4)
+  if (reader.GetSections().count("output") > 0)
+  {
+    double outputFreq = reader.GetReal("output", "sampling_frequency", 0);
+    if (outputFreq > 0)
+    {
+      upconvert.setOutputSampFreq(outputFreq);
+    }
+    if (reader.GetFields("output").count("if_frequency") > 0)
+    {
+      upconvert.setOutputIf(reader.GetReal("output", "if_frequency", 0));
+    }
+    upconvert.setOutputFormat(reader.Get("output", "data_format", ""));
+    upconvert.setOutputComplex(
+      reader.GetBoolean("output", "isComplex", false));
+    upconvert.setGain(reader.GetReal("output", "gain", 1.0));
+  }
+
   std::string outfile = argv[2];
   upconvert.upconvertFile(outfile);
   return 0;
@@ -0,0 +1,125 @@
+//============================================================================//
+//----------------- if_data_utils/writeRate.cpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Measures the rate at which narrowed IF samples can be written through
+// IfData::writeSamples and the IFDataFileWriter block paths
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFDataFileWriter.hpp"
+#include "if_data_utils/IfData.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace if_data_utils;
+
+namespace
+{
+void report(const std::string&                           name,
+            size_t                                       bytes,
+            const std::chrono::steady_clock::time_point& start)
+{
+  double seconds = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  std::cout << name << ": " << bytes / (1024.0 * 1024.0) / seconds
+            << " MB/s" << std::endl;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string filename  = (argc > 1) ? argv[1] : "writeRate.bin";
+  size_t      fileMB    = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 256;
+  size_t      blockSize = 40000;  // the size of a FileMux block of sc8 I/Q
+
+  // a ramp exercises every low byte
+  Eigen::RowVectorXi samples(blockSize);
+  for (size_t ii = 0; ii < blockSize; ++ii)
+  {
+    samples[ii] = static_cast<int>(ii % 256) - 128;
+  }
+  size_t numBlocks = fileMB * 1024 * 1024 / blockSize;
+  size_t numBytes  = numBlocks * blockSize;
+
+  {
+    IfData ifData;
+    ifData.openOutFile(filename);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t ii = 0; ii < numBlocks; ++ii)
+    {
+      ifData.writeSamples(samples, 1);
+    }
+    ifData.close();
+    report("IfData::writeSamples", numBytes, start);
+  }
+
+  auto noLog = [](const std::string&, const logutils::LogLevel&) {};
+  struct Mode
+  {
+    const char* name;
+    bool        directIO;
+    bool        async;
+  };
+  const Mode modes[] = {{"IFDataFileWriter", false, false},
+                        {"IFDataFileWriter async", false, true},
+                        {"IFDataFileWriter direct async", true, true}};
+  for (const auto& mode : modes)
+  {
+    IFDataFileWriter<int8_t> writer(1 << 20, noLog);
+    if (!writer.createFile(filename, mode.directIO, mode.async))
+    {
+      return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t ii = 0; ii < numBlocks; ++ii)
+    {
+      writer.writeNarrowedToFile(samples.data(), blockSize, 1);
+    }
+    if (!writer.closeFile())
+    {
+      return 1;
+    }
+    report(std::string(mode.name) + (writer.isDirectIO() || !mode.directIO
+                                       ? ""
+                                       : " (buffered fallback)"),
+           numBytes, start);
+  }
+
+  std::remove(filename.c_str());
+  return 0;
+}
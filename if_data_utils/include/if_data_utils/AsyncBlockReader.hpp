@@ -0,0 +1,224 @@
+//============================================================================//
+//------------------ if_data_utils/AsyncBlockReader.hpp --------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the AsyncBlockReader class.
+/// \details  Reads consecutive blocks of a file with several reads in flight
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__ASYNC_BLOCK_READER_HPP
+#define IF_DATA_UTILS__ASYNC_BLOCK_READER_HPP
+
+// only define the file functions on unix platforms
+// this effectively renders the class useless on a win platform
+#ifndef _WIN32
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logutils/logutils.hpp"
+
+namespace if_data_utils
+{
+/// \brief Reads consecutive fixed-size blocks of a file asynchronously
+///
+/// Up to queueDepth block reads are kept in flight, each into a buffer
+/// provided by the caller with submit(). Completed blocks are returned by
+/// wait() in the order they were submitted. Reads use io_uring where the
+/// kernel supports it, and otherwise a worker thread issuing pread().
+///
+/// All storage is sized in open(), so submitting and waiting for blocks does
+/// not allocate. The class is meant to be driven from a single thread.
+class AsyncBlockReader
+{
+public:
+  /// The I/O mechanism used for the reads
+  enum class Backend
+  {
+    Auto = 0,  // io_uring if available, the thread otherwise
+    IoUring,
+    Thread
+  };
+
+  /// \brief Constructor for the reader
+  ///
+  /// \param log The provided log callback function
+  AsyncBlockReader(
+    const logutils::LogCallback& log = logutils::printLogToStdOut);
+
+  ~AsyncBlockReader() { close(); }
+
+  AsyncBlockReader(const AsyncBlockReader&) = delete;
+  AsyncBlockReader& operator=(const AsyncBlockReader&) = delete;
+
+  /// \brief Opens a file for reading
+  ///
+  /// \param filename The file to read
+  /// \param blockBytes The size of each block (bytes)
+  /// \param queueDepth The largest number of reads in flight
+  /// \param backend The I/O mechanism to use
+  /// \param startOffset The file offset of the first block (bytes)
+  /// \returns True if the file was opened (with the requested backend)
+  bool open(const std::string& filename,
+            const size_t&      blockBytes,
+            const size_t&      queueDepth,
+            const Backend&     backend     = Backend::Auto,
+            const size_t&      startOffset = 0);
+
+  /// \brief Cancels the outstanding reads and closes the file
+  void close();
+
+  /// \brief Queues a read of the next block of the file
+  ///
+  /// \param buffer The storage for the block (at least blockBytes), which
+  ///               must stay valid until it is returned by wait()
+  /// \returns False if the queue is full, the end of the file was reached or
+  ///          the read could not be queued (the buffer is not kept)
+  bool submit(void* buffer);
+
+  /// \brief Waits for the oldest block read to complete
+  ///
+  /// \param buffer Set to the buffer of the completed block
+  /// \returns The number of bytes read (less than blockBytes only for the
+  ///          last block of the file), or -1 on error or an empty queue
+  ssize_t wait(void*& buffer);
+
+  /// \brief Returns true if a file is open
+  bool isOpen() const { return fileDescriptor_ >= 0; }
+
+  /// \brief Returns the number of reads in flight
+  size_t getQueueDepth() const { return count_; }
+
+  /// \brief Returns the largest number of reads in flight
+  size_t getMaxQueueDepth() const { return requests_.size(); }
+
+  /// \brief Returns the backend in use
+  Backend getBackend() const { return backend_; }
+
+  /// \brief Returns true if every block of the file has been submitted
+  bool isEndOfFile() const { return nextOffset_ >= fileSize_; }
+
+  /// \brief Returns the number of bytes returned by wait() since open()
+  size_t getBytesRead() const { return bytesRead_; }
+
+  /// \brief Returns the rate at which bytes were returned since open() (MB/s)
+  double getThroughput() const;
+
+  /// \brief Returns the mean number of reads in flight seen by wait()
+  double getAverageQueueDepth() const
+  {
+    return (numWaits_ > 0) ? (double)queueDepthSum_ / numWaits_ : 0.0;
+  }
+
+  void setLogHandler(const logutils::LogCallback& log) { log_ = log; }
+
+private:
+  // A single block read
+  struct Request
+  {
+    void*        buffer;
+    size_t       offset;
+    size_t       size;
+    size_t       done;
+    int          error;
+    bool         complete;
+    struct iovec iov;
+  };
+
+  // Starts (or continues after a short read) the read of a request
+  bool startRequest(const size_t& index);
+
+  // io_uring backend
+  bool setupIoUring(const size_t& queueDepth);
+  void closeIoUring();
+  bool submitIoUring(const size_t& index);
+  bool reapIoUring();
+
+  // thread backend
+  void workerLoop();
+
+  logutils::LogCallback log_;
+
+  int     fileDescriptor_;
+  Backend backend_;
+  size_t  blockBytes_;
+  size_t  fileSize_;
+  size_t  nextOffset_;
+
+  // requests in submission order, as a ring of head_ and count_
+  std::vector<Request> requests_;
+  size_t               head_;
+  size_t               count_;
+
+  // statistics
+  size_t                                bytesRead_;
+  size_t                                numWaits_;
+  size_t                                queueDepthSum_;
+  std::chrono::steady_clock::time_point openTime_;
+
+  // io_uring state (the rings are shared with the kernel)
+  int       ringFd_;
+  void*     sqRing_;
+  size_t    sqRingSize_;
+  void*     cqRing_;
+  size_t    cqRingSize_;
+  void*     sqes_;
+  size_t    sqesSize_;
+  unsigned* sqTail_;
+  unsigned* sqMask_;
+  unsigned* sqArray_;
+  unsigned* cqHead_;
+  unsigned* cqTail_;
+  unsigned* cqMask_;
+  void*     cqes_;
+
+  // thread backend state (the worker serves requests in ring order)
+  std::thread             worker_;
+  std::mutex              workerMutex_;
+  std::condition_variable workerCondition_;
+  size_t                  pendingCount_;
+  size_t                  pendingIndex_;
+  bool                    stopWorker_;
+};
+
+}  // namespace if_data_utils
+#endif
+#endif
@@ -44,6 +44,7 @@
 #ifndef IF_DATA_UTILS_FILEMUX_HPP
 #define IF_DATA_UTILS_FILEMUX_HPP
 
+#include <memory>
 #include <vector>
 #include "IfData.hpp"
 #include "dataFileStructures.hpp"
@@ -67,31 +68,72 @@ public:
 
   /// \Brief Combines data files to generate a signle attack file
   ///
+  /// The first file is the reference that runs for the whole output; every
+  /// other file is mixed in, scaled, during its event. The files are read
+  /// and mixed in large segments by a pool of worker threads.
+  ///
   /// \param name of desired output file
   bool combineFiles(std::string outFile);
 
   //////////////////////////////////
   /////////Setter Functions/////////
   //////////////////////////////////
-  /// \Brief Sets number of samples to be read per block
+  /// \Brief Sets number of samples per block (the resolution of the event
+  /// timing and power ramps)
   void setBlkSize(int blkSize) { blkSize_ = blkSize; }
 
   /// \Brief Sets number of files to be combined
   void setNumberOfFiles(int numberOfFiles) { numberOfFiles_ = numberOfFiles; }
 
+  /// \Brief Sets the number of worker threads used to combine files
+  void setNumberOfThreads(int numThreads)
+  {
+    numThreads_ = (numThreads > 0) ? numThreads : 1;
+  }
+
+  /// \Brief Sets the number of samples read and mixed at a time by a worker
+  void setSegmentSize(int segmentSize)
+  {
+    segmentSize_ = (segmentSize > 0) ? segmentSize : 1;
+  }
+
   //////////////////////////////////
   /////////Getter Functions/////////
   //////////////////////////////////
   /// \Brief Gets number of samples to be read per block
   int getBlkSize() { return blkSize_; }
 
+  /// \Brief Gets the number of worker threads used to combine files
+  int getNumberOfThreads() { return numThreads_; }
+
+  /// \Brief Gets the number of samples read and mixed at a time by a worker
+  int getSegmentSize() { return segmentSize_; }
+
   /// \Brief Gets file duration in number of samples
   float getFileDurationSamp() { return fileDurationSamp_; }
 
 private:
+  /// \Brief The blocks during which an auxilary file is mixed in, and its
+  /// power over them
+  struct EventProfile
+  {
+    long   activationBlk;
+    long   deactivationBlk;
+    double startPower;
+    double powerStep;
+  };
+
+  /// \Brief The files and buffers used by one worker thread
+  struct Worker
+  {
+    std::vector<std::unique_ptr<IfData> > inputs;
+    Eigen::VectorXf                       samples;
+    Eigen::VectorXf                       mixed;
+  };
+
   /// \Brief Determines the maximum value of all data files and sets
   /// scale value so that combination of signals does not saturate
-  void determineMax();
+  void determineMax(std::vector<Worker>& workers);
 
   /// \Brief Validates that all data files are of similar record
   /// values, e.g. same sampling frequencies, IF values, and data formats
@@ -101,28 +143,34 @@ private:
   /// and power level at start of event
   void createEventProfile(int idx);
 
-  /// \Brief Checks if current block features an event
-  bool checkIfEventActive(int blk, int idx);
+  /// \Brief Returns the power of an auxilary file in the given block, zero
+  /// outside of its event
+  double eventPower(long blk, int idx) const;
+
+  /// \Brief Opens every data file for a worker
+  bool openFiles(Worker& worker);
 
-  /// \Brief Calls proper IF Data class object to read data file
-  void readFile(int idx, Eigen::VectorXf& samplesEigen);
+  /// \Brief Returns the index of the first sample used from a data file
+  uint64_t getSampleOffset(int idx) const;
 
-  /// \Brief Opens proper IF Data class object to open data file
-  void openFile(int idx);
+  /// \Brief Mixes and writes every segment of the output
+  template <typename out_type>
+  void mixFiles(std::vector<Worker>& workers);
+
+  /// \Brief Mixes one segment of the output (in blocks)
+  template <typename out_type>
+  void mixSegment(Worker&             worker,
+                  long                firstBlk,
+                  long                numBlks,
+                  Eigen::RowVectorXi& dataOutput);
 
   /// Private class variables
 
   /// IF data class objects
-  if_data_utils::IfData ifData0_;
-  if_data_utils::IfData ifData1_;
-  if_data_utils::IfData ifData2_;
   if_data_utils::IfData ifDataOut_;
 
   /// Event Variables
-  std::vector<float> eventActivationBlk_;
-  std::vector<float> eventDeactivationBlk_;
-  std::vector<float> eventDeltaPowerFrac_;
-  std::vector<float> eventPower_;
+  std::vector<EventProfile> events_;
 
   /// File Variables
   int                   numberOfFiles_;
@@ -132,6 +180,10 @@ private:
   int                   blkSize_;
   int                   numOfLoops_{};
   float                 fileDurationSamp_{};
+
+  /// Threading Variables
+  int numThreads_;
+  int segmentSize_;
 };
 }  // namespace if_data_utils
 
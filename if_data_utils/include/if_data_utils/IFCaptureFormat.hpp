@@ -0,0 +1,133 @@
+//============================================================================//
+//------------------ if_data_utils/IFCaptureFormat.hpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the layout of IF capture container files.
+/// \details  A capture file is a fixed header followed by fixed-size chunks
+///           of samples, each with its own timestamp and optional checksum
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__IF_CAPTURE_FORMAT_HPP
+#define IF_DATA_UTILS__IF_CAPTURE_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "if_data_utils/IFSampleData.hpp"
+
+namespace if_data_utils
+{
+/// Identifies a capture file
+const char ifCaptureMagic[8] = {'I', 'S', '4', 'S', 'I', 'F', 'C', '\0'};
+
+/// Identifies the start of a chunk
+const char ifCaptureChunkSync[4] = {'I', 'F', 'C', 'K'};
+
+/// The layout version written by IFCaptureWriter
+const uint32_t ifCaptureVersion = 1;
+
+/// Chunks (and the samples after the file header) start on this boundary,
+/// so each chunk can be mapped or read with direct I/O on its own
+const size_t ifCaptureAlignment = 4096;
+
+/// Chunks carry a CRC-32 of their samples
+const uint16_t ifCaptureChecksumFlag = 0x0001;
+
+/// \brief The header at the start of a capture file
+///
+/// The fields mirror IFSampleHeader, with numSamples covering the whole
+/// capture. Every chunk spans chunkBytes, so chunk k starts at
+/// headerBytes + k * chunkBytes and the chunk holding any sample (or time)
+/// can be found without an index. numSamples and numChunks are zero until
+/// the file is closed by the writer. All fields are little-endian.
+struct IFCaptureFileHeader
+{
+  char     magic[8];
+  uint32_t version;
+  uint32_t headerBytes;       //!< Offset of the first chunk [bytes]
+  uint64_t numSamples;        //!< Samples in the capture
+  uint8_t  sampleType;        //!< IFSampleType of the samples
+  uint8_t  complex;           //!< True if I and Q data is present
+  uint16_t bytesPerSample;    //!< Number of bytes per sample
+  uint16_t samplesPerByte;    //!< Number of samples per byte (if < 8-bit)
+  uint16_t flags;             //!< ifCaptureChecksumFlag
+  double   samplingFreq;      //!< Samples per second [Hz]
+  double   intermediateFreq;  //!< Intermediate frequency [Hz]
+  uint64_t startTime;         //!< Time of the first sample [ns]
+  uint64_t samplesPerChunk;   //!< Samples in every chunk but the last
+  uint64_t chunkBytes;        //!< Distance between chunk starts [bytes]
+  uint64_t numChunks;         //!< Chunks in the capture
+  uint8_t  reserved[48];
+};
+
+/// \brief The header at the start of every chunk, ahead of its samples
+struct IFCaptureChunkHeader
+{
+  char     sync[4];
+  uint32_t checksum;     //!< CRC-32 of the samples, 0 without checksums
+  uint64_t chunkIndex;   //!< Position of the chunk in the file
+  uint64_t firstSample;  //!< Index of the first sample in the capture
+  uint64_t time;         //!< Time of the first sample [ns]
+  uint64_t numSamples;   //!< Samples in the chunk
+  uint8_t  reserved[24];
+};
+
+static_assert(sizeof(IFCaptureFileHeader) == 128,
+              "Capture file header layout changed");
+static_assert(sizeof(IFCaptureChunkHeader) == 64,
+              "Capture chunk header layout changed");
+
+/// \brief Computes the CRC-32 (IEEE 802.3) of a buffer
+///
+/// \param data The bytes to check
+/// \param numBytes The number of bytes
+/// \param crc The CRC of any preceding bytes, to continue a running CRC
+/// \returns The CRC of the preceding bytes and the buffer
+uint32_t computeCrc32(const void* data, size_t numBytes, uint32_t crc = 0);
+
+/// \brief Reads and validates the header of a capture file
+///
+/// \param filename The capture file
+/// \param header The header read from the file
+/// \param error Set to a description of the problem if the file is not a
+///              capture file
+/// \returns True if the header was read and is valid
+bool readIFCaptureHeader(const std::string&   filename,
+                         IFCaptureFileHeader& header,
+                         std::string&         error);
+}  // namespace if_data_utils
+
+#endif
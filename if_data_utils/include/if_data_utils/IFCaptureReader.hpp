@@ -0,0 +1,638 @@
+//============================================================================//
+//------------------ if_data_utils/IFCaptureReader.hpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the IFCaptureReader class.
+/// \details  Memory-mapped, seekable access to IF capture files
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__IF_CAPTURE_READER_HPP
+#define IF_DATA_UTILS__IF_CAPTURE_READER_HPP
+
+// only define the file functions on unix platforms
+// this effectively renders the class useless on a win platform
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "if_data_utils/IFCaptureFormat.hpp"
+#include "logutils/logutils.hpp"
+
+namespace if_data_utils
+{
+/// \brief A class object for reading capture files through a memory mapping
+///
+/// The file is mapped read-only and samples are returned as pointers into
+/// the mapping. Since every chunk has the same size, the chunk holding a
+/// sample or a time is computed directly from the file header; the chunk
+/// timestamps are then used to correct the estimate, so seeking to a time
+/// touches one or two chunk headers when the capture runs at its nominal
+/// rate, and a binary search of the chunk timestamps otherwise.
+///
+/// Samples are contiguous within a chunk only: getSamples() and
+/// readSamples() return at most the rest of the chunk, while copySamples()
+/// gathers a range across chunks.
+template <typename samp_type>
+class IFCaptureReader
+{
+public:
+  /// \brief Constructor for the capture reader class
+  ///
+  /// \param log The provided log callback function
+  IFCaptureReader(const logutils::LogCallback& log = logutils::printLogToStdOut)
+    : mapping_(nullptr)
+    , mappingSize_(0)
+    , numSamples_(0)
+    , numChunks_(0)
+    , cursor_(0)
+    , log_(log)
+  {
+    std::memset(&header_, 0, sizeof(header_));
+  }
+
+  ~IFCaptureReader() { closeFile(); }
+
+  IFCaptureReader(const IFCaptureReader&) = delete;
+  IFCaptureReader& operator=(const IFCaptureReader&) = delete;
+
+  /// \brief Maps the provided capture file
+  ///
+  /// \param filename The capture file
+  /// \returns True if the file was mapped and holds samples of samp_type
+  bool openFile(const std::string& filename);
+
+  /// \brief Unmaps the current file (invalidates all sample pointers)
+  void closeFile();
+
+  /// \brief Returns true if a file is mapped
+  bool isOpen() const { return mapping_ != nullptr; }
+
+  /// \brief Returns the header of the capture file
+  const IFCaptureFileHeader& getFileHeader() const { return header_; }
+
+  /// \brief Returns the capture description as a sample header
+  IFSampleHeader getHeader() const
+  {
+    IFSampleHeader header;
+    header.numSamples_     = numSamples_;
+    header.sampleType_     = (IFSampleType)header_.sampleType;
+    header.fs_             = header_.samplingFreq;
+    header.if_             = header_.intermediateFreq;
+    header.complex_        = header_.complex != 0;
+    header.bytesPerSample_ = header_.bytesPerSample;
+    header.samplesPerByte_ = header_.samplesPerByte;
+    return header;
+  }
+
+  /// \brief Returns the time of the first sample [ns]
+  uint64_t getStartTime() const { return header_.startTime; }
+
+  /// \brief Returns the number of samples in the capture
+  size_t getNumberOfSamples() const { return numSamples_; }
+
+  /// \brief Returns the number of chunks in the capture
+  size_t getNumberOfChunks() const { return numChunks_; }
+
+  /// \brief Returns the number of samples in every chunk but the last
+  size_t getSamplesPerChunk() const { return header_.samplesPerChunk; }
+
+  /// \brief Returns the header of a chunk, or nullptr if there is no chunk
+  ///
+  /// The header is returned as stored; its fields are not validated.
+  const IFCaptureChunkHeader* getChunkHeader(const size_t& chunk) const
+  {
+    if (chunk >= numChunks_)
+    {
+      return nullptr;
+    }
+    return reinterpret_cast<const IFCaptureChunkHeader*>(
+      (const char*)mapping_ + header_.headerBytes +
+      chunk * header_.chunkBytes);
+  }
+
+  /// \brief Returns the samples of a chunk
+  ///
+  /// The chunk header is not covered by the checksum, so its fields are
+  /// checked against the layout given by the file header before use.
+  ///
+  /// \param chunk The index of the chunk
+  /// \param numSamples Set to the number of samples in the chunk
+  /// \returns A pointer to the first sample, or nullptr if there is no chunk
+  ///          or its header is corrupt
+  const samp_type* getChunk(const size_t& chunk, size_t& numSamples) const
+  {
+    const IFCaptureChunkHeader* chunkHeader = getValidChunkHeader(chunk);
+    if (!chunkHeader)
+    {
+      numSamples = 0;
+      return nullptr;
+    }
+    numSamples = chunkHeader->numSamples;
+    return reinterpret_cast<const samp_type*>(chunkHeader + 1);
+  }
+
+  /// \brief Checks the samples of a chunk against the stored checksum
+  ///
+  /// \returns True if the chunk is intact (always, if the capture was
+  ///          written without checksums), false if it is missing or its
+  ///          header is corrupt
+  bool verifyChunk(const size_t& chunk) const;
+
+  /// \brief Returns the index of the sample nearest to a time
+  ///
+  /// \param time The time to find [ns]
+  /// \returns The sample index, clamped to the capture
+  size_t findSample(const uint64_t& time) const;
+
+  /// \brief Returns the time of a sample [ns]
+  uint64_t getSampleTime(const size_t& index) const;
+
+  /// \brief Returns a pointer to a range of samples within one chunk
+  ///
+  /// \param index The index of the first sample
+  /// \param count The number of samples wanted; reduced to the samples that
+  ///              are contiguous with the first (the rest of its chunk)
+  /// \returns A pointer to the first sample, or nullptr if the index is past
+  ///          the end of the capture
+  const samp_type* getSamples(const size_t& index, size_t& count) const;
+
+  /// \brief Copies a range of samples, crossing chunks as needed
+  ///
+  /// \param index The index of the first sample
+  /// \param count The number of samples to copy
+  /// \param samples The destination of the samples
+  /// \returns The number of samples copied (fewer at the end of the capture)
+  size_t copySamples(const size_t& index,
+                     const size_t& count,
+                     samp_type*    samples) const;
+
+  /// \brief Returns the next samples from the cursor and advances it
+  ///
+  /// \param samples Set to the first sample of the block
+  /// \param count The number of samples wanted
+  /// \returns The number of samples in the block (up to the end of the
+  ///          chunk), or 0 at the end of the capture
+  size_t readSamples(const samp_type*& samples, const size_t& count)
+  {
+    size_t available = count;
+    samples          = getSamples(cursor_, available);
+    if (!samples)
+    {
+      return 0;
+    }
+    cursor_ += available;
+    return available;
+  }
+
+  /// \brief Returns the sample index of the cursor
+  size_t tell() const { return cursor_; }
+
+  /// \brief Moves the cursor to the provided sample index
+  ///
+  /// \returns False if the index is past the end of the capture
+  bool seek(const size_t& index)
+  {
+    if (index > numSamples_)
+    {
+      return false;
+    }
+    cursor_ = index;
+    prefetch(cursor_, header_.samplesPerChunk);
+    return true;
+  }
+
+  /// \brief Moves the cursor to the sample nearest to a time
+  ///
+  /// \param time The time to seek to [ns]
+  void seekToTime(const uint64_t& time) { seek(findSample(time)); }
+
+  /// \brief Asks the kernel to start reading a range of samples
+  void prefetch(const size_t& index, const size_t& count) const;
+
+  void setLogHandler(const logutils::LogCallback& log) { log_ = log; }
+
+private:
+  // Returns the size of a chunk holding the provided number of samples
+  size_t chunkSize(const uint64_t& numSamples) const
+  {
+    return sizeof(IFCaptureChunkHeader) + numSamples * sizeof(samp_type);
+  }
+
+  // Returns the number of samples the layout puts in a chunk
+  uint64_t expectedChunkSamples(const size_t& chunk) const
+  {
+    return (chunk + 1 < numChunks_)
+             ? header_.samplesPerChunk
+             : numSamples_ - (numChunks_ - 1) * header_.samplesPerChunk;
+  }
+
+  // Returns the header of a chunk if it matches the file layout, so its
+  // samples lie within the mapping; nullptr otherwise
+  const IFCaptureChunkHeader* getValidChunkHeader(const size_t& chunk) const;
+
+  // Recovers the sample and chunk counts of a capture that was not closed
+  void recoverCounts();
+
+  void*               mapping_;
+  size_t              mappingSize_;
+  IFCaptureFileHeader header_;
+  size_t              numSamples_;
+  size_t              numChunks_;
+  size_t              cursor_;
+
+  // local storage of the log callback
+  logutils::LogCallback log_;
+};
+
+template <class samp_type>
+bool IFCaptureReader<samp_type>::openFile(const std::string& filename)
+{
+  closeFile();
+
+  std::string error;
+  if (!readIFCaptureHeader(filename, header_, error))
+  {
+    log_(error, logutils::LogLevel::Error);
+    return false;
+  }
+  if ((header_.sampleType != (uint8_t)IFSampleTraits<samp_type>::type) ||
+      (header_.bytesPerSample != sizeof(samp_type)))
+  {
+    log_(filename + " holds a different sample type",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  int fileDescriptor = open(filename.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+  {
+    std::stringstream errStr;
+    errStr << "File open failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+
+  struct stat fileStat;
+  if (fstat(fileDescriptor, &fileStat) != 0)
+  {
+    log_("Unable to size " + filename, logutils::LogLevel::Error);
+    close(fileDescriptor);
+    return false;
+  }
+
+  void* mapping = mmap(
+    nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  // the mapping holds its own reference to the file
+  close(fileDescriptor);
+  if (mapping == MAP_FAILED)
+  {
+    std::stringstream errStr;
+    errStr << "File map failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+
+  mapping_     = mapping;
+  mappingSize_ = fileStat.st_size;
+  numSamples_  = header_.numSamples;
+  numChunks_   = header_.numChunks;
+  cursor_      = 0;
+
+  if (numChunks_ == 0)
+  {
+    recoverCounts();
+  }
+  else if ((numChunks_ - 1) * header_.samplesPerChunk >= numSamples_ ||
+           numSamples_ > numChunks_ * header_.samplesPerChunk ||
+           mappingSize_ <
+             header_.headerBytes + (numChunks_ - 1) * header_.chunkBytes +
+               chunkSize(numSamples_ -
+                         (numChunks_ - 1) * header_.samplesPerChunk))
+  {
+    log_(filename + " is truncated or its header is corrupt",
+         logutils::LogLevel::Error);
+    closeFile();
+    return false;
+  }
+
+  // advice is only a hint, so failures are ignored
+  madvise(mapping_, mappingSize_, MADV_SEQUENTIAL);
+
+  std::stringstream msg;
+  msg << "Successfully mapped: " << filename << " (" << numSamples_
+      << " samples in " << numChunks_ << " chunks)";
+  log_(msg.str(), logutils::LogLevel::Info);
+  return true;
+}
+
+template <class samp_type>
+void IFCaptureReader<samp_type>::recoverCounts()
+{
+  // every chunk but the last is full, so only the last header is needed
+  numChunks_  = 0;
+  numSamples_ = 0;
+  if (mappingSize_ <= header_.headerBytes)
+  {
+    return;
+  }
+  numChunks_ = (mappingSize_ - header_.headerBytes + header_.chunkBytes - 1) /
+               header_.chunkBytes;
+  while (numChunks_ > 0)
+  {
+    const size_t                last = numChunks_ - 1;
+    const size_t                begin = header_.headerBytes +
+                                        last * header_.chunkBytes;
+    const IFCaptureChunkHeader* chunkHeader = getChunkHeader(last);
+    if ((mappingSize_ - begin >= sizeof(IFCaptureChunkHeader)) &&
+        (std::memcmp(chunkHeader->sync,
+                     ifCaptureChunkSync,
+                     sizeof(ifCaptureChunkSync)) == 0) &&
+        (chunkHeader->chunkIndex == last) &&
+        (chunkHeader->numSamples <= header_.samplesPerChunk) &&
+        (mappingSize_ - begin >= chunkSize(chunkHeader->numSamples)))
+    {
+      numSamples_ = last * header_.samplesPerChunk + chunkHeader->numSamples;
+      break;
+    }
+    // the last chunk was cut off while recording
+    --numChunks_;
+  }
+
+  std::stringstream msg;
+  msg << "Capture was not closed, recovered " << numChunks_ << " chunks";
+  log_(msg.str(), logutils::LogLevel::Warn);
+}
+
+template <class samp_type>
+void IFCaptureReader<samp_type>::closeFile()
+{
+  if (mapping_)
+  {
+    munmap(mapping_, mappingSize_);
+    log_("File closed.", logutils::LogLevel::Info);
+  }
+  mapping_     = nullptr;
+  mappingSize_ = 0;
+  numSamples_  = 0;
+  numChunks_   = 0;
+  cursor_      = 0;
+}
+
+template <class samp_type>
+const IFCaptureChunkHeader* IFCaptureReader<samp_type>::getValidChunkHeader(
+  const size_t& chunk) const
+{
+  const IFCaptureChunkHeader* chunkHeader = getChunkHeader(chunk);
+  if (!chunkHeader)
+  {
+    return nullptr;
+  }
+  // openFile() checked that the mapping holds every chunk of this layout
+  if ((std::memcmp(chunkHeader->sync,
+                   ifCaptureChunkSync,
+                   sizeof(ifCaptureChunkSync)) != 0) ||
+      (chunkHeader->chunkIndex != chunk) ||
+      (chunkHeader->firstSample != chunk * header_.samplesPerChunk) ||
+      (chunkHeader->numSamples != expectedChunkSamples(chunk)))
+  {
+    std::stringstream errStr;
+    errStr << "Capture chunk " << chunk << " has a corrupt header";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return nullptr;
+  }
+  return chunkHeader;
+}
+
+template <class samp_type>
+bool IFCaptureReader<samp_type>::verifyChunk(const size_t& chunk) const
+{
+  size_t           numSamples;
+  const samp_type* samples = getChunk(chunk, numSamples);
+  if (!samples)
+  {
+    return false;
+  }
+  if (!(header_.flags & ifCaptureChecksumFlag))
+  {
+    return true;
+  }
+  return computeCrc32(samples, numSamples * sizeof(samp_type)) ==
+         getChunkHeader(chunk)->checksum;
+}
+
+template <class samp_type>
+size_t IFCaptureReader<samp_type>::findSample(const uint64_t& time) const
+{
+  if (numChunks_ == 0)
+  {
+    return 0;
+  }
+  const IFCaptureChunkHeader* chunkHeader = getValidChunkHeader(0);
+  if (time <= (chunkHeader ? chunkHeader->time : header_.startTime))
+  {
+    return 0;
+  }
+
+  // estimate the chunk from the nominal sampling frequency
+  const double fs       = header_.samplingFreq;
+  const double estimate = (double)(time - header_.startTime) * 1e-9 * fs /
+                          (double)header_.samplesPerChunk;
+  size_t chunk = (estimate < (double)(numChunks_ - 1)) ? (size_t)estimate
+                                                       : numChunks_ - 1;
+
+  // the chunk timestamps are authoritative. Find the last chunk starting at
+  // or before the time, keeping it in [first, last). The estimate and its
+  // successor usually settle it; if the capture was retimed, the rest of
+  // the chunks are binary searched by their timestamps.
+  size_t first = 0;
+  size_t last  = numChunks_;
+  for (size_t probe = chunk; (probe <= chunk + 1) && (probe < last); ++probe)
+  {
+    chunkHeader = getValidChunkHeader(probe);
+    if (!chunkHeader)
+    {
+      break;
+    }
+    if (time >= chunkHeader->time)
+    {
+      first = probe;
+    }
+    else
+    {
+      last = probe;
+    }
+  }
+  while (last - first > 1)
+  {
+    const size_t middle = first + (last - first) / 2;
+    chunkHeader         = getValidChunkHeader(middle);
+    if (!chunkHeader)
+    {
+      break;
+    }
+    if (time >= chunkHeader->time)
+    {
+      first = middle;
+    }
+    else
+    {
+      last = middle;
+    }
+  }
+
+  chunkHeader = (last - first == 1) ? getValidChunkHeader(first) : nullptr;
+  if (!chunkHeader)
+  {
+    // fall back to the nominal estimate around a corrupt chunk
+    const double index = estimate * (double)header_.samplesPerChunk;
+    return (index < (double)numSamples_) ? (size_t)index : numSamples_;
+  }
+  const uint64_t offset =
+    (uint64_t)llround((double)(time - chunkHeader->time) * 1e-9 * fs);
+  if (offset >= chunkHeader->numSamples)
+  {
+    return chunkHeader->firstSample + chunkHeader->numSamples;
+  }
+  return chunkHeader->firstSample + offset;
+}
+
+template <class samp_type>
+uint64_t IFCaptureReader<samp_type>::getSampleTime(const size_t& index) const
+{
+  if (numChunks_ == 0)
+  {
+    return header_.startTime;
+  }
+  size_t chunk = index / header_.samplesPerChunk;
+  if (chunk >= numChunks_)
+  {
+    chunk = numChunks_ - 1;
+  }
+  const IFCaptureChunkHeader* chunkHeader = getValidChunkHeader(chunk);
+  if (!chunkHeader)
+  {
+    // fall back to the nominal time around a corrupt chunk
+    return header_.startTime +
+           (uint64_t)llround((double)index / header_.samplingFreq * 1e9);
+  }
+  const double offset =
+    (double)(index - chunkHeader->firstSample) / header_.samplingFreq;
+  return chunkHeader->time + (uint64_t)llround(offset * 1e9);
+}
+
+template <class samp_type>
+const samp_type* IFCaptureReader<samp_type>::getSamples(const size_t& index,
+                                                        size_t& count) const
+{
+  if (index >= numSamples_)
+  {
+    count = 0;
+    return nullptr;
+  }
+  const size_t     chunk  = index / header_.samplesPerChunk;
+  const size_t     offset = index % header_.samplesPerChunk;
+  size_t           numSamples;
+  const samp_type* samples = getChunk(chunk, numSamples);
+  if (!samples)
+  {
+    count = 0;
+    return nullptr;
+  }
+  if (count > numSamples - offset)
+  {
+    count = numSamples - offset;
+  }
+  return samples + offset;
+}
+
+template <class samp_type>
+size_t IFCaptureReader<samp_type>::copySamples(const size_t& index,
+                                               const size_t& count,
+                                               samp_type*    samples) const
+{
+  size_t copied = 0;
+  while (copied < count)
+  {
+    size_t           available = count - copied;
+    const samp_type* block     = getSamples(index + copied, available);
+    if (!block)
+    {
+      break;
+    }
+    std::memcpy(samples + copied, block, available * sizeof(samp_type));
+    copied += available;
+  }
+  return copied;
+}
+
+template <class samp_type>
+void IFCaptureReader<samp_type>::prefetch(const size_t& index,
+                                          const size_t& count) const
+{
+  if ((!mapping_) || (index >= numSamples_) || (count == 0))
+  {
+    return;
+  }
+  const size_t last = ((count < numSamples_ - index) ? index + count
+                                                     : numSamples_) -
+                      1;
+
+  // madvise() requires a page aligned start address
+  const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  const size_t begin    = (const char*)getChunkHeader(
+                         index / header_.samplesPerChunk) -
+                       (const char*)mapping_;
+  const size_t lastChunk = last / header_.samplesPerChunk;
+  const size_t end       = (const char*)getChunkHeader(lastChunk) -
+                     (const char*)mapping_ +
+                     chunkSize(last % header_.samplesPerChunk + 1);
+  const size_t alignedBegin = begin - (begin % pageSize);
+
+  madvise((char*)mapping_ + alignedBegin, end - alignedBegin, MADV_WILLNEED);
+}
+
+}  // namespace if_data_utils
+#endif
+#endif
@@ -0,0 +1,397 @@
+//============================================================================//
+//------------------ if_data_utils/IFCaptureWriter.hpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the IFCaptureWriter class.
+/// \details  Records IF samples into an indexed, timestamped capture file
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__IF_CAPTURE_WRITER_HPP
+#define IF_DATA_UTILS__IF_CAPTURE_WRITER_HPP
+
+// only define the file functions on unix platforms
+// this effectively renders the class useless on a win platform
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "if_data_utils/IFCaptureFormat.hpp"
+#include "logutils/logutils.hpp"
+
+namespace if_data_utils
+{
+/// \brief A class object for recording IF samples into a capture file
+///
+/// Samples are staged into a chunk buffer and each full chunk is written
+/// with its header (sample index, timestamp and optional CRC-32) in a single
+/// write. Chunk timestamps follow from the start time and the sampling
+/// frequency unless the caller provides the time of a block of samples, in
+/// which case later chunks are timed from that block. The file header is
+/// completed by closeFile(); a capture that was never closed can still be
+/// read up to its last complete chunk.
+template <typename samp_type>
+class IFCaptureWriter
+{
+public:
+  /// \brief Constructor for the capture writer class
+  ///
+  /// \param log The provided log callback function
+  IFCaptureWriter(const logutils::LogCallback& log = logutils::printLogToStdOut)
+    : fileDescriptor_(-1)
+    , chunk_(nullptr)
+    , staged_(0)
+    , numSamples_(0)
+    , numChunks_(0)
+    , anchorTime_(0)
+    , anchorSample_(0)
+    , log_(log)
+  {
+    std::memset(&header_, 0, sizeof(header_));
+  }
+
+  ~IFCaptureWriter() { closeFile(); }
+
+  IFCaptureWriter(const IFCaptureWriter&) = delete;
+  IFCaptureWriter& operator=(const IFCaptureWriter&) = delete;
+
+  /// \brief Creates a capture file
+  ///
+  /// \param filename The file to create (an existing file is truncated)
+  /// \param header The sampling and intermediate frequencies of the samples
+  ///               (the sample type and size follow from samp_type)
+  /// \param startTime The time of the first sample [ns]
+  /// \param samplesPerChunk The number of samples in each chunk
+  /// \param checksums Stores a CRC-32 of the samples in each chunk if true
+  /// \returns True if the file was created
+  bool createFile(const std::string&    filename,
+                  const IFSampleHeader& header,
+                  const uint64_t&       startTime,
+                  const size_t&         samplesPerChunk = 1 << 20,
+                  const bool&           checksums       = true);
+
+  /// \brief Completes the file header and closes the file
+  ///
+  /// \returns False if the last chunk or the header could not be written
+  bool closeFile();
+
+  /// \brief Returns true if a file is open
+  bool isOpen() const { return fileDescriptor_ >= 0; }
+
+  /// \brief Appends samples to the capture
+  ///
+  /// \param samples The samples to write
+  /// \param numSamples The number of samples
+  /// \returns False if a chunk could not be written
+  bool writeSamples(const samp_type* samples, const size_t& numSamples);
+
+  /// \brief Appends samples with a known time to the capture
+  ///
+  /// Chunks starting after the first of these samples are timed from the
+  /// provided time, so timestamps from the receiver correct any drift
+  /// between the nominal and the actual sampling frequency.
+  ///
+  /// \param samples The samples to write
+  /// \param numSamples The number of samples
+  /// \param time The time of the first sample [ns]
+  /// \returns False if a chunk could not be written
+  bool writeSamples(const samp_type* samples,
+                    const size_t&    numSamples,
+                    const uint64_t&  time)
+  {
+    anchorTime_   = time;
+    anchorSample_ = numSamples_;
+    return writeSamples(samples, numSamples);
+  }
+
+  /// \brief Returns the number of samples written
+  uint64_t getNumberOfSamples() const { return numSamples_; }
+
+  /// \brief Returns the number of chunks written (including a partial one)
+  uint64_t getNumberOfChunks() const { return numChunks_ + (staged_ > 0); }
+
+  void setLogHandler(const logutils::LogCallback& log) { log_ = log; }
+
+private:
+  // Completes the staged chunk header and writes the chunk
+  bool flushChunk();
+
+  // Writes a buffer at an offset, retrying short writes
+  bool writeAt(const void* data, size_t numBytes, off_t offset);
+
+  // Returns the sample array of the staged chunk
+  samp_type* stagedSamples() const
+  {
+    return reinterpret_cast<samp_type*>(chunk_ + sizeof(IFCaptureChunkHeader));
+  }
+
+  int                 fileDescriptor_;
+  std::string         filename_;
+  IFCaptureFileHeader header_;
+  uint8_t*            chunk_;
+  size_t              staged_;
+  uint64_t            numSamples_;
+  uint64_t            numChunks_;
+  uint64_t            anchorTime_;
+  uint64_t            anchorSample_;
+
+  // local storage of the log callback
+  logutils::LogCallback log_;
+};
+
+template <class samp_type>
+bool IFCaptureWriter<samp_type>::createFile(const std::string&    filename,
+                                            const IFSampleHeader& header,
+                                            const uint64_t&       startTime,
+                                            const size_t& samplesPerChunk,
+                                            const bool&   checksums)
+{
+  closeFile();
+
+  if ((samplesPerChunk == 0) || (header.fs_ <= 0))
+  {
+    log_("Capture files need a sampling frequency and a chunk size",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  std::memset(&header_, 0, sizeof(header_));
+  std::memcpy(header_.magic, ifCaptureMagic, sizeof(ifCaptureMagic));
+  header_.version          = ifCaptureVersion;
+  header_.headerBytes      = ifCaptureAlignment;
+  header_.sampleType       = (uint8_t)IFSampleTraits<samp_type>::type;
+  header_.complex          = 1;
+  header_.bytesPerSample   = sizeof(samp_type);
+  header_.flags            = checksums ? ifCaptureChecksumFlag : 0;
+  header_.samplingFreq     = header.fs_;
+  header_.intermediateFreq = header.if_;
+  header_.startTime        = startTime;
+  header_.samplesPerChunk  = samplesPerChunk;
+
+  // every chunk starts on an alignment boundary
+  const size_t usedBytes =
+    sizeof(IFCaptureChunkHeader) + samplesPerChunk * sizeof(samp_type);
+  header_.chunkBytes = (usedBytes + ifCaptureAlignment - 1) /
+                       ifCaptureAlignment * ifCaptureAlignment;
+
+  void* buffer = nullptr;
+  if (posix_memalign(&buffer, ifCaptureAlignment, header_.chunkBytes) != 0)
+  {
+    log_("Unable to allocate the capture chunk buffer",
+         logutils::LogLevel::Error);
+    return false;
+  }
+  chunk_ = static_cast<uint8_t*>(buffer);
+  std::memset(chunk_, 0, header_.chunkBytes);
+
+  fileDescriptor_ = open(filename.c_str(),
+                         O_WRONLY | O_CREAT | O_TRUNC,
+                         S_IRWXU | S_IRWXG | S_IRWXO);
+  if (fileDescriptor_ < 0)
+  {
+    std::stringstream errStr;
+    errStr << "File open failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    std::free(chunk_);
+    chunk_ = nullptr;
+    return false;
+  }
+
+  filename_     = filename;
+  staged_       = 0;
+  numSamples_   = 0;
+  numChunks_    = 0;
+  anchorTime_   = startTime;
+  anchorSample_ = 0;
+
+  // the counts are left at zero until the capture is closed
+  if (!writeAt(&header_, sizeof(header_), 0))
+  {
+    closeFile();
+    return false;
+  }
+
+  log_("Successfully opened: " + filename, logutils::LogLevel::Info);
+  return true;
+}
+
+template <class samp_type>
+bool IFCaptureWriter<samp_type>::closeFile()
+{
+  if (!isOpen())
+  {
+    return true;
+  }
+
+  bool success = true;
+  if (staged_ > 0)
+  {
+    success = flushChunk();
+  }
+  if (success)
+  {
+    header_.numSamples = numSamples_;
+    header_.numChunks  = numChunks_;
+    success            = writeAt(&header_, sizeof(header_), 0);
+  }
+
+  close(fileDescriptor_);
+  fileDescriptor_ = -1;
+  std::free(chunk_);
+  chunk_ = nullptr;
+
+  if (success)
+  {
+    std::stringstream msg;
+    msg << "File closed: " << filename_ << " (" << numSamples_
+        << " samples in " << numChunks_ << " chunks)";
+    log_(msg.str(), logutils::LogLevel::Info);
+  }
+  return success;
+}
+
+template <class samp_type>
+bool IFCaptureWriter<samp_type>::writeSamples(const samp_type* samples,
+                                              const size_t&    numSamples)
+{
+  if (!isOpen())
+  {
+    log_("No capture file open for writing", logutils::LogLevel::Error);
+    return false;
+  }
+
+  const size_t samplesPerChunk = header_.samplesPerChunk;
+  size_t       written         = 0;
+  while (written < numSamples)
+  {
+    if (staged_ == 0)
+    {
+      // a chunk is timed from its first sample
+      IFCaptureChunkHeader* chunkHeader =
+        reinterpret_cast<IFCaptureChunkHeader*>(chunk_);
+      const double offset =
+        (double)(numSamples_ - anchorSample_) / header_.samplingFreq;
+      chunkHeader->time        = anchorTime_ + (uint64_t)llround(offset * 1e9);
+      chunkHeader->firstSample = numSamples_;
+    }
+
+    size_t count = samplesPerChunk - staged_;
+    if (count > numSamples - written)
+    {
+      count = numSamples - written;
+    }
+    std::memcpy(
+      stagedSamples() + staged_, samples + written, count * sizeof(samp_type));
+    staged_ += count;
+    written += count;
+    numSamples_ += count;
+
+    if ((staged_ == samplesPerChunk) && (!flushChunk()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class samp_type>
+bool IFCaptureWriter<samp_type>::flushChunk()
+{
+  IFCaptureChunkHeader* chunkHeader =
+    reinterpret_cast<IFCaptureChunkHeader*>(chunk_);
+  std::memcpy(chunkHeader->sync, ifCaptureChunkSync, sizeof(chunkHeader->sync));
+  chunkHeader->chunkIndex = numChunks_;
+  chunkHeader->numSamples = staged_;
+  chunkHeader->checksum =
+    (header_.flags & ifCaptureChecksumFlag)
+      ? computeCrc32(stagedSamples(), staged_ * sizeof(samp_type))
+      : 0;
+
+  // full chunks are written with their padding, the last one without
+  const size_t numBytes =
+    (staged_ == header_.samplesPerChunk)
+      ? (size_t)header_.chunkBytes
+      : sizeof(IFCaptureChunkHeader) + staged_ * sizeof(samp_type);
+  const off_t offset =
+    (off_t)(header_.headerBytes + numChunks_ * header_.chunkBytes);
+  if (!writeAt(chunk_, numBytes, offset))
+  {
+    return false;
+  }
+
+  ++numChunks_;
+  staged_ = 0;
+  return true;
+}
+
+template <class samp_type>
+bool IFCaptureWriter<samp_type>::writeAt(const void* data,
+                                         size_t      numBytes,
+                                         off_t       offset)
+{
+  const char* bytes = static_cast<const char*>(data);
+  while (numBytes > 0)
+  {
+    ssize_t result = pwrite(fileDescriptor_, bytes, numBytes, offset);
+    if (result < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      std::stringstream errStr;
+      errStr << "Write to " << filename_ << " failed (" << strerror(errno)
+             << ")";
+      log_(errStr.str(), logutils::LogLevel::Error);
+      return false;
+    }
+    bytes += result;
+    numBytes -= result;
+    offset += result;
+  }
+  return true;
+}
+
+}  // namespace if_data_utils
+#endif
+#endif
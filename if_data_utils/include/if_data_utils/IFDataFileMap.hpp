@@ -0,0 +1,317 @@
+//============================================================================//
+//-------------------- if_data_utils/IFDataFileMap.hpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the IFDataFileMap class.
+/// \details  Memory-mapped, zero-copy access to recorded IF sample files
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__IF_DATA_FILE_MAP_HPP
+#define IF_DATA_UTILS__IF_DATA_FILE_MAP_HPP
+
+// only define the file functions on unix platforms
+// this effectively renders the class useless on a win platform
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "logutils/logutils.hpp"
+
+namespace if_data_utils
+{
+/// \brief A class object for reading IF data files through a memory mapping
+///
+/// The whole file is mapped read-only and samples are returned as pointers
+/// into the mapping, so no data is copied on the way to the caller. Pages are
+/// faulted in by the kernel on first access; the mapping is advised for
+/// sequential access (aggressive read-ahead) and, where supported, for
+/// transparent huge pages.
+///
+/// Samples can be read sequentially from an internal cursor with
+/// readSamples(), or accessed at any sample index with getSamples(). The
+/// returned pointers are valid until the file is closed.
+template <typename samp_type>
+class IFDataFileMap
+{
+public:
+  /// \brief Constructor for the file map class
+  ///
+  /// \param log The provided log callback function
+  IFDataFileMap(const logutils::LogCallback& log = logutils::printLogToStdOut)
+    : mapping_(nullptr)
+    , mappingSize_(0)
+    , samples_(nullptr)
+    , numSamples_(0)
+    , cursor_(0)
+    , log_(log)
+  {
+  }
+
+  ~IFDataFileMap() { closeFile(); }
+
+  IFDataFileMap(const IFDataFileMap&) = delete;
+  IFDataFileMap& operator=(const IFDataFileMap&) = delete;
+
+  /// \brief Maps the provided file
+  ///
+  /// \param filename The file to map
+  /// \param headerBytes The number of bytes before the first sample
+  /// \returns True if the file was mapped
+  bool openFile(const std::string& filename, const size_t& headerBytes = 0);
+
+  /// \brief Unmaps the current file (invalidates all sample pointers)
+  void closeFile();
+
+  /// \brief Returns true if a file is mapped
+  bool isOpen() const { return mapping_ != nullptr; }
+
+  /// \brief Returns the number of whole samples in the file
+  size_t getNumberOfSamples() const { return numSamples_; }
+
+  /// \brief Returns a pointer to the first sample in the file
+  const samp_type* getData() const { return samples_; }
+
+  /// \brief Returns a pointer to a range of samples
+  ///
+  /// \param index The index of the first sample
+  /// \param count The number of samples in the range
+  /// \returns A pointer to the first sample, or nullptr if the range extends
+  ///          past the end of the file
+  const samp_type* getSamples(const size_t& index, const size_t& count) const
+  {
+    if ((index > numSamples_) || (count > numSamples_ - index))
+    {
+      return nullptr;
+    }
+    return samples_ + index;
+  }
+
+  /// \brief Returns the next samples from the cursor and advances it
+  ///
+  /// \param samples Set to the first sample of the block
+  /// \param count The number of samples to read
+  /// \returns False (and leaves the cursor in place) if fewer than count
+  ///          samples remain
+  bool readSamples(const samp_type*& samples, const size_t& count);
+
+  /// \brief Returns the sample index of the cursor
+  size_t tell() const { return cursor_; }
+
+  /// \brief Moves the cursor to the provided sample index
+  ///
+  /// \returns False if the index is past the end of the file
+  bool seek(const size_t& index)
+  {
+    if (index > numSamples_)
+    {
+      return false;
+    }
+    cursor_ = index;
+    return true;
+  }
+
+  /// \brief Advances the cursor by the provided number of samples
+  ///
+  /// \returns False if the new position is past the end of the file
+  bool skip(const size_t& count) { return seek(cursor_ + count); }
+
+  /// \brief Asks the kernel to start reading a range of samples
+  ///
+  /// Use this ahead of random access; sequential reads are read ahead
+  /// automatically.
+  void prefetch(const size_t& index, const size_t& count) const
+  {
+    advise(index, count, MADV_WILLNEED);
+  }
+
+  /// \brief Releases the pages holding a range of already used samples
+  ///
+  /// The data stays in the page cache, but no longer counts towards the
+  /// resident size of the process. Pointers into the range remain valid.
+  void release(const size_t& index, const size_t& count) const
+  {
+    advise(index, count, MADV_DONTNEED);
+  }
+
+  void setLogHandler(const logutils::LogCallback& log) { log_ = log; }
+
+private:
+  // Applies the advice to the whole pages covering a range of samples
+  void advise(const size_t& index, const size_t& count, int advice) const;
+
+  void*            mapping_;
+  size_t           mappingSize_;
+  const samp_type* samples_;
+  size_t           numSamples_;
+  size_t           cursor_;
+
+  // local storage of the log callback
+  logutils::LogCallback log_;
+};
+
+template <class samp_type>
+bool IFDataFileMap<samp_type>::openFile(const std::string& filename,
+                                        const size_t&      headerBytes)
+{
+  closeFile();
+
+  if (headerBytes % alignof(samp_type) != 0)
+  {
+    std::stringstream errStr;
+    errStr << "Header size " << headerBytes << " leaves the samples of "
+           << filename << " misaligned";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+
+  int fileDescriptor = open(filename.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+  {
+    std::stringstream errStr;
+    errStr << "File open failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+
+  struct stat fileStat;
+  if ((fstat(fileDescriptor, &fileStat) != 0) ||
+      ((size_t)fileStat.st_size <= headerBytes))
+  {
+    std::stringstream errStr;
+    errStr << "File " << filename << " holds no samples";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    close(fileDescriptor);
+    return false;
+  }
+
+  void* mapping = mmap(
+    nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  // the mapping holds its own reference to the file
+  close(fileDescriptor);
+  if (mapping == MAP_FAILED)
+  {
+    std::stringstream errStr;
+    errStr << "File map failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+
+  mapping_     = mapping;
+  mappingSize_ = fileStat.st_size;
+  samples_ =
+    reinterpret_cast<const samp_type*>((const char*)mapping + headerBytes);
+  numSamples_ = (mappingSize_ - headerBytes) / sizeof(samp_type);
+  cursor_     = 0;
+
+  // advice is only a hint, so failures are ignored
+  madvise(mapping_, mappingSize_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+  madvise(mapping_, mappingSize_, MADV_HUGEPAGE);
+#endif
+
+  std::stringstream msg;
+  msg << "Successfully mapped: " << filename << " (" << numSamples_
+      << " samples)";
+  if ((mappingSize_ - headerBytes) % sizeof(samp_type) != 0)
+  {
+    msg << ", ignoring a trailing partial sample";
+  }
+  log_(msg.str(), logutils::LogLevel::Info);
+  return true;
+}
+
+template <class samp_type>
+void IFDataFileMap<samp_type>::closeFile()
+{
+  if (mapping_)
+  {
+    munmap(mapping_, mappingSize_);
+    log_("File closed.", logutils::LogLevel::Info);
+  }
+  mapping_     = nullptr;
+  mappingSize_ = 0;
+  samples_     = nullptr;
+  numSamples_  = 0;
+  cursor_      = 0;
+}
+
+template <class samp_type>
+bool IFDataFileMap<samp_type>::readSamples(const samp_type*& samples,
+                                           const size_t&     count)
+{
+  const samp_type* block = getSamples(cursor_, count);
+  if (!block)
+  {
+    return false;
+  }
+  samples = block;
+  cursor_ += count;
+  return true;
+}
+
+template <class samp_type>
+void IFDataFileMap<samp_type>::advise(const size_t& index,
+                                      const size_t& count,
+                                      int           advice) const
+{
+  if ((!mapping_) || (index >= numSamples_))
+  {
+    return;
+  }
+  const size_t available = numSamples_ - index;
+
+  // madvise() requires a page aligned start address
+  const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  const size_t begin =
+    (const char*)(samples_ + index) - (const char*)mapping_;
+  const size_t end =
+    begin + ((count < available) ? count : available) * sizeof(samp_type);
+  const size_t alignedBegin = begin - (begin % pageSize);
+
+  madvise((char*)mapping_ + alignedBegin, end - alignedBegin, advice);
+}
+
+}  // namespace if_data_utils
+#endif
+#endif
@@ -0,0 +1,285 @@
+//============================================================================//
+//---------------- if_data_utils/IFDataFilePrefetcher.hpp ------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the IFDataFilePrefetcher
+///           class.
+/// \details  Hands out IF sample blocks read ahead from a file
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS__IF_DATA_FILE_PREFETCHER_HPP
+#define IF_DATA_UTILS__IF_DATA_FILE_PREFETCHER_HPP
+
+// only define the file functions on unix platforms
+// this effectively renders the class useless on a win platform
+#ifndef _WIN32
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "if_data_utils/AsyncBlockReader.hpp"
+#include "if_data_utils/IFSampleData.hpp"
+#include "logutils/logutils.hpp"
+
+namespace if_data_utils
+{
+/// \brief A class object for reading IF data files ahead of their use
+///
+/// The prefetcher owns a pool of IFSampleData blocks. Reads of the next
+/// blocks of the file are kept in flight (see AsyncBlockReader) so that the
+/// file I/O overlaps with the processing of the blocks already handed out.
+/// getBlock() returns the next filled block, which must be handed back with
+/// releaseBlock() once it has been processed; its storage is then reused for
+/// a later read. The pool is allocated in the constructor, so no buffers are
+/// allocated while reading.
+template <typename samp_type>
+class IFDataFilePrefetcher
+{
+public:
+  /// \brief Constructor for the prefetcher class
+  ///
+  /// \param blockHeader The header of each block (numSamples_ is the number
+  ///                    of samples per block)
+  /// \param queueDepth The number of block reads kept in flight
+  /// \param numUserBlocks The number of blocks the caller may hold at once
+  /// \param log The provided log callback function
+  IFDataFilePrefetcher(
+    const IFSampleHeader&        blockHeader,
+    const size_t&                queueDepth    = 8,
+    const size_t&                numUserBlocks = 2,
+    const logutils::LogCallback& log           = logutils::printLogToStdOut);
+
+  ~IFDataFilePrefetcher() { closeFile(); }
+
+  /// \brief Opens a file and starts reading ahead
+  ///
+  /// \param filename The file to read
+  /// \param backend The I/O mechanism to use
+  /// \param headerBytes The number of bytes before the first sample
+  /// \returns True if the file was opened
+  bool openFile(const std::string&               filename,
+                const AsyncBlockReader::Backend& backend =
+                  AsyncBlockReader::Backend::Auto,
+                const size_t& headerBytes = 0);
+
+  /// \brief Closes the file (blocks held by the caller remain valid)
+  void closeFile();
+
+  /// \brief Returns the next block of samples
+  ///
+  /// Waits for the block if its read has not completed. The last block of a
+  /// file may hold fewer samples than the others.
+  ///
+  /// \returns The block, or nullptr at the end of the file or on error
+  IFSampleData<samp_type>* getBlock();
+
+  /// \brief Returns a block obtained from getBlock() to the pool
+  ///
+  /// \param block The block to release
+  void releaseBlock(IFSampleData<samp_type>* block);
+
+  /// \brief Returns the I/O mechanism in use
+  AsyncBlockReader::Backend getBackend() const { return reader_.getBackend(); }
+
+  /// \brief Returns the sustained read rate since the file was opened (MB/s)
+  double getThroughput() const { return reader_.getThroughput(); }
+
+  /// \brief Returns the number of block reads currently in flight
+  size_t getQueueDepth() const { return reader_.getQueueDepth(); }
+
+  /// \brief Returns the mean number of block reads in flight when a block
+  /// was requested (near zero when processing is waiting on the file)
+  double getAverageQueueDepth() const
+  {
+    return reader_.getAverageQueueDepth();
+  }
+
+  void setLogHandler(const logutils::LogCallback& log)
+  {
+    log_ = log;
+    reader_.setLogHandler(log);
+  }
+
+private:
+  // Starts reads into the free blocks until the queue is full
+  void fillQueue();
+
+  // Removes the oldest block from the in flight ring
+  IFSampleData<samp_type>* popInFlight()
+  {
+    IFSampleData<samp_type>* block = inFlight_[inFlightHead_];
+    inFlightHead_ = (inFlightHead_ + 1) % inFlight_.size();
+    return block;
+  }
+
+  IFSampleHeader blockHeader_;
+  size_t         blockBytes_;
+
+  std::vector<std::unique_ptr<IFSampleData<samp_type>>> pool_;
+  std::vector<IFSampleData<samp_type>*>                 freeBlocks_;
+
+  // blocks with a read in flight, in submission order (the reader tracks
+  // the count)
+  std::vector<IFSampleData<samp_type>*> inFlight_;
+  size_t                                inFlightHead_;
+
+  AsyncBlockReader reader_;
+
+  // local storage of the log callback
+  logutils::LogCallback log_;
+};
+
+template <typename samp_type>
+IFDataFilePrefetcher<samp_type>::IFDataFilePrefetcher(
+  const IFSampleHeader&        blockHeader,
+  const size_t&                queueDepth,
+  const size_t&                numUserBlocks,
+  const logutils::LogCallback& log)
+  : blockHeader_(blockHeader)
+  , blockBytes_(blockHeader.numSamples_ * sizeof(samp_type))
+  , inFlight_(queueDepth, nullptr)
+  , inFlightHead_(0)
+  , reader_(log)
+  , log_(log)
+{
+  for (size_t ii = 0; ii < queueDepth + numUserBlocks; ++ii)
+  {
+    pool_.emplace_back(new IFSampleData<samp_type>(blockHeader_));
+    freeBlocks_.push_back(pool_.back().get());
+  }
+
+  std::stringstream sizeMsg;
+  sizeMsg << "Prefetching " << queueDepth << " blocks of "
+          << blockHeader_.numSamples_ << " samples ("
+          << pool_.size() * blockBytes_ << " bytes in the pool)";
+  log_(sizeMsg.str(), logutils::LogLevel::Info);
+}
+
+template <typename samp_type>
+bool IFDataFilePrefetcher<samp_type>::openFile(
+  const std::string&               filename,
+  const AsyncBlockReader::Backend& backend,
+  const size_t&                    headerBytes)
+{
+  closeFile();
+
+  if (!reader_.open(
+        filename, blockBytes_, inFlight_.size(), backend, headerBytes))
+  {
+    return false;
+  }
+  inFlightHead_ = 0;
+  fillQueue();
+  return true;
+}
+
+template <typename samp_type>
+void IFDataFilePrefetcher<samp_type>::closeFile()
+{
+  // finish the outstanding reads and return their blocks to the pool
+  void* buffer;
+  while (reader_.getQueueDepth() > 0)
+  {
+    reader_.wait(buffer);
+    freeBlocks_.push_back(popInFlight());
+  }
+  reader_.close();
+}
+
+template <typename samp_type>
+IFSampleData<samp_type>* IFDataFilePrefetcher<samp_type>::getBlock()
+{
+  fillQueue();
+  if (reader_.getQueueDepth() == 0)
+  {
+    return nullptr;
+  }
+
+  void*                    buffer;
+  ssize_t                  bytesRead = reader_.wait(buffer);
+  IFSampleData<samp_type>* block     = popInFlight();
+  if (bytesRead < (ssize_t)sizeof(samp_type))
+  {
+    freeBlocks_.push_back(block);
+    return nullptr;
+  }
+
+  if ((size_t)bytesRead < blockBytes_)
+  {
+    // the last block of the file (shrinking keeps the storage)
+    IFSampleHeader lastHeader = blockHeader_;
+    lastHeader.numSamples_    = bytesRead / sizeof(samp_type);
+    block->setHeader(lastHeader);
+  }
+  return block;
+}
+
+template <typename samp_type>
+void IFDataFilePrefetcher<samp_type>::releaseBlock(
+  IFSampleData<samp_type>* block)
+{
+  if (!block)
+  {
+    return;
+  }
+  if (block->getNumberOfSamples() != blockHeader_.numSamples_)
+  {
+    block->setHeader(blockHeader_);
+  }
+  freeBlocks_.push_back(block);
+  fillQueue();
+}
+
+template <typename samp_type>
+void IFDataFilePrefetcher<samp_type>::fillQueue()
+{
+  while ((!freeBlocks_.empty()) &&
+         (reader_.getQueueDepth() < inFlight_.size()))
+  {
+    IFSampleData<samp_type>* block = freeBlocks_.back();
+    if (!reader_.submit(block->getBufferPtr()))
+    {
+      break;
+    }
+    inFlight_[(inFlightHead_ + reader_.getQueueDepth() - 1) %
+              inFlight_.size()] = block;
+    freeBlocks_.pop_back();
+  }
+}
+
+}  // namespace if_data_utils
+#endif
+#endif
@@ -48,18 +48,26 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <iostream>
 #include <memory>
 #include <sstream>
 #include <vector>
 
+#include "if_data_utils/IFSampleCodec.hpp"
 #include "logutils/logutils.hpp"
 
 namespace if_data_utils
 {
 using read_element = std::vector<char>;
 
-/// \brief A class object for writing IF data to files
+/// \brief A class object for reading IF data from files
+///
+/// Files written with compression by IFDataFileWriter are recognized when
+/// they are opened and decoded a block at a time, so the samples read (and
+/// the bytes skipped) are the same as for an uncompressed file.
 template <typename samp_type>
 class IFDataFileReader
 {
@@ -80,12 +88,30 @@ public:
     if (fileDescriptor_)
     {
       close(fileDescriptor_);
+      fileDescriptor_ = 0;
       log_("File closed.", logutils::LogLevel::Info);
     }
+    compressed_   = false;
+    decodedBytes_ = 0;
+    decodedPos_   = 0;
   }
 
+  /// \brief Returns true if the open file holds coded samples
+  bool isCompressed() const { return compressed_; }
+
+  /// \brief Reads one buffer of readBufferSize bytes from the file
+  ///
+  /// \param readBuffer The buffer to fill (resized to the read buffer size)
+  /// \returns True if a full buffer was read
   bool readSamplesFromFile(read_element& readBuffer);
 
+  /// \brief Reads samples from the file into caller-provided storage
+  ///
+  /// \param samples The storage to fill
+  /// \param numSamples The number of samples to read
+  /// \returns True if all of the samples were read
+  bool readSamplesFromFile(samp_type* samples, const size_t& numSamples);
+
   size_t getReadBufferSize() { return readBufferSize_; };
 
   bool skip(const size_t& bytesToSkip)
@@ -97,6 +123,11 @@ public:
       return false;
     }
 
+    if (compressed_)
+    {
+      return skipDecoded(bytesToSkip);
+    }
+
     if (lseek(fileDescriptor_, bytesToSkip, SEEK_CUR) >= 0)
     {
       return true;
@@ -113,10 +144,36 @@ public:
   void setReadBufferSize(const size_t& buffSize) { readBufferSize_ = buffSize; }
 
 private:
+  // Fills the provided buffer from the file
+  bool readBytes(void* buffer, const size_t& numBytes);
+
+  // Reads up to numBytes from the file, returning the number read
+  size_t readFromFile(void* buffer, const size_t& numBytes);
+
+  // Fills the provided buffer from the decoded blocks of a coded file
+  size_t readDecoded(void* buffer, const size_t& numBytes);
+
+  // Skips decoded bytes, passing over whole blocks without decoding them
+  bool skipDecoded(size_t numBytes);
+
+  // Reads and checks the header of the next block of a coded file
+  bool readBlockHeader(IFCodecBlockHeader& header);
+
+  // Reads and decodes the block following the provided header
+  bool decodeBlock(const IFCodecBlockHeader& header);
+
   ssize_t readBufferSize_;
 
   int fileDescriptor_;
 
+  // decoding state of a coded file
+  bool                 compressed_;
+  size_t               valueBytes_;
+  std::vector<uint8_t> encoded_;
+  std::vector<int16_t> decoded_;
+  size_t               decodedBytes_;
+  size_t               decodedPos_;
+
   // local storage of the log callback
   logutils::LogCallback log_;
 };
@@ -124,7 +181,13 @@ private:
 template <typename samp_type>
 IFDataFileReader<samp_type>::IFDataFileReader(const ssize_t& readBufferSize,
                                               const logutils::LogCallback& log)
-  : readBufferSize_(readBufferSize), fileDescriptor_(0) , log_(log)
+  : readBufferSize_(readBufferSize),
+    fileDescriptor_(0),
+    compressed_(false),
+    valueBytes_(0),
+    decodedBytes_(0),
+    decodedPos_(0),
+    log_(log)
 {
   const size_t samps_per_element = readBufferSize / sizeof(samp_type);
   if (readBufferSize % sizeof(samp_type) != 0)
@@ -144,9 +207,11 @@ IFDataFileReader<samp_type>::IFDataFileReader(const ssize_t& readBufferSize,
 template <class samp_type>
 bool IFDataFileReader<samp_type>::openFile(const std::string& filename)
 {
-  if ((fileDescriptor_ = open(filename.c_str(),
-                              O_RDONLY | O_NONBLOCK,
-                              S_IRWXU | S_IRWXG | S_IRWXO)) < 0)
+  closeFile();
+
+  int fileDescriptor =
+    open(filename.c_str(), O_RDONLY, S_IRWXU | S_IRWXG | S_IRWXO);
+  if (fileDescriptor < 0)
   {
     std::stringstream errStr;
     errStr << "File open failed: " << filename.c_str();
@@ -155,8 +220,36 @@ bool IFDataFileReader<samp_type>::openFile(const std::string& filename)
 
     return false;
   }
+  fileDescriptor_ = fileDescriptor;
+
+  // recordings are replayed front to back
+  posix_fadvise(fileDescriptor_, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  // coded files start with a stream header, anything else is raw samples
+  IFCodecStreamHeader header;
+  if ((readFromFile(&header, sizeof(header)) == sizeof(header)) &&
+      (std::memcmp(header.magic, ifCodecMagic, sizeof(ifCodecMagic)) == 0))
+  {
+    if ((header.version != ifCodecVersion) ||
+        ((header.bytesPerValue != 1) && (header.bytesPerValue != 2)))
+    {
+      log_("Unsupported compressed file: " + filename,
+           logutils::LogLevel::Error);
+      closeFile();
+      return false;
+    }
+    compressed_ = true;
+    valueBytes_ = header.bytesPerValue;
+    decoded_.resize(ifCodecBlockValues);
+  }
+  else
+  {
+    lseek(fileDescriptor_, 0, SEEK_SET);
+  }
+
   std::stringstream msg;
-  msg << "Successfully opened: " << filename;
+  msg << "Successfully opened: " << filename
+      << (compressed_ ? " (compressed)" : "");
   log_(msg.str(), logutils::LogLevel::Info);
   return true;
 }
@@ -164,24 +257,188 @@ bool IFDataFileReader<samp_type>::openFile(const std::string& filename)
 template <class samp_type>
 bool IFDataFileReader<samp_type>::readSamplesFromFile(read_element& readBuffer)
 {
-  auto bytes_read =
-    read(fileDescriptor_, (void*)(&readBuffer), readBufferSize_);
+  if (readBufferSize_ < 0)
+  {
+    return false;
+  }
+  readBuffer.resize(readBufferSize_);
+  return readBytes(readBuffer.data(), readBufferSize_);
+}
+
+template <class samp_type>
+bool IFDataFileReader<samp_type>::readSamplesFromFile(
+  samp_type*    samples,
+  const size_t& numSamples)
+{
+  return readBytes(samples, numSamples * sizeof(samp_type));
+}
+
+template <class samp_type>
+bool IFDataFileReader<samp_type>::readBytes(void*         buffer,
+                                            const size_t& numBytes)
+{
+  if (fileDescriptor_ == 0)
+  {
+    log_("IFDataFileReader::readSamplesFromFile(): No file open.",
+         logutils::LogLevel::Error);
+    return false;
+  }
 
-  if (bytes_read != readBufferSize_)
+  size_t totalRead = compressed_ ? readDecoded(buffer, numBytes)
+                                 : readFromFile(buffer, numBytes);
+  if (totalRead != numBytes)
   {
     std::stringstream errStr;
+    errStr << "Read " << totalRead << "/" << numBytes << " bytes";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+  return true;
+}
+
+template <class samp_type>
+size_t IFDataFileReader<samp_type>::readFromFile(void*         buffer,
+                                                 const size_t& numBytes)
+{
+  // read() may return fewer bytes than requested, so keep reading until the
+  // buffer is full or the end of the file is reached
+  size_t totalRead = 0;
+  while (totalRead < numBytes)
+  {
+    auto bytes_read = read(
+      fileDescriptor_, (char*)buffer + totalRead, numBytes - totalRead);
     if (bytes_read < 0)
     {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      std::stringstream errStr;
       errStr << "Problem reading: " << strerror(errno);
+      log_(errStr.str(), logutils::LogLevel::Error);
+      break;
     }
-    else
+    if (bytes_read == 0)
     {
-      errStr << "Read " << bytes_read << "/" << (int)readBufferSize_
-             << " bytes";
+      break;
     }
-    log_(errStr.str(), logutils::LogLevel::Error);
+    totalRead += bytes_read;
+  }
+  return totalRead;
+}
+
+template <class samp_type>
+size_t IFDataFileReader<samp_type>::readDecoded(void*         buffer,
+                                                const size_t& numBytes)
+{
+  const uint8_t* decoded   = reinterpret_cast<const uint8_t*>(decoded_.data());
+  size_t         totalRead = 0;
+  while (totalRead < numBytes)
+  {
+    if (decodedPos_ == decodedBytes_)
+    {
+      IFCodecBlockHeader header;
+      if (!readBlockHeader(header) || !decodeBlock(header))
+      {
+        break;
+      }
+    }
+    size_t count = std::min(numBytes - totalRead, decodedBytes_ - decodedPos_);
+    std::memcpy((char*)buffer + totalRead, decoded + decodedPos_, count);
+    decodedPos_ += count;
+    totalRead += count;
+  }
+  return totalRead;
+}
+
+template <class samp_type>
+bool IFDataFileReader<samp_type>::skipDecoded(size_t numBytes)
+{
+  size_t count = std::min(numBytes, decodedBytes_ - decodedPos_);
+  decodedPos_ += count;
+  numBytes -= count;
+
+  while (numBytes > 0)
+  {
+    IFCodecBlockHeader header;
+    if (!readBlockHeader(header))
+    {
+      return false;
+    }
+    const size_t blockBytes = header.numValues * valueBytes_;
+    if (blockBytes > numBytes)
+    {
+      // the skip ends inside this block
+      if (!decodeBlock(header))
+      {
+        return false;
+      }
+      decodedPos_ = numBytes;
+      return true;
+    }
+    if (lseek(fileDescriptor_, header.numBytes, SEEK_CUR) < 0)
+    {
+      return false;
+    }
+    numBytes -= blockBytes;
+  }
+  return true;
+}
+
+template <class samp_type>
+bool IFDataFileReader<samp_type>::readBlockHeader(IFCodecBlockHeader& header)
+{
+  const size_t headerBytes = readFromFile(&header, sizeof(header));
+  if (headerBytes == 0)
+  {
+    // the end of the file
+    return false;
+  }
+  if ((headerBytes != sizeof(header)) ||
+      (header.numValues > ifCodecBlockValues) ||
+      (header.numBytes > maxEncodedBytes(header.numValues, valueBytes_)))
+  {
+    log_("IFDataFileReader: Corrupt compressed block",
+         logutils::LogLevel::Error);
+    return false;
+  }
+  return true;
+}
+
+template <class samp_type>
+bool IFDataFileReader<samp_type>::decodeBlock(
+  const IFCodecBlockHeader& header)
+{
+  decodedBytes_ = 0;
+  decodedPos_   = 0;
+
+  encoded_.resize(header.numBytes);
+  if (readFromFile(encoded_.data(), header.numBytes) != header.numBytes)
+  {
+    log_("IFDataFileReader: Truncated compressed block",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  size_t used;
+  if (valueBytes_ == 1)
+  {
+    used = decodeValues(encoded_.data(), header.numBytes,
+                        reinterpret_cast<int8_t*>(decoded_.data()),
+                        header.numValues);
+  }
+  else
+  {
+    used = decodeValues(encoded_.data(), header.numBytes, decoded_.data(),
+                        header.numValues);
+  }
+  if (used != header.numBytes)
+  {
+    log_("IFDataFileReader: Corrupt compressed block",
+         logutils::LogLevel::Error);
     return false;
   }
+  decodedBytes_ = header.numValues * valueBytes_;
   return true;
 }
 
@@ -48,11 +48,20 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
+#include "if_data_utils/IFSampleCodec.hpp"
+#include "if_data_utils/IfData.hpp"
 #include "logutils/logutils.hpp"
 
 namespace if_data_utils
@@ -60,6 +69,15 @@ namespace if_data_utils
 using write_element = std::vector<char>;
 
 /// \brief A class object for writing IF data to files
+///
+/// Samples are gathered into a staging block of writeBufferSize bytes and
+/// written a block at a time. The file can optionally bypass the page cache
+/// (O_DIRECT, where supported), and the blocks can optionally be written by
+/// a worker thread so that filling one block overlaps writing the other.
+///
+/// With compression, the sample components are coded with the IF sample
+/// codec a block of ifCodecBlockValues at a time before they are staged;
+/// IFDataFileReader recognizes coded files and restores the samples.
 template <typename samp_type>
 class IFDataFileWriter
 {
@@ -71,15 +89,93 @@ public:
     const ssize_t&                writeBufferSize = 4096,
     const logutils::LogCallback& log             = logutils::printLogToStdOut);
 
-  bool createFile(const std::string& filename);
+  ~IFDataFileWriter() { closeFile(); }
+
+  IFDataFileWriter(const IFDataFileWriter&) = delete;
+  IFDataFileWriter& operator=(const IFDataFileWriter&) = delete;
+
+  /// \brief Creates (or truncates) a file for writing
+  ///
+  /// \param filename The file to write
+  /// \param directIO True to bypass the page cache
+  /// \param async True to write blocks from a worker thread
+  /// \param compression The coding of the samples (8 and 16-bit sample
+  ///                    components only)
+  /// \returns True if the file was created
+  bool createFile(const std::string&   filename,
+                  const bool&          directIO    = false,
+                  const bool&          async       = false,
+                  const IFCompression& compression = IFCompression::None);
+
+  /// \brief Writes any staged samples and closes the file
+  ///
+  /// \returns False if any write to the file failed
+  bool closeFile();
 
   size_t getWriteBufferSize() { return writeBufferSize_; };
 
+  /// \brief Writes the contents of a buffer element to the file
   bool writeSamplesToFile(const write_element& writeBuffer);
 
+  /// \brief Writes samples from caller-provided storage to the file
+  ///
+  /// \param samples The samples to write
+  /// \param numSamples The number of samples to write
+  /// \returns False if a write to the file failed
+  bool writeSamplesToFile(const samp_type* samples, const size_t& numSamples);
+
+  /// \brief Narrows 32-bit values to their low bytes and writes them
+  ///
+  /// The values are narrowed straight into the staging block, so no
+  /// intermediate copy is made.
+  ///
+  /// \param values The values to write
+  /// \param numValues The number of values
+  /// \param bytesPerValue The bytes written for each value
+  /// \returns False if a write to the file failed
+  bool writeNarrowedToFile(const int32_t* values,
+                           const size_t&  numValues,
+                           const size_t&  bytesPerValue);
+
+  /// \brief Returns the number of bytes accepted since the file was created
+  ///
+  /// For coded files this is the size of the samples before coding.
   size_t getTotalBytesWritten() { return totalBytesWritten_; };
 
+  /// \brief Returns true if the file bypasses the page cache
+  bool isDirectIO() const { return directIO_; }
+
+  void setLogHandler(const logutils::LogCallback& log) { log_ = log; }
+
 private:
+  // O_DIRECT transfers must be aligned to the device block size
+  static const size_t directAlignment = 4096;
+
+  struct FreeDeleter
+  {
+    void operator()(uint8_t* ptr) const { free(ptr); }
+  };
+
+  // Accepts sample bytes, coding them first if the file is compressed
+  bool appendBytes(const uint8_t* bytes, size_t numBytes);
+
+  // Copies bytes into the staging block, writing each block as it fills
+  bool stageBytes(const uint8_t* bytes, size_t numBytes);
+
+  // Codes the gathered values and stages them as one block
+  bool encodeBlock();
+
+  // Writes the filled part of the active block and starts on the other one
+  bool submitBlock();
+
+  // Waits until the worker has written the block it was given
+  void waitForWorker();
+
+  // Writes a buffer to the file, continuing after short writes
+  bool writeBytes(const uint8_t* buffer, size_t numBytes);
+
+  void workerLoop();
+
   ssize_t writeBufferSize_;
 
   int fileDescriptor_;
@@ -88,12 +184,53 @@ private:
   logutils::LogCallback log_;
 
   size_t totalBytesWritten_;
+
+  bool directIO_;
+  bool async_;
+
+  // staging blocks, alternated when writing asynchronously
+  std::unique_ptr<uint8_t, FreeDeleter> blocks_[2];
+  size_t                                blockBytes_;
+  size_t                                active_;
+  size_t                                fill_;
+
+  // worker state (one block may be pending at a time)
+  std::thread             worker_;
+  std::mutex              workerMutex_;
+  std::condition_variable workerCondition_;
+  size_t                  pendingBlock_;
+  size_t                  pendingBytes_;
+  bool                    writeFailed_;
+  bool                    stopWorker_;
+
+  // coding state; values are gathered as int16_t so that either width can
+  // be read from them
+  IFCompression        compression_;
+  std::vector<int16_t> codecValues_;
+  size_t               codecBytes_;
+  size_t               codecFill_;
+  std::vector<uint8_t> encoded_;
 };
 
 template <typename samp_type>
 IFDataFileWriter<samp_type>::IFDataFileWriter(const ssize_t& writeBufferSize,
                                               const logutils::LogCallback& log)
-  : writeBufferSize_(writeBufferSize), log_(log), totalBytesWritten_(0)
+  : writeBufferSize_(writeBufferSize),
+    fileDescriptor_(0),
+    log_(log),
+    totalBytesWritten_(0),
+    directIO_(false),
+    async_(false),
+    blockBytes_(0),
+    active_(0),
+    fill_(0),
+    pendingBlock_(0),
+    pendingBytes_(0),
+    writeFailed_(false),
+    stopWorker_(false),
+    compression_(IFCompression::None),
+    codecBytes_(0),
+    codecFill_(0)
 {
   const size_t samps_per_element = writeBufferSize / sizeof(samp_type);
   if (writeBufferSize % sizeof(samp_type) != 0)
@@ -111,11 +248,65 @@ IFDataFileWriter<samp_type>::IFDataFileWriter(const ssize_t& writeBufferSize,
 }
 
 template <class samp_type>
-bool IFDataFileWriter<samp_type>::createFile(const std::string& filename)
+bool IFDataFileWriter<samp_type>::createFile(
+  const std::string&   filename,
+  const bool&          directIO,
+  const bool&          async,
+  const IFCompression& compression)
 {
-  if ((fileDescriptor_ = open(filename.c_str(),
-                              O_WRONLY | O_CREAT | O_TRUNC | O_NONBLOCK,
-                              S_IRWXU | S_IRWXG | S_IRWXO)) < 0)
+  closeFile();
+
+  if (writeBufferSize_ <= 0)
+  {
+    log_("IFDataFileWriter::createFile(): Buffer size must be > 0",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  const size_t valueBytes = IFCodecValue<samp_type>::bytes;
+  if ((compression != IFCompression::None) && (valueBytes != 1) &&
+      (valueBytes != 2))
+  {
+    log_("IFDataFileWriter::createFile(): Compression needs 8 or 16-bit "
+         "sample components",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  int flags = O_WRONLY | O_CREAT | O_TRUNC;
+  directIO_ = false;
+  if (directIO)
+  {
+#ifdef O_DIRECT
+    directIO_ = true;
+#else
+    log_("IFDataFileWriter::createFile(): O_DIRECT is not supported, "
+         "writing through the page cache",
+         logutils::LogLevel::Warn);
+#endif
+  }
+
+  int fileDescriptor = -1;
+#ifdef O_DIRECT
+  if (directIO_)
+  {
+    fileDescriptor = open(filename.c_str(), flags | O_DIRECT,
+                          S_IRWXU | S_IRWXG | S_IRWXO);
+    if ((fileDescriptor < 0) && (errno == EINVAL))
+    {
+      log_("IFDataFileWriter::createFile(): File system does not support "
+           "O_DIRECT, writing through the page cache",
+           logutils::LogLevel::Warn);
+      directIO_ = false;
+    }
+  }
+#endif
+  if (!directIO_)
+  {
+    fileDescriptor =
+      open(filename.c_str(), flags, S_IRWXU | S_IRWXG | S_IRWXO);
+  }
+  if (fileDescriptor < 0)
   {
     std::stringstream errStr;
     errStr << "File open failed: " << filename.c_str();
@@ -124,35 +315,382 @@ bool IFDataFileWriter<samp_type>::createFile(const std::string& filename)
 
     return false;
   }
+  fileDescriptor_ = fileDescriptor;
+
+  // direct transfers need whole, aligned device blocks
+  size_t blockBytes = writeBufferSize_;
+  if (directIO_)
+  {
+    blockBytes =
+      (blockBytes + directAlignment - 1) / directAlignment * directAlignment;
+  }
+  size_t numBlocks = async ? 2 : 1;
+  if ((blockBytes != blockBytes_) || !blocks_[numBlocks - 1])
+  {
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+      void* block = nullptr;
+      if ((ii < numBlocks) &&
+          (posix_memalign(&block, directAlignment, blockBytes) != 0))
+      {
+        log_("IFDataFileWriter::createFile(): Staging allocation failed",
+             logutils::LogLevel::Error);
+        closeFile();
+        return false;
+      }
+      blocks_[ii].reset(static_cast<uint8_t*>(block));
+    }
+    blockBytes_ = blockBytes;
+  }
+
+  totalBytesWritten_ = 0;
+  active_            = 0;
+  fill_              = 0;
+  pendingBytes_      = 0;
+  writeFailed_       = false;
+  stopWorker_        = false;
+  async_             = async;
+  if (async_)
+  {
+    worker_ = std::thread(&IFDataFileWriter<samp_type>::workerLoop, this);
+  }
+
+  compression_ = compression;
+  codecFill_   = 0;
+  if (compression_ != IFCompression::None)
+  {
+    codecBytes_ = ifCodecBlockValues * valueBytes;
+    codecValues_.resize(ifCodecBlockValues);
+    encoded_.resize(sizeof(IFCodecBlockHeader) +
+                    maxEncodedBytes(ifCodecBlockValues, valueBytes));
+
+    IFCodecStreamHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, ifCodecMagic, sizeof(ifCodecMagic));
+    header.version       = ifCodecVersion;
+    header.bytesPerValue = (uint8_t)valueBytes;
+    header.compression   = (uint8_t)compression_;
+    stageBytes(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+  }
+
+  std::stringstream msg;
+  msg << "Successfully created: " << filename
+      << (directIO_ ? " (direct I/O)" : "") << (async_ ? " (async)" : "")
+      << ((compression_ != IFCompression::None) ? " (compressed)" : "");
+  log_(msg.str(), logutils::LogLevel::Info);
   return true;
 }
 
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::closeFile()
+{
+  if (fileDescriptor_ == 0)
+  {
+    return true;
+  }
+
+  // code the last (partial) block of values
+  bool encoded = true;
+  if (compression_ != IFCompression::None)
+  {
+    const size_t partial = codecFill_ % IFCodecValue<samp_type>::bytes;
+    if (partial != 0)
+    {
+      log_("IFDataFileWriter::closeFile(): Dropping a partial value at the "
+           "end of a compressed file",
+           logutils::LogLevel::Warn);
+      codecFill_ -= partial;
+    }
+    if (codecFill_ > 0)
+    {
+      encoded = encodeBlock();
+    }
+    compression_ = IFCompression::None;
+  }
+
+  if (async_)
+  {
+    waitForWorker();
+    {
+      std::lock_guard<std::mutex> lock(workerMutex_);
+      stopWorker_ = true;
+    }
+    workerCondition_.notify_all();
+    worker_.join();
+    async_ = false;
+  }
+
+  bool success = encoded && !writeFailed_;
+  if (fill_ > 0)
+  {
+#ifdef O_DIRECT
+    // the last block is partial, so it goes through the page cache
+    if (directIO_)
+    {
+      fcntl(fileDescriptor_, F_SETFL,
+            fcntl(fileDescriptor_, F_GETFL) & ~O_DIRECT);
+    }
+#endif
+    success = writeBytes(blocks_[active_].get(), fill_) && success;
+    fill_   = 0;
+  }
+
+  close(fileDescriptor_);
+  fileDescriptor_ = 0;
+  log_("File closed.", logutils::LogLevel::Info);
+  return success;
+}
+
 template <class samp_type>
 bool IFDataFileWriter<samp_type>::writeSamplesToFile(
   const write_element& writeBuffer)
 {
-  auto bytes_written =
-    write(fileDescriptor_, (void*)(&writeBuffer), writeBufferSize_);
+  return appendBytes(reinterpret_cast<const uint8_t*>(writeBuffer.data()),
+                     writeBuffer.size());
+}
 
-  totalBytesWritten_ += bytes_written;
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::writeSamplesToFile(
+  const samp_type* samples,
+  const size_t&    numSamples)
+{
+  return appendBytes(reinterpret_cast<const uint8_t*>(samples),
+                     numSamples * sizeof(samp_type));
+}
 
-  if (bytes_written != writeBufferSize_)
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::writeNarrowedToFile(
+  const int32_t* values,
+  const size_t&  numValues,
+  const size_t&  bytesPerValue)
+{
+  if (fileDescriptor_ == 0)
   {
-    std::stringstream errStr;
-    if (bytes_written < 0)
+    log_("IFDataFileWriter::writeNarrowedToFile(): No file open.",
+         logutils::LogLevel::Error);
+    return false;
+  }
+  if (bytesPerValue == 0)
+  {
+    return true;
+  }
+
+  bool success = true;
+  if (compression_ != IFCompression::None)
+  {
+    // narrow through a small buffer so the values are coded with the rest
+    uint8_t      narrowed[4096];
+    const size_t chunkValues =
+      std::max<size_t>(sizeof(narrowed) / bytesPerValue, 1);
+    for (size_t written = 0; written < numValues; written += chunkValues)
     {
-      errStr << "Problem writing: " << strerror(errno);
+      const size_t count = std::min(chunkValues, numValues - written);
+      narrowSamples(values + written, count, bytesPerValue, narrowed);
+      success = appendBytes(narrowed, count * bytesPerValue) && success;
     }
-    else
+    return success;
+  }
+
+  size_t written = 0;
+  while (written < numValues)
+  {
+    size_t count =
+      std::min(numValues - written, (blockBytes_ - fill_) / bytesPerValue);
+    if (count == 0)
     {
-      errStr << "Wrote " << bytes_written << "/" << (int)writeBufferSize_
-             << " bytes";
+      // a value straddles the end of the block
+      uint8_t value[sizeof(int32_t) * 2];
+      size_t  valueBytes = std::min(bytesPerValue, sizeof(value));
+      narrowSamples(values + written, 1, valueBytes, value);
+      success = appendBytes(value, valueBytes) && success;
+      ++written;
+      continue;
     }
-    log_(errStr.str(), logutils::LogLevel::Error);
+    narrowSamples(values + written, count, bytesPerValue,
+                  blocks_[active_].get() + fill_);
+    fill_ += count * bytesPerValue;
+    totalBytesWritten_ += count * bytesPerValue;
+    written += count;
+    if (fill_ == blockBytes_)
+    {
+      success = submitBlock() && success;
+    }
+  }
+  return success;
+}
+
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::appendBytes(const uint8_t* bytes,
+                                              size_t         numBytes)
+{
+  if (fileDescriptor_ == 0)
+  {
+    log_("IFDataFileWriter::writeSamplesToFile(): No file open.",
+         logutils::LogLevel::Error);
     return false;
   }
+
+  totalBytesWritten_ += numBytes;
+  if (compression_ == IFCompression::None)
+  {
+    return stageBytes(bytes, numBytes);
+  }
+
+  // values are gathered into a block before they are coded
+  bool     success = true;
+  uint8_t* block   = reinterpret_cast<uint8_t*>(codecValues_.data());
+  while (numBytes > 0)
+  {
+    size_t count = std::min(numBytes, codecBytes_ - codecFill_);
+    std::memcpy(block + codecFill_, bytes, count);
+    codecFill_ += count;
+    bytes += count;
+    numBytes -= count;
+    if (codecFill_ == codecBytes_)
+    {
+      success = encodeBlock() && success;
+    }
+  }
+  return success;
+}
+
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::stageBytes(const uint8_t* bytes,
+                                             size_t         numBytes)
+{
+  bool success = true;
+
+  // whole blocks can go straight from the caller's memory when nothing is
+  // staged and the file has no alignment or lifetime requirements
+  if (!directIO_ && !async_ && (fill_ == 0) && (numBytes >= blockBytes_))
+  {
+    size_t direct = numBytes / blockBytes_ * blockBytes_;
+    success       = writeBytes(bytes, direct);
+    bytes += direct;
+    numBytes -= direct;
+  }
+
+  while (numBytes > 0)
+  {
+    size_t count = std::min(numBytes, blockBytes_ - fill_);
+    std::memcpy(blocks_[active_].get() + fill_, bytes, count);
+    fill_ += count;
+    bytes += count;
+    numBytes -= count;
+    if (fill_ == blockBytes_)
+    {
+      success = submitBlock() && success;
+    }
+  }
+  return success;
+}
+
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::encodeBlock()
+{
+  IFCodecBlockHeader header;
+  header.numValues = (uint32_t)(codecFill_ / IFCodecValue<samp_type>::bytes);
+
+  uint8_t* coded = encoded_.data() + sizeof(header);
+  if (IFCodecValue<samp_type>::bytes == 1)
+  {
+    header.numBytes = (uint32_t)encodeValues(
+      reinterpret_cast<const int8_t*>(codecValues_.data()), header.numValues,
+      compression_, coded);
+  }
+  else
+  {
+    header.numBytes = (uint32_t)encodeValues(
+      codecValues_.data(), header.numValues, compression_, coded);
+  }
+  std::memcpy(encoded_.data(), &header, sizeof(header));
+  codecFill_ = 0;
+  return stageBytes(encoded_.data(), sizeof(header) + header.numBytes);
+}
+
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::submitBlock()
+{
+  if (!async_)
+  {
+    size_t bytes = fill_;
+    fill_        = 0;
+    return writeBytes(blocks_[active_].get(), bytes);
+  }
+
+  bool success = true;
+  {
+    std::unique_lock<std::mutex> lock(workerMutex_);
+    workerCondition_.wait(lock, [this]() { return pendingBytes_ == 0; });
+    pendingBlock_ = active_;
+    pendingBytes_ = fill_;
+    success       = !writeFailed_;
+  }
+  workerCondition_.notify_all();
+
+  active_ ^= 1;
+  fill_ = 0;
+  return success;
+}
+
+template <class samp_type>
+void IFDataFileWriter<samp_type>::waitForWorker()
+{
+  std::unique_lock<std::mutex> lock(workerMutex_);
+  workerCondition_.wait(lock, [this]() { return pendingBytes_ == 0; });
+}
+
+template <class samp_type>
+void IFDataFileWriter<samp_type>::workerLoop()
+{
+  std::unique_lock<std::mutex> lock(workerMutex_);
+  while (true)
+  {
+    workerCondition_.wait(
+      lock, [this]() { return (pendingBytes_ > 0) || stopWorker_; });
+    if (pendingBytes_ == 0)
+    {
+      break;
+    }
+
+    const uint8_t* block = blocks_[pendingBlock_].get();
+    size_t         bytes = pendingBytes_;
+    lock.unlock();
+    bool success = writeBytes(block, bytes);
+    lock.lock();
+
+    writeFailed_  = writeFailed_ || !success;
+    pendingBytes_ = 0;
+    workerCondition_.notify_all();
+  }
+}
+
+template <class samp_type>
+bool IFDataFileWriter<samp_type>::writeBytes(const uint8_t* buffer,
+                                             size_t         numBytes)
+{
+  // write() may accept fewer bytes than requested, so keep writing until
+  // the buffer is on its way to the disk
+  size_t totalWritten = 0;
+  while (totalWritten < numBytes)
+  {
+    auto bytes_written = write(
+      fileDescriptor_, buffer + totalWritten, numBytes - totalWritten);
+    if (bytes_written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      std::stringstream errStr;
+      errStr << "Problem writing: " << strerror(errno);
+      log_(errStr.str(), logutils::LogLevel::Error);
+      return false;
+    }
+    totalWritten += bytes_written;
+  }
   return true;
 }
 }  // end namespace if_data_utils
 #endif
-#endif
\ No newline at end of file
+#endif
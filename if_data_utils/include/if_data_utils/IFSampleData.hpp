@@ -39,7 +39,12 @@
 #ifndef IF_DATA_UTILS__IF_SAMPLE_DATA_HPP
 #define IF_DATA_UTILS__IF_SAMPLE_DATA_HPP
 
+#include <algorithm>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <vector>
 
 namespace if_data_utils
@@ -48,6 +53,11 @@ using SamplesType = std::vector<std::complex<double>>;
 
 using IFSampleSC8  = std::complex<std::int8_t>;
 using IFSampleSC16 = std::complex<std::int16_t>;
+using IFSampleFC32 = std::complex<float>;
+using IFSampleFC64 = std::complex<double>;
+
+/// The alignment of the sample storage owned by IFSampleData [bytes]
+const size_t ifSampleAlignment = 64;
 
 //==============================================================================
 enum class IFSampleType
@@ -88,7 +98,16 @@ struct IFSampleHeader
   /// Set to 0 if > 1
   uint16_t samplesPerByte_;
 
-  IFSampleHeader(){};
+  IFSampleHeader()
+    : numSamples_(0)
+    , sampleType_(IFSampleType::SC8)
+    , fs_(0.0)
+    , if_(0.0)
+    , complex_(false)
+    , bytesPerSample_(0)
+    , samplesPerByte_(0)
+  {
+  }
   /// \brief Sample header constructor
   ///
   /// Constructor for the IF sample hanlder structure. The constructor
@@ -108,83 +127,300 @@ struct IFSampleHeader
     , sampleType_(sampleType)
     , fs_(samplingFreq)
     , if_(intermediateFreq)
+    , complex_(true)
+    , bytesPerSample_(0)
+    , samplesPerByte_(0)
   {
     switch (sampleType_)
     {
       case IFSampleType::SC8:
         bytesPerSample_ = 2;
-        complex_        = true;
         break;
 
       case IFSampleType::SC16:
         bytesPerSample_ = 4;
-        complex_        = true;
         break;
 
-      default:
-        // Throw error message?
+      case IFSampleType::FC32:
+        bytesPerSample_ = 8;
+        break;
+
+      case IFSampleType::FC64:
+        bytesPerSample_ = 16;
         break;
     }
   }
 };
 
+/// \brief Maps a sample type to its IFSampleType
+template <typename samp_type>
+struct IFSampleTraits;
+
+template <>
+struct IFSampleTraits<IFSampleSC8>
+{
+  static const IFSampleType type = IFSampleType::SC8;
+};
+
+template <>
+struct IFSampleTraits<IFSampleSC16>
+{
+  static const IFSampleType type = IFSampleType::SC16;
+};
+
+template <>
+struct IFSampleTraits<IFSampleFC32>
+{
+  static const IFSampleType type = IFSampleType::FC32;
+};
+
+template <>
+struct IFSampleTraits<IFSampleFC64>
+{
+  static const IFSampleType type = IFSampleType::FC64;
+};
+
+/// \brief A set of IF samples and the header describing them
+///
+/// The samples either live in storage owned by the structure, aligned to
+/// ifSampleAlignment, or in external storage adopted with adoptBuffer()
+/// (an SDR driver's DMA ring, a memory-mapped file), in which case no
+/// samples are copied. Owned storage only grows: changing the header to
+/// fewer samples, or adopting a buffer, keeps it for later use, so a
+/// structure reused for blocks of the same size allocates once.
+///
+/// Copies of a structure with owned storage copy the samples; copies of a
+/// structure with adopted storage refer to the same samples and share its
+/// lifetime guard.
 template <typename samp_type>
 class IFSampleData
 {
 public:
   /// \brief Constructor for the sample data structure
-  IFSampleData(){};
+  IFSampleData()
+    : data_(nullptr), readOnly_(false), owned_(nullptr), capacity_(0)
+  {
+  }
 
+  /// \brief Constructs a set of zeroed samples in owned storage
   IFSampleData(const IFSampleHeader& header);
 
-  size_t getNumberOfSamples() const { return data_.size(); }
+  /// \brief Constructs a set of samples in adopted storage
+  ///
+  /// \see adoptBuffer()
+  IFSampleData(const IFSampleHeader&        header,
+               samp_type*                   samples,
+               const std::shared_ptr<void>& guard = nullptr)
+    : IFSampleData()
+  {
+    adoptBuffer(header, samples, guard);
+  }
 
-  size_t getNumberOfBytes() const { return totalNumBytes_; }
+  /// \brief Constructs a set of read-only samples in adopted storage
+  ///
+  /// \see adoptBuffer()
+  IFSampleData(const IFSampleHeader&        header,
+               const samp_type*             samples,
+               const std::shared_ptr<void>& guard = nullptr)
+    : IFSampleData()
+  {
+    adoptBuffer(header, samples, guard);
+  }
+
+  IFSampleData(const IFSampleData& other);
+  IFSampleData(IFSampleData&& other);
+  IFSampleData& operator=(IFSampleData other);
 
-  samp_type* getBufferPtr() const { return &(data_[0]); }
+  size_t getNumberOfSamples() const { return header_.numSamples_; }
+
+  size_t getNumberOfBytes() const
+  {
+    return header_.numSamples_ * sizeof(samp_type);
+  }
+
+  /// \brief Returns the samples for writing
+  ///
+  /// \returns A pointer to the first sample, or nullptr if the samples are
+  ///          adopted read-only storage
+  samp_type* getBufferPtr()
+  {
+    return readOnly_ ? nullptr : const_cast<samp_type*>(data_);
+  }
+
+  /// \brief Returns the samples for reading
+  const samp_type* getBufferPtr() const { return data_; }
 
   double getSampleRate() const { return header_.fs_; }
 
-  IFSampleHeader getHeader() const { return header_; }
+  const IFSampleHeader& getHeader() const { return header_; }
+
+  /// \brief Sets the header and moves the samples to owned storage
+  ///
+  /// Owned samples kept by the new header are preserved and added samples
+  /// are zeroed. Adopted storage is let go of first.
+  void setHeader(const IFSampleHeader& header);
 
-  void setHeader(const IFSampleHeader& header)
+  /// \brief Uses external storage for the samples
+  ///
+  /// The guard is held for as long as the samples are in use, including by
+  /// copies of this structure, so a shared_ptr whose deleter hands the
+  /// buffer back to its owner (e.g. returns a DMA buffer to the driver)
+  /// releases the storage when the last user lets go of it.
+  ///
+  /// \param header The header describing the samples
+  /// \param samples The first of header.numSamples_ samples
+  /// \param guard Keeps the storage alive while it is adopted (optional)
+  void adoptBuffer(const IFSampleHeader&        header,
+                   samp_type*                   samples,
+                   const std::shared_ptr<void>& guard = nullptr)
   {
-    header_ = header;
-    init();
+    adopt(header, samples, guard, false);
   }
 
-  // void getSampleSubset(std::vector<samp_type> &subset,
-  //                      size_t index1,
-  //                      size_t index2);
+  /// \brief Uses external, read-only storage for the samples
+  ///
+  /// As adoptBuffer() for writable storage, except that the non-const
+  /// getBufferPtr() returns nullptr.
+  void adoptBuffer(const IFSampleHeader&        header,
+                   const samp_type*             samples,
+                   const std::shared_ptr<void>& guard = nullptr)
+  {
+    adopt(header, samples, guard, true);
+  }
+
+  /// \brief Returns true if the samples are in storage owned by the
+  ///        structure
+  bool ownsBuffer() const { return (data_ == owned_) && !guard_; }
+
+  /// \brief Returns the number of samples the owned storage can hold
+  size_t getCapacity() const { return capacity_; }
 
 private:
+  void adopt(const IFSampleHeader&        header,
+             const samp_type*             samples,
+             const std::shared_ptr<void>& guard,
+             bool                         readOnly)
+  {
+    header_   = header;
+    data_     = samples;
+    readOnly_ = readOnly;
+    guard_    = guard;
+  }
+
+  // Grows the owned storage to hold numSamples, keeping the first
+  // numPreserved samples
+  void reserve(size_t numSamples, size_t numPreserved);
+
   /// The packet header
   IFSampleHeader header_;
 
-  void init()
-  {
-    data_.resize(header_.numSamples_);
-    totalNumBytes_ = header_.numSamples_ * header_.bytesPerSample_;
-  }
+  // the samples in use, owned or adopted
+  const samp_type* data_;
+  bool             readOnly_;
 
-  size_t totalNumBytes_;
+  // owned storage, with owned_ aligned inside it
+  std::unique_ptr<uint8_t[]> storage_;
+  samp_type*                 owned_;
+  size_t                     capacity_;
 
-  mutable std::vector<samp_type> data_;
+  // keeps adopted storage alive
+  std::shared_ptr<void> guard_;
 };
 
 template <typename samp_type>
 IFSampleData<samp_type>::IFSampleData(const IFSampleHeader& header)
-  : header_(header)
+  : IFSampleData()
 {
-  init();
+  setHeader(header);
 }
 
-// template <typename samp_type>
-// void IFSampleData<samp_type>::getSampleSubset(std::vector<samp_type>& subset,
-//                                         size_t index1,
-//                                         size_t index2)
-// {
+template <typename samp_type>
+IFSampleData<samp_type>::IFSampleData(const IFSampleData& other)
+  : IFSampleData()
+{
+  if (other.ownsBuffer())
+  {
+    reserve(other.header_.numSamples_, 0);
+    if (other.header_.numSamples_ > 0)
+    {
+      std::memcpy(owned_, other.data_, other.getNumberOfBytes());
+    }
+    header_ = other.header_;
+    data_   = owned_;
+  }
+  else
+  {
+    adopt(other.header_, other.data_, other.guard_, other.readOnly_);
+  }
+}
 
-// }
+template <typename samp_type>
+IFSampleData<samp_type>::IFSampleData(IFSampleData&& other)
+  : header_(other.header_)
+  , data_(other.data_)
+  , readOnly_(other.readOnly_)
+  , storage_(std::move(other.storage_))
+  , owned_(other.owned_)
+  , capacity_(other.capacity_)
+  , guard_(std::move(other.guard_))
+{
+  other.header_.numSamples_ = 0;
+  other.data_               = nullptr;
+  other.readOnly_           = false;
+  other.owned_              = nullptr;
+  other.capacity_           = 0;
+}
+
+template <typename samp_type>
+IFSampleData<samp_type>& IFSampleData<samp_type>::operator=(
+  IFSampleData other)
+{
+  header_   = other.header_;
+  data_     = other.data_;
+  readOnly_ = other.readOnly_;
+  owned_    = other.owned_;
+  capacity_ = other.capacity_;
+  storage_.swap(other.storage_);
+  guard_.swap(other.guard_);
+  other.owned_ = nullptr;
+  return *this;
+}
+
+template <typename samp_type>
+void IFSampleData<samp_type>::setHeader(const IFSampleHeader& header)
+{
+  const size_t preserved =
+    ownsBuffer() ? std::min(header_.numSamples_, header.numSamples_) : 0;
+  guard_.reset();
+  reserve(header.numSamples_, preserved);
+  if (header.numSamples_ > preserved)
+  {
+    std::fill(owned_ + preserved, owned_ + header.numSamples_, samp_type());
+  }
+  header_   = header;
+  data_     = owned_;
+  readOnly_ = false;
+}
+
+template <typename samp_type>
+void IFSampleData<samp_type>::reserve(size_t numSamples, size_t numPreserved)
+{
+  if (numSamples <= capacity_)
+  {
+    return;
+  }
+  std::unique_ptr<uint8_t[]> storage(
+    new uint8_t[numSamples * sizeof(samp_type) + ifSampleAlignment - 1]);
+  const uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+  samp_type*      owned   = reinterpret_cast<samp_type*>(
+    (address + ifSampleAlignment - 1) & ~(uintptr_t)(ifSampleAlignment - 1));
+  if (numPreserved > 0)
+  {
+    std::memcpy(owned, owned_, numPreserved * sizeof(samp_type));
+  }
+  storage_.swap(storage);
+  owned_    = owned;
+  capacity_ = numSamples;
+}
 }  // namespace if_data_utils
-#endif
\ No newline at end of file
+#endif
@@ -43,15 +43,23 @@
 #define IF_DATA_UTILS_IFDATA_HPP
 
 #include <Eigen/Dense>
+#include <array>
 #include <fstream>
-#include <queue>
 #include <string>
+#include <vector>
 
 namespace if_data_utils
 {
 // Convert a 4 sample byte from the MAX2769 front end into four signed values
 void convertSampleToSigned(uint8_t byte, int8_t samples[4]);
 
+// Narrow samples to their low bytesPerSample bytes, packed back to back in
+// bytes (numSamples * bytesPerSample long)
+void narrowSamples(const int32_t* samples,
+                   size_t         numSamples,
+                   size_t         bytesPerSample,
+                   uint8_t*       bytes);
+
 /// Structure to define settings
 struct Settings
 {
@@ -76,19 +84,28 @@ public:
 
   void openOutFile(const std::string& metadataFilename);
   void writeSamples(Eigen::RowVectorXi& samplesEigen, std::size_t sampleSize);
+
+  /// Writes samples to the output file as 32-bit floats
+  void writeSamples(const float* samples, std::size_t numSamples);
   void close();
 
   /// Reads numSamples samples from the file and store them in the passed in
   /// Eigen vector object (samplesEigen).  Returns the sample count value for
-  /// the first sample in the vector
+  /// the first sample in the vector.  Samples past the end of the file are
+  /// returned as zero.
   uint64_t getSamples(Eigen::VectorXf& samplesEigen);
 
+  /// Reads numSamples samples from the file into caller-provided storage.
+  /// Returns the sample count value for the first sample read.
+  uint64_t getSamples(float* samples, size_t numSamples);
+
   uint64_t getComplexSamples(Eigen::VectorXf samplesEigen);
 
   /// Gets the sample count for the next sample to be read from the file
   uint64_t getSampleCount() { return sampleCount_; }
 
-  /// Moves the file pointer to the given sample count value
+  /// Moves the file pointer to the given sample count value (the index of a
+  /// sample in the file)
   bool setSampleCount(uint64_t sampleCount);
 
   size_t getFilePosition() { return samplesFile_.tellg(); }
@@ -112,8 +129,22 @@ public:
   double getPercentRead();
 
 private:
+  // Sample encodings understood by getSamples
+  enum class SampleFormat
+  {
+    SC2,   // four 2-bit MAX2769 samples per byte
+    SC8,   // signed 8-bit samples
+    SC16,  // signed 16-bit samples, native byte order
+    FC32,  // 32-bit float samples, native byte order
+  };
+
+  // Returns the number of file bytes holding numSamples samples
+  size_t bytesForSamples(size_t numSamples) const;
+
   Settings settings_;
 
+  SampleFormat format_;
+
   // Sample count value for the next sample to be read from the file
   // (or the first sample stored in leftover samples)
   uint64_t sampleCount_;
@@ -127,9 +158,19 @@ private:
   size_t samplesPerRead_;
   size_t bytesPerRead_;
 
+  // Raw bytes read from the file, reused between calls to getSamples
+  std::vector<uint8_t, Eigen::aligned_allocator<uint8_t> > readBuffer_;
+
+  // Narrowed samples for the output file, reused between calls to
+  // writeSamples
+  std::vector<uint8_t, Eigen::aligned_allocator<uint8_t> > writeBuffer_;
+
   // Samples read from the file during the last call to getSamples but
-  // not returned in the Eigen vector
-  std::queue<float> leftoverSamples_;
+  // not returned in the Eigen vector.  Only 2-bit data can leave samples
+  // behind, and never more than the three remaining in a partial byte.
+  std::array<float, 4> leftoverSamples_;
+  size_t               leftoverHead_;
+  size_t               leftoverCount_;
 };
 }  // namespace if_data_utils
 #endif
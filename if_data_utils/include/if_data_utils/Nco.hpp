@@ -0,0 +1,93 @@
+//============================================================================//
+//-------------------------- if_data_utils/Nco.hpp -------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the Nco class.
+/// \details  A numerically controlled oscillator for frequency translation
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS_NCO_HPP
+#define IF_DATA_UTILS_NCO_HPP
+
+#include <Eigen/Dense>
+
+namespace if_data_utils
+{
+/// \brief Numerically controlled oscillator
+///
+/// Generates cosine and sine samples a block at a time. Each block is the
+/// product of a table of per-sample rotations and the oscillator phase at
+/// the start of the block, which is carried in double precision, so the
+/// output is phase continuous across blocks of any size.
+class Nco
+{
+public:
+  /// \brief Constructs an oscillator at 0 Hz
+  Nco();
+
+  /// \brief Sets the frequency of the oscillator and resets its phase
+  ///
+  /// \param frequency The oscillator frequency (may be negative) [Hz]
+  /// \param sampFreq The sampling frequency [Hz]
+  /// \param maxBlockSize The largest number of samples generated at a time
+  void configure(double frequency, double sampFreq, size_t maxBlockSize);
+
+  /// \brief Sets the phase of the next sample generated [rad]
+  void reset(double phase = 0.0);
+
+  /// \brief Generates the next numSamples oscillator samples
+  ///
+  /// \param numSamples The number of samples (at most maxBlockSize)
+  /// \param cosine The cosine of the phase of each sample
+  /// \param sine The sine of the phase of each sample
+  void generate(size_t numSamples, float* cosine, float* sine);
+
+  /// \brief Returns the phase of the next sample generated [rad]
+  double getPhase() const { return phase_; }
+
+  /// \brief Returns the phase advance per sample [rad]
+  double getPhaseStep() const { return phaseStep_; }
+
+private:
+  double phase_;
+  double phaseStep_;
+
+  // cosine and sine of the phase step times the sample index in a block
+  Eigen::ArrayXf stepCos_;
+  Eigen::ArrayXf stepSin_;
+};
+}  // namespace if_data_utils
+
+#endif
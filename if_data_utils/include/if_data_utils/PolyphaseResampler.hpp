@@ -0,0 +1,115 @@
+//============================================================================//
+//---------------- if_data_utils/PolyphaseResampler.hpp --------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief    This file contains the declaration of the PolyphaseResampler
+///           class.
+/// \details  Changes the sampling rate of complex IF data by a rational
+///           factor
+/// \date     October 16, 2026
+///
+//===----------------------------------------------------------------------===//
+#ifndef IF_DATA_UTILS_POLYPHASE_RESAMPLER_HPP
+#define IF_DATA_UTILS_POLYPHASE_RESAMPLER_HPP
+
+#include <Eigen/Dense>
+
+namespace if_data_utils
+{
+/// \brief Rational rate polyphase resampler for complex samples
+///
+/// Resamples by interpolation / decimation using a windowed-sinc lowpass
+/// split into one branch per interpolation phase, so only the taps that
+/// contribute to an output sample are evaluated. The filter history is
+/// kept between calls to process(), so a stream can be resampled a block
+/// at a time.
+class PolyphaseResampler
+{
+public:
+  /// \brief Constructs a pass-through resampler
+  PolyphaseResampler();
+
+  /// \brief Designs the filter and resets the resampler
+  ///
+  /// \param interpolation The upsampling factor
+  /// \param decimation The downsampling factor
+  /// \param maxInputs The largest number of samples passed to process()
+  /// \param tapsPerPhase The number of filter taps in each branch
+  /// \returns False if the factors are zero or the filter would be too large
+  bool configure(unsigned interpolation,
+                 unsigned decimation,
+                 size_t   maxInputs,
+                 unsigned tapsPerPhase = 32);
+
+  /// \brief Clears the filter history
+  void reset();
+
+  /// \brief Returns the largest number of samples process() can produce
+  size_t getMaxOutputs(size_t numInputs) const;
+
+  /// \brief Resamples interleaved (I, Q) samples
+  ///
+  /// \param input The input samples
+  /// \param numInputs The number of complex input samples (at most
+  ///                  maxInputs)
+  /// \param output The output samples (at least getMaxOutputs(numInputs)
+  ///               complex samples)
+  /// \returns The number of complex output samples
+  size_t process(const float* input, size_t numInputs, float* output);
+
+  /// \brief Returns the reduced upsampling factor
+  unsigned getInterpolation() const { return interpolation_; }
+
+  /// \brief Returns the reduced downsampling factor
+  unsigned getDecimation() const { return decimation_; }
+
+private:
+  unsigned interpolation_;
+  unsigned decimation_;
+  unsigned tapsPerPhase_;
+
+  // one column per branch, ordered to multiply the oldest sample first
+  Eigen::MatrixXf coeffs_;
+
+  // filter history followed by the current input
+  Eigen::VectorXf bufferI_;
+  Eigen::VectorXf bufferQ_;
+
+  // buffer index of the newest sample of the next output, and its branch
+  size_t   index_;
+  unsigned phase_;
+};
+}  // namespace if_data_utils
+
+#endif
@@ -35,9 +35,9 @@
 /// \file
 /// \brief    This file contains the declaration of the UpConvert class.
 /// \details  This class contains methods used in the implementation to
-///           convert a baseband Complex (IQ) data file to a real non-zero
-///           IF signal file. IF frequency will be a quarter of
-///           the sampling frequency
+///           convert a Complex (IQ) data file to another IF, sampling
+///           frequency and data format. By default a baseband file becomes
+///           a real signal file at a quarter of the sampling frequency
 /// \author   Joshua Starling <josh.starling@is4s.com>
 /// \version  0.1
 /// \date     April 27, 2018
@@ -46,9 +46,12 @@
 #ifndef IF_DATA_UTILS_UPCONVERT_HPP
 #define IF_DATA_UTILS_UPCONVERT_HPP
 
+#include <string>
 #include <vector>
 
 #include "if_data_utils/IfData.hpp"
+#include "if_data_utils/Nco.hpp"
+#include "if_data_utils/PolyphaseResampler.hpp"
 #include "if_data_utils/dataFileStructures.hpp"
 
 namespace if_data_utils
@@ -68,7 +71,10 @@ public:
   ///  description of event
   void addFile(dataFile file);
 
-  /// \Brief Combines data files to generate a signle attack file
+  /// \Brief Translates the data file to the output IF, sampling frequency
+  /// and data format in a single pass
+  ///
+  /// The input file must be complex sc2, sc8, sc16 or fc32.
   ///
   /// \param name of desired output file
   bool upconvertFile(std::string outFile);
@@ -79,6 +85,36 @@ public:
   /// \Brief Sets number of samples to be read per block
   void setBlkSize(int blkSize) { blkSize_ = blkSize; }
 
+  /// \Brief Sets the IF of the output signal [Hz] (defaults to a quarter of
+  /// the output sampling frequency)
+  void setOutputIf(double outputIf)
+  {
+    outputIf_    = outputIf;
+    outputIfSet_ = true;
+  }
+
+  /// \Brief Sets the sampling frequency of the output signal [Hz] (defaults
+  /// to the input sampling frequency). Any other rate is reached with a
+  /// polyphase resampler.
+  void setOutputSampFreq(double outputSampFreq)
+  {
+    outputSampFreq_ = outputSampFreq;
+  }
+
+  /// \Brief Sets the data format of the output: sc8, sc16 or fc32 (defaults
+  /// to the input format, or sc8 for sc2 input)
+  void setOutputFormat(const std::string& outputFormat)
+  {
+    outputFormat_ = outputFormat;
+  }
+
+  /// \Brief Sets whether the output keeps I and Q (defaults to real)
+  void setOutputComplex(bool outputComplex) { outputComplex_ = outputComplex; }
+
+  /// \Brief Sets a gain applied on top of the scaling between the full
+  /// scales of the input and output formats
+  void setGain(float gain) { gain_ = gain; }
+
   //////////////////////////////////
   /////////Getter Functions/////////
   //////////////////////////////////
@@ -89,8 +125,13 @@ public:
   float getFileDurationSamp() { return fileDurationSamp_; }
 
 private:
-  /// \Brief Calls proper IF Data class object to read data file
-  void readFile(Eigen::VectorXf& samplesEigen);
+  /// \Brief Reads, translates and writes every block of the file
+  template <typename out_type>
+  void translateFile(uint64_t numSamples);
+
+  /// \Brief Writes numSamples mixed samples in the output format
+  template <typename out_type>
+  void writeOutput(size_t numSamples);
 
   /// \Brief Opens proper IF Data class object to open data file
   void openFile();
@@ -99,12 +140,34 @@ private:
   if_data_utils::IfData ifData_;
   if_data_utils::IfData ifDataOut_;
 
-  int                blkSize_;
-  int                numOfLoops_{};
-  float              fileDurationSamp_{};
-  dataFile           fileIn_;
-  std::vector<float> mixSine_;
-  std::vector<float> mixCos_;
+  int      blkSize_;
+  int      numOfLoops_{};
+  float    fileDurationSamp_{};
+  dataFile fileIn_;
+
+  /// Output settings
+  double      outputIf_;
+  bool        outputIfSet_;
+  double      outputSampFreq_;
+  std::string outputFormat_;
+  bool        outputComplex_;
+  float       gain_;
+  float       scale_;
+
+  /// Frequency translation stages
+  Nco                nco_;
+  PolyphaseResampler resampler_;
+  bool               resample_;
+
+  /// Block buffers, sized once per file
+  Eigen::VectorXf    inputSamples_;
+  Eigen::VectorXf    resampled_;
+  Eigen::ArrayXf     inPhase_;
+  Eigen::ArrayXf     quadrature_;
+  Eigen::ArrayXf     cosine_;
+  Eigen::ArrayXf     sine_;
+  Eigen::ArrayXf     mixed_;
+  Eigen::RowVectorXi dataOutput_;
 };
 }  // namespace if_data_utils
 
@@ -0,0 +1,592 @@
+//============================================================================//
+//------------------ if_data_utils/AsyncBlockReader.cpp --------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+//
+// Reads consecutive blocks of a file with several reads in flight, using
+// io_uring or a pread() worker thread
+// October 16, 2026
+//
+//===----------------------------------------------------------------------===//
+#ifndef _WIN32
+
+#include "if_data_utils/AsyncBlockReader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#define IF_DATA_UTILS_HAVE_IO_URING 1
+#endif
+#endif
+
+namespace if_data_utils
+{
+//==============================================================================
+//------------------------------- Constructor ----------------------------------
+//==============================================================================
+AsyncBlockReader::AsyncBlockReader(const logutils::LogCallback& log)
+  : log_(log)
+  , fileDescriptor_(-1)
+  , backend_(Backend::Auto)
+  , blockBytes_(0)
+  , fileSize_(0)
+  , nextOffset_(0)
+  , head_(0)
+  , count_(0)
+  , bytesRead_(0)
+  , numWaits_(0)
+  , queueDepthSum_(0)
+  , ringFd_(-1)
+  , sqRing_(nullptr)
+  , sqRingSize_(0)
+  , cqRing_(nullptr)
+  , cqRingSize_(0)
+  , sqes_(nullptr)
+  , sqesSize_(0)
+  , sqTail_(nullptr)
+  , sqMask_(nullptr)
+  , sqArray_(nullptr)
+  , cqHead_(nullptr)
+  , cqTail_(nullptr)
+  , cqMask_(nullptr)
+  , cqes_(nullptr)
+  , pendingCount_(0)
+  , pendingIndex_(0)
+  , stopWorker_(false)
+{
+}
+
+//==============================================================================
+//---------------------------------- open --------------------------------------
+//==============================================================================
+bool AsyncBlockReader::open(const std::string& filename,
+                            const size_t&      blockBytes,
+                            const size_t&      queueDepth,
+                            const Backend&     backend,
+                            const size_t&      startOffset)
+{
+  close();
+
+  if ((blockBytes == 0) || (queueDepth == 0))
+  {
+    log_("AsyncBlockReader::open(): block size and queue depth must be > 0",
+         logutils::LogLevel::Error);
+    return false;
+  }
+
+  fileDescriptor_ = ::open(filename.c_str(), O_RDONLY);
+  struct stat fileStat;
+  if ((fileDescriptor_ < 0) || (fstat(fileDescriptor_, &fileStat) != 0))
+  {
+    std::stringstream errStr;
+    errStr << "File open failed: " << filename << " (" << strerror(errno)
+           << ")";
+    log_(errStr.str(), logutils::LogLevel::Error);
+    close();
+    return false;
+  }
+  posix_fadvise(fileDescriptor_, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  blockBytes_ = blockBytes;
+  fileSize_   = fileStat.st_size;
+  nextOffset_ = startOffset;
+  requests_.assign(queueDepth, Request());
+  head_          = 0;
+  count_         = 0;
+  bytesRead_     = 0;
+  numWaits_      = 0;
+  queueDepthSum_ = 0;
+
+  backend_ = backend;
+  if (backend_ != Backend::Thread)
+  {
+    if (setupIoUring(queueDepth))
+    {
+      backend_ = Backend::IoUring;
+    }
+    else if (backend_ == Backend::IoUring)
+    {
+      log_("AsyncBlockReader::open(): io_uring is not available",
+           logutils::LogLevel::Error);
+      close();
+      return false;
+    }
+    else
+    {
+      backend_ = Backend::Thread;
+    }
+  }
+
+  if (backend_ == Backend::Thread)
+  {
+    pendingCount_ = 0;
+    pendingIndex_ = 0;
+    stopWorker_   = false;
+    worker_       = std::thread(&AsyncBlockReader::workerLoop, this);
+  }
+
+  std::stringstream msg;
+  msg << "Successfully opened: " << filename << " ("
+      << ((backend_ == Backend::IoUring) ? "io_uring" : "pread thread")
+      << ", " << queueDepth << " x " << blockBytes << " byte reads)";
+  log_(msg.str(), logutils::LogLevel::Info);
+
+  openTime_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+//==============================================================================
+//---------------------------------- close -------------------------------------
+//==============================================================================
+void AsyncBlockReader::close()
+{
+  // let the outstanding reads finish, since they write into caller buffers
+  void* buffer;
+  while (count_ > 0)
+  {
+    wait(buffer);
+  }
+
+  if (worker_.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(workerMutex_);
+      stopWorker_ = true;
+    }
+    workerCondition_.notify_all();
+    worker_.join();
+  }
+  closeIoUring();
+
+  if (fileDescriptor_ >= 0)
+  {
+    ::close(fileDescriptor_);
+    fileDescriptor_ = -1;
+  }
+}
+
+//==============================================================================
+//--------------------------------- submit -------------------------------------
+//==============================================================================
+bool AsyncBlockReader::submit(void* buffer)
+{
+  if ((!isOpen()) || (count_ == requests_.size()) || isEndOfFile())
+  {
+    return false;
+  }
+
+  const size_t index = (head_ + count_) % requests_.size();
+  Request&     req   = requests_[index];
+  req.buffer         = buffer;
+  req.offset         = nextOffset_;
+  req.size           = std::min(blockBytes_, fileSize_ - nextOffset_);
+  req.done           = 0;
+  req.error          = 0;
+  req.complete       = false;
+
+  // the request only counts once it is queued, so a failed start leaves the
+  // buffer with the caller
+  if (!startRequest(index))
+  {
+    std::stringstream errStr;
+    errStr << "Problem queueing read: " << strerror(req.error);
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return false;
+  }
+  nextOffset_ += req.size;
+  ++count_;
+  return true;
+}
+
+//==============================================================================
+//---------------------------------- wait --------------------------------------
+//==============================================================================
+ssize_t AsyncBlockReader::wait(void*& buffer)
+{
+  if (count_ == 0)
+  {
+    return -1;
+  }
+  ++numWaits_;
+  queueDepthSum_ += count_;
+
+  Request& req = requests_[head_];
+  if (backend_ == Backend::IoUring)
+  {
+    while (!req.complete)
+    {
+      if (!reapIoUring())
+      {
+        req.error    = errno;
+        req.complete = true;
+      }
+    }
+  }
+  else
+  {
+    std::unique_lock<std::mutex> lock(workerMutex_);
+    workerCondition_.wait(lock, [&req]() { return req.complete; });
+  }
+
+  buffer = req.buffer;
+  head_  = (head_ + 1) % requests_.size();
+  --count_;
+
+  if (req.error != 0)
+  {
+    std::stringstream errStr;
+    errStr << "Problem reading: " << strerror(req.error);
+    log_(errStr.str(), logutils::LogLevel::Error);
+    return -1;
+  }
+  bytesRead_ += req.done;
+  return (ssize_t)req.done;
+}
+
+//==============================================================================
+//------------------------------ getThroughput ---------------------------------
+//==============================================================================
+double AsyncBlockReader::getThroughput() const
+{
+  double elapsed = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - openTime_)
+                     .count();
+  return (elapsed > 0.0) ? bytesRead_ / elapsed / 1e6 : 0.0;
+}
+
+//==============================================================================
+//------------------------------ startRequest ----------------------------------
+//==============================================================================
+bool AsyncBlockReader::startRequest(const size_t& index)
+{
+  if (backend_ == Backend::IoUring)
+  {
+    return submitIoUring(index);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(workerMutex_);
+    ++pendingCount_;
+  }
+  workerCondition_.notify_all();
+  return true;
+}
+
+//==============================================================================
+//------------------------------- workerLoop -----------------------------------
+//==============================================================================
+void AsyncBlockReader::workerLoop()
+{
+  std::unique_lock<std::mutex> lock(workerMutex_);
+  while (true)
+  {
+    workerCondition_.wait(
+      lock, [this]() { return stopWorker_ || (pendingCount_ > 0); });
+    if (stopWorker_)
+    {
+      return;
+    }
+
+    // requests are started in ring order, so the oldest pending one is next
+    Request& req = requests_[pendingIndex_];
+    lock.unlock();
+
+    while (req.done < req.size)
+    {
+      ssize_t bytes = pread(fileDescriptor_,
+                            (char*)req.buffer + req.done,
+                            req.size - req.done,
+                            req.offset + req.done);
+      if (bytes < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        req.error = errno;
+        break;
+      }
+      if (bytes == 0)
+      {
+        break;
+      }
+      req.done += bytes;
+    }
+
+    lock.lock();
+    req.complete  = true;
+    pendingIndex_ = (pendingIndex_ + 1) % requests_.size();
+    --pendingCount_;
+    workerCondition_.notify_all();
+  }
+}
+
+#ifdef IF_DATA_UTILS_HAVE_IO_URING
+
+//==============================================================================
+//------------------------------ setupIoUring ----------------------------------
+//==============================================================================
+bool AsyncBlockReader::setupIoUring(const size_t& queueDepth)
+{
+  struct io_uring_params params;
+  std::memset(&params, 0, sizeof(params));
+
+  ringFd_ = (int)syscall(__NR_io_uring_setup, (unsigned)queueDepth, &params);
+  if (ringFd_ < 0)
+  {
+    std::stringstream msg;
+    msg << "io_uring setup failed (" << strerror(errno) << ")";
+    log_(msg.str(), logutils::LogLevel::Debug);
+    return false;
+  }
+
+  // map the submission and completion rings and the submission entries
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ =
+    params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (singleMap)
+  {
+    sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+  }
+
+  sqRing_ = mmap(nullptr,
+                 sqRingSize_,
+                 PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE,
+                 ringFd_,
+                 IORING_OFF_SQ_RING);
+  if (sqRing_ == MAP_FAILED)
+  {
+    sqRing_ = nullptr;
+    closeIoUring();
+    return false;
+  }
+
+  if (singleMap)
+  {
+    cqRing_ = sqRing_;
+  }
+  else
+  {
+    cqRing_ = mmap(nullptr,
+                   cqRingSize_,
+                   PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE,
+                   ringFd_,
+                   IORING_OFF_CQ_RING);
+    if (cqRing_ == MAP_FAILED)
+    {
+      cqRing_ = nullptr;
+      closeIoUring();
+      return false;
+    }
+  }
+
+  sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_     = mmap(nullptr,
+               sqesSize_,
+               PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE,
+               ringFd_,
+               IORING_OFF_SQES);
+  if (sqes_ == MAP_FAILED)
+  {
+    sqes_ = nullptr;
+    closeIoUring();
+    return false;
+  }
+
+  char* sq = (char*)sqRing_;
+  char* cq = (char*)cqRing_;
+  sqTail_  = (unsigned*)(sq + params.sq_off.tail);
+  sqMask_  = (unsigned*)(sq + params.sq_off.ring_mask);
+  sqArray_ = (unsigned*)(sq + params.sq_off.array);
+  cqHead_  = (unsigned*)(cq + params.cq_off.head);
+  cqTail_  = (unsigned*)(cq + params.cq_off.tail);
+  cqMask_  = (unsigned*)(cq + params.cq_off.ring_mask);
+  cqes_    = cq + params.cq_off.cqes;
+  return true;
+}
+
+//==============================================================================
+//------------------------------ closeIoUring ----------------------------------
+//==============================================================================
+void AsyncBlockReader::closeIoUring()
+{
+  if (sqes_)
+  {
+    munmap(sqes_, sqesSize_);
+  }
+  if (cqRing_ && (cqRing_ != sqRing_))
+  {
+    munmap(cqRing_, cqRingSize_);
+  }
+  if (sqRing_)
+  {
+    munmap(sqRing_, sqRingSize_);
+  }
+  if (ringFd_ >= 0)
+  {
+    ::close(ringFd_);
+  }
+  ringFd_ = -1;
+  sqRing_ = cqRing_ = sqes_ = cqes_ = nullptr;
+}
+
+//==============================================================================
+//------------------------------ submitIoUring ---------------------------------
+//==============================================================================
+bool AsyncBlockReader::submitIoUring(const size_t& index)
+{
+  Request& req     = requests_[index];
+  req.iov.iov_base = (char*)req.buffer + req.done;
+  req.iov.iov_len  = req.size - req.done;
+
+  // each request has at most one entry queued, so the ring never fills
+  const unsigned tail = *sqTail_;
+  const unsigned slot = tail & *sqMask_;
+
+  struct io_uring_sqe* sqe = (struct io_uring_sqe*)sqes_ + slot;
+  std::memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode    = IORING_OP_READV;
+  sqe->fd        = fileDescriptor_;
+  sqe->addr      = (unsigned long long)(uintptr_t)&req.iov;
+  sqe->len       = 1;
+  sqe->off       = req.offset + req.done;
+  sqe->user_data = index;
+  sqArray_[slot] = slot;
+  __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+
+  while (syscall(__NR_io_uring_enter, ringFd_, 1, 0, 0, nullptr, 0) < 0)
+  {
+    if (errno != EINTR)
+    {
+      // nothing was consumed, so withdraw the entry rather than leave it to
+      // go out with the next submission
+      req.error    = errno;
+      req.complete = true;
+      __atomic_store_n(sqTail_, tail, __ATOMIC_RELEASE);
+      return false;
+    }
+  }
+  return true;
+}
+
+//==============================================================================
+//------------------------------- reapIoUring ----------------------------------
+//==============================================================================
+bool AsyncBlockReader::reapIoUring()
+{
+  unsigned head = *cqHead_;
+  if (head == __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE))
+  {
+    // block until at least one read completes
+    if ((syscall(__NR_io_uring_enter,
+                 ringFd_,
+                 0,
+                 1,
+                 IORING_ENTER_GETEVENTS,
+                 nullptr,
+                 0) < 0) &&
+        (errno != EINTR))
+    {
+      return false;
+    }
+  }
+
+  const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head)
+  {
+    const struct io_uring_cqe* cqe =
+      (const struct io_uring_cqe*)cqes_ + (head & *cqMask_);
+    Request& req = requests_[cqe->user_data];
+    if ((cqe->res == -EINTR) || (cqe->res == -EAGAIN))
+    {
+      submitIoUring(cqe->user_data);
+    }
+    else if (cqe->res < 0)
+    {
+      req.error    = -cqe->res;
+      req.complete = true;
+    }
+    else
+    {
+      req.done += cqe->res;
+      if ((cqe->res > 0) && (req.done < req.size))
+      {
+        // continue a short read
+        submitIoUring(cqe->user_data);
+      }
+      else
+      {
+        req.complete = true;
+      }
+    }
+  }
+  __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+  return true;
+}
+
+#else
+
+bool AsyncBlockReader::setupIoUring(const size_t& /*queueDepth*/)
+{
+  return false;
+}
+
+void AsyncBlockReader::closeIoUring() {}
+
+bool AsyncBlockReader::submitIoUring(const size_t& /*index*/)
+{
+  return false;
+}
+
+bool AsyncBlockReader::reapIoUring()
+{
+  return false;
+}
+
+#endif
+}  // namespace if_data_utils
+#endif
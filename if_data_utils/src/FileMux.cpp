@@ -42,7 +42,14 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "if_data_utils/FileMux.hpp"
@@ -50,10 +57,37 @@
 
 namespace if_data_utils
 {
+namespace
+{
+// Runs task(worker, taskIndex) for every task on a pool of threads, each
+// thread taking the next task as it finishes the last
+template <typename Task>
+void runTasks(size_t numThreads, size_t numTasks, Task task)
+{
+  std::atomic<size_t>      nextTask(0);
+  std::vector<std::thread> threads;
+  for (size_t ii = 0; ii < numThreads; ++ii)
+  {
+    threads.emplace_back([&nextTask, numTasks, &task, ii]() {
+      for (size_t jj = nextTask++; jj < numTasks; jj = nextTask++)
+      {
+        task(ii, jj);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+}  // namespace
+
 FileMux::FileMux()
 {
   numberOfFiles_ = 0;
   blkSize_       = 2000;
+  numThreads_    = std::max(1u, std::thread::hardware_concurrency());
+  segmentSize_   = 1 << 20;
 }
 
 FileMux::~FileMux()
@@ -71,7 +105,7 @@ void FileMux::addFile(dataFile file)
   else if (file.dataFormat == "sc16")
   {
     file.bytesPerSample = 2;
-    file.maxValue       = 32768;
+    file.maxValue       = 32767;
   }
   else if (file.dataFormat == "sc2")
   {
@@ -94,69 +128,77 @@ void FileMux::addFile(dataFile file)
 
 bool FileMux::validateDataFiles()
 {
-  // Verify that aux data types match reference data type
-  if (files_[0].bytesPerSample != files_[1].bytesPerSample)
-  {
-    std::cout << "ERROR: Number of bytes per sample does not match!!! Exiting"
-              << std::endl;
-    return false;
-  }
-  if (files_[0].samplePerMeas != files_[1].samplePerMeas)
+  if (files_.empty())
   {
-    std::cout << "ERROR: Files data types(real/complex) do not match!!! Exiting"
-              << std::endl;
+    std::cout << "ERROR: No data files to combine!!! Exiting" << std::endl;
     return false;
   }
-  if (files_[0].sampFreq != files_[1].sampFreq)
+  if ((files_[0].dataFormat != "sc8") && (files_[0].dataFormat != "sc16"))
   {
-    std::cout << "ERROR: Sample frequencies do not match!!! Exiting"
+    std::cout << "ERROR: Combined files must be sc8 or sc16!!! Exiting"
               << std::endl;
     return false;
   }
-  if (files_[0].ifFreq != files_[1].ifFreq)
+
+  // Verify that aux data types match reference data type
+  for (size_t ii = 1; ii < files_.size(); ii++)
   {
-    std::cout << "ERROR: IF frequencies do not match!!! Exiting" << std::endl;
-    return false;
+    if (files_[0].bytesPerSample != files_[ii].bytesPerSample)
+    {
+      std::cout << "ERROR: Number of bytes per sample does not match!!! "
+                << "Exiting" << std::endl;
+      return false;
+    }
+    if (files_[0].samplePerMeas != files_[ii].samplePerMeas)
+    {
+      std::cout
+        << "ERROR: Files data types(real/complex) do not match!!! Exiting"
+        << std::endl;
+      return false;
+    }
+    if (files_[0].sampFreq != files_[ii].sampFreq)
+    {
+      std::cout << "ERROR: Sample frequencies do not match!!! Exiting"
+                << std::endl;
+      return false;
+    }
+    if (files_[0].ifFreq != files_[ii].ifFreq)
+    {
+      std::cout << "ERROR: IF frequencies do not match!!! Exiting"
+                << std::endl;
+      return false;
+    }
   }
   return true;
 }
 
 void FileMux::createEventProfile(int idx)
 {
-  std::cout << idx << std::endl;
-  eventActivationBlk_.push_back(
-    floor(files_[idx].event.startTime / (blkSize_ / files_[0].sampFreq)));
-
-  eventDeactivationBlk_.push_back(
-    floor(files_[idx].event.endTime / (blkSize_ / files_[0].sampFreq)));
-
-  float deltaPower = files_[idx].event.endPower - files_[idx].event.startPower;
-  float numbBlksActive =
-    eventDeactivationBlk_.at(idx - 1) - eventActivationBlk_.at(idx - 1);
-  eventDeltaPowerFrac_.push_back(deltaPower / numbBlksActive);
-  eventPower_.push_back(files_[idx].event.startPower / 100.);
+  double blkDuration = blkSize_ / files_[0].sampFreq;
+
+  EventProfile event;
+  event.activationBlk =
+    (long)floor(files_[idx].event.startTime / blkDuration);
+  event.deactivationBlk = (long)floor(files_[idx].event.endTime / blkDuration);
+
+  // the power ramps linearly from the start power in the activation block
+  // to the end power in the deactivation block
+  double deltaPower = files_[idx].event.endPower - files_[idx].event.startPower;
+  long   numbBlksActive = event.deactivationBlk - event.activationBlk;
+  event.startPower      = files_[idx].event.startPower / 100.;
+  event.powerStep =
+    (numbBlksActive > 0) ? deltaPower / numbBlksActive / 100. : 0.;
+  events_.push_back(event);
 }
 
-bool FileMux::checkIfEventActive(int blk, int idx)
+double FileMux::eventPower(long blk, int idx) const
 {
-  if (blk == eventActivationBlk_.at(idx))
-  {
-    // Open aux data file if event occurs this block
-    openFile(idx + 1);
-    return true;
-  }
-  else if (blk > eventActivationBlk_.at(idx) &&
-           blk <= eventDeactivationBlk_.at(idx))
-  {
-    // Determine new event power level
-    eventPower_.at(idx) =
-      eventPower_.at(idx) + eventDeltaPowerFrac_.at(idx) / 100.;
-    return true;
-  }
-  else
+  const EventProfile& event = events_.at(idx);
+  if (blk < event.activationBlk || blk > event.deactivationBlk)
   {
-    return false;
+    return 0.;
   }
+  return event.startPower + (blk - event.activationBlk) * event.powerStep;
 }
 
 bool FileMux::combineFiles(std::string outFile)
@@ -167,199 +209,258 @@ bool FileMux::combineFiles(std::string outFile)
     return false;
   }
 
-  // Determine max value of all files such that combine file does not saturate
-  determineMax();
-
-  ///////////////////
-  /// Combine Files///
-  ///////////////////
-  // Determine size of input and output signal vectors
-  int                dataSize = blkSize_ * (int)files_[0].samplePerMeas;
-  Eigen::VectorXf    dataFile1(dataSize);
-  Eigen::VectorXf    dataFile2(dataSize);
-  Eigen::VectorXf    dataFile3(dataSize);
-  Eigen::RowVectorXi dataOutput(dataSize);
-  openFile(0);
-  // Open reference files
-  ifDataOut_.openOutFile(std::move(outFile));
+  // Each worker reads through its own copy of every file
+  size_t              numThreads = std::max(numThreads_, 1);
+  std::vector<Worker> workers(numThreads);
+  for (auto& worker : workers)
+  {
+    if (!openFiles(worker))
+    {
+      return false;
+    }
+  }
 
   // Create event profile of when aux files are activated and desired power
+  events_.clear();
   for (int ii = 1; ii < numberOfFiles_; ii++)
   {
     FileMux::createEventProfile(ii);
   }
 
-  std::vector<float> active;
-  for (int jj = 0; jj < numOfLoops_; jj++)
-  {
-    for (int ii = 0; ii < numberOfFiles_ - 1; ii++)
-    {
-      active.push_back(checkIfEventActive(jj, ii));
-    }
+  // Run until the end of the reference file or its end time
+  const dataFile& ref      = files_[0];
+  double          blkBytes = blkSize_ * ref.samplePerMeas * ref.bytesPerSample;
+  double          endBytes =
+    std::min<double>(workers[0].inputs[0]->getFilesize(),
+                     ref.event.endTime * ref.sampFreq * ref.samplePerMeas *
+                       ref.bytesPerSample);
+  double skipBytes = getSampleOffset(0) * ref.bytesPerSample;
+  numOfLoops_ =
+    (endBytes > skipBytes) ? int((endBytes - skipBytes) / blkBytes) : 0;
 
-    // Read data files
-    readFile(0, dataFile1);
-    readFile(1, dataFile2);
-    if (numberOfFiles_ == 3)
-    {
-      readFile(2, dataFile3);
-    }
-    float tempDataOut = NAN;
-    for (int kk = 0; kk < blkSize_ * files_[0].samplePerMeas; kk++)
-    {
-      tempDataOut =
-        dataFile1[kk] + dataFile2[kk] * active.at(0) * eventPower_.at(0);
-      if (numberOfFiles_ == 3)
-      {
-        tempDataOut =
-          tempDataOut + dataFile3[kk] * active.at(1) * eventPower_.at(1);
-      }
-      // Add files together using appropriate data type
-      if (files_[0].dataFormat == "sc8")
-      {
-        dataOutput[kk] = (uint8_t)(tempDataOut * sumScale_);
-      }
-      else if (files_[0].dataFormat == "sc16")
-      {
-        dataOutput[kk] = (uint16_t)(dataOutput[kk] * sumScale_);
-      }
-    }
-    // Write combined signal to output file
-    ifDataOut_.writeSamples(dataOutput,
-                            sizeof(char) * files_[0].bytesPerSample);
-    active.clear();
-  }
+  // Determine max value of all files such that combine file does not saturate
+  determineMax(workers);
 
-  // Close all files
-  ifData0_.close();
-  ifData1_.close();
-  if (numberOfFiles_ == 3)
+  ///////////////////
+  /// Combine Files///
+  ///////////////////
+  ifDataOut_.openOutFile(std::move(outFile));
+  if (ref.dataFormat == "sc8")
   {
-    ifData2_.close();
+    mixFiles<int8_t>(workers);
   }
+  else
+  {
+    mixFiles<int16_t>(workers);
+  }
+  ifDataOut_.close();
   return true;
 }
 
-void FileMux::determineMax()
+void FileMux::determineMax(std::vector<Worker>& workers)
 {
-  // Determine size of signal vectors
-  int             dataSize = blkSize_ * (int)files_[0].samplePerMeas;
-  Eigen::VectorXf dataEigen(dataSize);
+  // Determine the span of each file that will be mixed
+  long dataSize = blkSize_ * (long)files_[0].samplePerMeas;
+  std::vector<long> numSamples(numberOfFiles_);
+  numSamples[0] = numOfLoops_ * dataSize;
+  for (int ii = 1; ii < numberOfFiles_; ii++)
+  {
+    const EventProfile& event = events_[ii - 1];
+    long lastBlk = std::min<long>(event.deactivationBlk, numOfLoops_ - 1);
+    numSamples[ii] =
+      std::max<long>(lastBlk - event.activationBlk + 1, 0) * dataSize;
+  }
 
-  // Determine max for each input file
+  // Split every span into segments that are scanned in parallel
+  struct ScanTask
+  {
+    int   file;
+    long  first;
+    long  count;
+    float peak;
+  };
+  std::vector<ScanTask> tasks;
   for (int ii = 0; ii < numberOfFiles_; ii++)
   {
-    fileMaxs_.push_back(0);
-
-    // Open file
-    openFile(ii);
-
-    // Determine number of required loops per given block size
-    if (ii == 0)
-    {
-      // Determine if upconvert should be ran until end of file or set end time
-      if (ifData0_.getFilesize() < files_[0].event.endTime * files_[0].sampFreq)
-      {
-        numOfLoops_ =
-          int(ifData0_.getFilesize() - ifData0_.getSampleCount()) /
-          (blkSize_ * files_[0].samplePerMeas * files_[0].bytesPerSample);
-        std::cout << "File size smaller" << numOfLoops_ << std::endl;
-      }
-      else
-      {
-        numOfLoops_ =
-          int(files_[0].event.endTime * files_[0].sampFreq *
-                files_[0].samplePerMeas * files_[0].bytesPerSample -
-              ifData0_.getSampleCount()) /
-          (blkSize_ * files_[0].samplePerMeas * files_[0].bytesPerSample);
-        std::cout << "end smaller " << numOfLoops_ << std::endl;
-      }
-    }
-
-    for (int jj = 0; jj < numOfLoops_; jj++)
+    for (long first = 0; first < numSamples[ii]; first += segmentSize_)
     {
-      // Read data
-      readFile(ii, dataEigen);
-      for (int kk = 0; kk < blkSize_; kk++)
-      {
-        // Check for new max values, replace if new max found
-        if (dataEigen[kk] > fileMaxs_[ii])
-        {
-          fileMaxs_[ii] = (float)dataEigen[kk];
-        }
-      }
-    }
-
-    // Close file
-    if (ii == 0)
-    {
-      ifData0_.close();
-    }
-    else if (ii == 1)
-    {
-      ifData1_.close();
-    }
-    else
-    {
-      ifData2_.close();
+      ScanTask task = {
+        ii, first, std::min<long>(segmentSize_, numSamples[ii] - first), 0.f};
+      tasks.push_back(task);
     }
   }
 
+  runTasks(workers.size(), tasks.size(), [&](size_t worker, size_t idx) {
+    ScanTask& task  = tasks[idx];
+    Worker&   state = workers[worker];
+    IfData&   input = *state.inputs[task.file];
+    input.setSampleCount(getSampleOffset(task.file) + task.first);
+    input.getSamples(state.samples.data(), task.count);
+    task.peak = state.samples.head(task.count).cwiseAbs().maxCoeff();
+  });
+
   // Sum max values to determine largest maximum value,
   // scale per data type max value
+  fileMaxs_.assign(numberOfFiles_, 0.f);
+  for (const auto& task : tasks)
+  {
+    fileMaxs_[task.file] = std::max(fileMaxs_[task.file], task.peak);
+  }
   float maxCombValue = 0;
   for (std::vector<float>::iterator it = fileMaxs_.begin();
        it != fileMaxs_.end();
        ++it)
     maxCombValue += *it;
-  sumScale_ = files_[0].maxValue / maxCombValue;
+  sumScale_ = (maxCombValue > 0) ? files_[0].maxValue / maxCombValue : 1.f;
 }
 
-void FileMux::openFile(int idx)
+template <typename out_type>
+void FileMux::mixFiles(std::vector<Worker>& workers)
 {
-  // Create setting file required by IF data class
-  if_data_utils::Settings ifSettings;
-  ifSettings.samplingFreq          = files_[idx].sampFreq;
-  ifSettings.intermediateFrequency = files_[idx].ifFreq;
-  ifSettings.bytesPerSample        = files_[idx].bytesPerSample;
-  ifSettings.complex               = files_[idx].isComplex;
-  ifSettings.sampleCountOffset =
-    (uint64_t)(files_[idx].skipSeconds * ifSettings.samplingFreq *
-               files_[idx].samplePerMeas);
-  ifSettings.dataFilename = files_[idx].fileName;
-
-  // Open file and move to correct position in file
-  if (idx == 0)
+  long dataSize    = blkSize_ * (long)files_[0].samplePerMeas;
+  long blksPerSeg  = std::max<long>(segmentSize_ / dataSize, 1);
+  long numSegments = (numOfLoops_ + blksPerSeg - 1) / blksPerSeg;
+
+  // Mixed segments wait in a ring of slots until they are written in order
+  size_t                          numSlots = 2 * workers.size();
+  std::vector<Eigen::RowVectorXi> slots(numSlots);
+  std::vector<bool>               ready(numSlots, false);
+  long                            nextSegment = 0;
+  long                            numWritten  = 0;
+  std::mutex                      mutex;
+  std::condition_variable         condition;
+
+  std::vector<std::thread> threads;
+  for (auto& worker : workers)
   {
-    ifData0_.open(ifSettings);
-    ifData0_.setSampleCount(ifSettings.sampleCountOffset);
+    threads.emplace_back([&, blksPerSeg, numSegments]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      for (long seg = nextSegment++; seg < numSegments; seg = nextSegment++)
+      {
+        // the slot is free once the segment that used it before is written
+        size_t slot = seg % numSlots;
+        condition.wait(
+          lock, [&]() { return seg < numWritten + (long)numSlots; });
+        lock.unlock();
+
+        long firstBlk = seg * blksPerSeg;
+        mixSegment<out_type>(worker, firstBlk,
+                             std::min(blksPerSeg, numOfLoops_ - firstBlk),
+                             slots[slot]);
+
+        lock.lock();
+        ready[slot] = true;
+        condition.notify_all();
+      }
+    });
   }
-  else if (idx == 1)
+
+  // Write combined signal to output file
+  for (long seg = 0; seg < numSegments; seg++)
   {
-    ifData1_.open(ifSettings);
-    ifData1_.setSampleCount(ifSettings.sampleCountOffset);
+    size_t slot = seg % numSlots;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&]() { return ready[slot]; });
+    }
+    ifDataOut_.writeSamples(slots[slot], sizeof(out_type));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ready[slot] = false;
+      numWritten  = seg + 1;
+    }
+    condition.notify_all();
   }
-  else
+
+  for (auto& thread : threads)
   {
-    ifData2_.open(ifSettings);
-    ifData2_.setSampleCount(ifSettings.sampleCountOffset);
+    thread.join();
   }
 }
 
-void FileMux::readFile(int idx, Eigen::VectorXf& samplesEigen)
+template <typename out_type>
+void FileMux::mixSegment(Worker&             worker,
+                         long                firstBlk,
+                         long                numBlks,
+                         Eigen::RowVectorXi& dataOutput)
 {
-  if (idx == 0)
-  {
-    ifData0_.getSamples(samplesEigen);
-  }
-  else if (idx == 1)
+  long dataSize = blkSize_ * (long)files_[0].samplePerMeas;
+  long count    = numBlks * dataSize;
+  long lastBlk  = firstBlk + numBlks - 1;
+
+  Eigen::Ref<Eigen::VectorXf> mixed = worker.mixed.head(count);
+  IfData&                     ref   = *worker.inputs[0];
+  ref.setSampleCount(getSampleOffset(0) + firstBlk * dataSize);
+  ref.getSamples(mixed.data(), count);
+
+  // Add each auxilary file over the blocks of its event in this segment
+  for (int ii = 1; ii < numberOfFiles_; ii++)
   {
-    ifData1_.getSamples(samplesEigen);
+    const EventProfile& event = events_[ii - 1];
+    long                blk0  = std::max(firstBlk, event.activationBlk);
+    long                blk1  = std::min(lastBlk, event.deactivationBlk);
+    if (blk0 > blk1)
+    {
+      continue;
+    }
+
+    IfData& aux = *worker.inputs[ii];
+    aux.setSampleCount(getSampleOffset(ii) +
+                       (blk0 - event.activationBlk) * dataSize);
+    aux.getSamples(worker.samples.data(), (blk1 - blk0 + 1) * dataSize);
+    for (long blk = blk0; blk <= blk1; blk++)
+    {
+      mixed.segment((blk - firstBlk) * dataSize, dataSize) +=
+        (float)eventPower(blk, ii - 1) *
+        worker.samples.segment((blk - blk0) * dataSize, dataSize);
+    }
   }
-  else
+
+  // Scale into the range of the output data type
+  const float minValue = std::numeric_limits<out_type>::min();
+  const float maxValue = std::numeric_limits<out_type>::max();
+  dataOutput.resize(count);
+  dataOutput = (mixed * sumScale_)
+                 .cwiseMax(minValue)
+                 .cwiseMin(maxValue)
+                 .template cast<int>()
+                 .transpose();
+}
+
+bool FileMux::openFiles(Worker& worker)
+{
+  long dataSize  = blkSize_ * (long)files_[0].samplePerMeas;
+  long bufSize   = std::max<long>(segmentSize_ / dataSize, 1) * dataSize;
+  worker.samples.resize(std::max<long>(bufSize, segmentSize_));
+  worker.mixed.resize(bufSize);
+
+  worker.inputs.clear();
+  for (int idx = 0; idx < numberOfFiles_; idx++)
   {
-    ifData2_.getSamples(samplesEigen);
+    // Create setting file required by IF data class
+    if_data_utils::Settings ifSettings;
+    ifSettings.samplingFreq          = files_[idx].sampFreq;
+    ifSettings.intermediateFrequency = files_[idx].ifFreq;
+    ifSettings.bytesPerSample        = files_[idx].bytesPerSample;
+    ifSettings.complex               = files_[idx].isComplex;
+    ifSettings.sampleCountOffset     = getSampleOffset(idx);
+    ifSettings.dataFilename          = files_[idx].fileName;
+
+    worker.inputs.emplace_back(new IfData());
+    if (!worker.inputs.back()->open(ifSettings))
+    {
+      std::cout << "ERROR: Could not open " << files_[idx].fileName
+                << "!!! Exiting" << std::endl;
+      return false;
+    }
   }
+  return true;
+}
+
+uint64_t FileMux::getSampleOffset(int idx) const
+{
+  return (uint64_t)(files_[idx].skipSeconds * files_[idx].sampFreq *
+                    files_[idx].samplePerMeas);
 }
 
 }  // namespace if_data_utils
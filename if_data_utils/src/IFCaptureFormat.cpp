@@ -0,0 +1,140 @@
+//============================================================================//
+//------------------ if_data_utils/IFCaptureFormat.cpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+// This file contains the checksum and header helpers for IF capture files.
+//
+// October 16, 2026
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFCaptureFormat.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace if_data_utils
+{
+namespace
+{
+// Lookup tables for the reflected CRC-32 polynomial, eight bytes at a time
+// (slicing-by-8)
+struct Crc32Table
+{
+  Crc32Table()
+  {
+    for (uint32_t ii = 0; ii < 256; ++ii)
+    {
+      uint32_t crc = ii;
+      for (int bit = 0; bit < 8; ++bit)
+      {
+        crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+      }
+      table[0][ii] = crc;
+    }
+    for (uint32_t ii = 0; ii < 256; ++ii)
+    {
+      for (int slice = 1; slice < 8; ++slice)
+      {
+        table[slice][ii] = (table[slice - 1][ii] >> 8) ^
+                           table[0][table[slice - 1][ii] & 0xFF];
+      }
+    }
+  }
+
+  uint32_t table[8][256];
+};
+
+const Crc32Table crc32Table;
+}  // namespace
+
+uint32_t computeCrc32(const void* data, size_t numBytes, uint32_t crc)
+{
+  const uint32_t(&t)[8][256] = crc32Table.table;
+  const uint8_t* bytes       = static_cast<const uint8_t*>(data);
+
+  crc = ~crc;
+  while (numBytes >= 8)
+  {
+    uint32_t lo;
+    uint32_t hi;
+    std::memcpy(&lo, bytes, 4);
+    std::memcpy(&hi, bytes + 4, 4);
+    lo ^= crc;
+    crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^
+          t[4][lo >> 24] ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+          t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+    bytes += 8;
+    numBytes -= 8;
+  }
+  while (numBytes-- > 0)
+  {
+    crc = (crc >> 8) ^ t[0][(crc ^ *bytes++) & 0xFF];
+  }
+  return ~crc;
+}
+
+bool readIFCaptureHeader(const std::string&   filename,
+                         IFCaptureFileHeader& header,
+                         std::string&         error)
+{
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  if (!file.is_open())
+  {
+    error = "Cannot open " + filename;
+    return false;
+  }
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+  {
+    error = filename + " is too short to be a capture file";
+    return false;
+  }
+  if (std::memcmp(header.magic, ifCaptureMagic, sizeof(ifCaptureMagic)) != 0)
+  {
+    error = filename + " is not a capture file";
+    return false;
+  }
+  if (header.version != ifCaptureVersion)
+  {
+    error = filename + " has an unsupported capture file version";
+    return false;
+  }
+  if ((header.headerBytes < sizeof(header)) || (header.samplesPerChunk == 0) ||
+      (header.bytesPerSample == 0) ||
+      (header.chunkBytes < sizeof(IFCaptureChunkHeader) +
+                             header.samplesPerChunk * header.bytesPerSample))
+  {
+    error = filename + " has an inconsistent capture file header";
+    return false;
+  }
+  return true;
+}
+}  // namespace if_data_utils
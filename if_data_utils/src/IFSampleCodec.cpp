@@ -0,0 +1,628 @@
+//============================================================================//
+//------------------- if_data_utils/IFSampleCodec.cpp ----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+// This file contains the implementation of the IF sample codec.
+//
+// October 16, 2026
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/IFSampleCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace if_data_utils
+{
+namespace
+{
+// Layout of the byte that starts each frame
+const uint8_t widthBits = 0x1F;
+const uint8_t oddFlag   = 0x20;
+const uint8_t deltaFlag = 0x40;
+
+// Bits combined over the values of a frame
+struct FrameStats
+{
+  uint32_t magnitude;  // OR of each value with its sign bits cleared
+  uint32_t anyBits;    // OR of the values
+  uint32_t allBits;    // AND of the values
+};
+
+FrameStats measure(const int32_t* values, size_t numValues)
+{
+  FrameStats stats = {0, 0, ~0u};
+  size_t     ii    = 0;
+#if defined(__SSE2__)
+  __m128i magnitude = _mm_setzero_si128();
+  __m128i anyBits   = _mm_setzero_si128();
+  __m128i allBits   = _mm_set1_epi32(-1);
+  for (; ii + 4 <= numValues; ii += 4)
+  {
+    __m128i v =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + ii));
+    magnitude = _mm_or_si128(magnitude,
+                             _mm_xor_si128(v, _mm_srai_epi32(v, 31)));
+    anyBits = _mm_or_si128(anyBits, v);
+    allBits = _mm_and_si128(allBits, v);
+  }
+  uint32_t lanes[3][4];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes[0]), magnitude);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes[1]), anyBits);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes[2]), allBits);
+  for (int lane = 0; lane < 4; ++lane)
+  {
+    stats.magnitude |= lanes[0][lane];
+    stats.anyBits |= lanes[1][lane];
+    stats.allBits &= lanes[2][lane];
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    const int32_t v = values[ii];
+    stats.magnitude |= (uint32_t)(v ^ (v >> 31));
+    stats.anyBits |= (uint32_t)v;
+    stats.allBits &= (uint32_t)v;
+  }
+  return stats;
+}
+
+int bitLength(uint32_t bits)
+{
+  int length = 0;
+  while (bits)
+  {
+    ++length;
+    bits >>= 1;
+  }
+  return length;
+}
+
+// Bits needed to hold the values in two's complement (0 if all are zero)
+int signedWidth(const FrameStats& stats)
+{
+  return stats.anyBits ? bitLength(stats.magnitude) + 1 : 0;
+}
+
+void widen(const int8_t* values, size_t numValues, int32_t* wide)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 16 <= numValues; ii += 16)
+  {
+    __m128i raw =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + ii));
+    __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(raw, raw), 8);
+    __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(raw, raw), 8);
+    __m128i* out = reinterpret_cast<__m128i*>(wide + ii);
+    _mm_storeu_si128(out, _mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 16));
+    _mm_storeu_si128(out + 1,
+                     _mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 16));
+    _mm_storeu_si128(out + 2,
+                     _mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 16));
+    _mm_storeu_si128(out + 3,
+                     _mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 16));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    wide[ii] = values[ii];
+  }
+}
+
+void widen(const int16_t* values, size_t numValues, int32_t* wide)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 8 <= numValues; ii += 8)
+  {
+    __m128i raw =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + ii));
+    __m128i* out = reinterpret_cast<__m128i*>(wide + ii);
+    _mm_storeu_si128(out, _mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16));
+    _mm_storeu_si128(out + 1,
+                     _mm_srai_epi32(_mm_unpackhi_epi16(raw, raw), 16));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    wide[ii] = values[ii];
+  }
+}
+
+// the decoded values are in range, so the saturating packs are exact
+void narrow(const int32_t* wide, size_t numValues, int8_t* values)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 16 <= numValues; ii += 16)
+  {
+    const __m128i* in = reinterpret_cast<const __m128i*>(wide + ii);
+    __m128i        lo =
+      _mm_packs_epi32(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+    __m128i hi =
+      _mm_packs_epi32(_mm_loadu_si128(in + 2), _mm_loadu_si128(in + 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + ii),
+                     _mm_packs_epi16(lo, hi));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    values[ii] = static_cast<int8_t>(wide[ii]);
+  }
+}
+
+void narrow(const int32_t* wide, size_t numValues, int16_t* values)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 8 <= numValues; ii += 8)
+  {
+    const __m128i* in = reinterpret_cast<const __m128i*>(wide + ii);
+    _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(values + ii),
+      _mm_packs_epi32(_mm_loadu_si128(in), _mm_loadu_si128(in + 1)));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    values[ii] = static_cast<int16_t>(wide[ii]);
+  }
+}
+
+// Differences from the previous value of the same component (I/Q
+// interleaved), with the last two values of the previous frame in prev
+void difference(const int32_t* values,
+                size_t         numValues,
+                const int32_t  prev[2],
+                int32_t*       diff)
+{
+  size_t ii = 0;
+  for (; (ii < 2) && (ii < numValues); ++ii)
+  {
+    diff[ii] = values[ii] - prev[ii];
+  }
+#if defined(__SSE2__)
+  for (; ii + 4 <= numValues; ii += 4)
+  {
+    __m128i current =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + ii));
+    __m128i previous =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + ii - 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(diff + ii),
+                     _mm_sub_epi32(current, previous));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    diff[ii] = values[ii] - values[ii - 2];
+  }
+}
+
+// Values are packed in groups of groupValues, as four interleaved 32-bit
+// lanes: lane l holds values l, l + 4, l + 8, ... with the first value in
+// the least significant bits, so a group of width-bit values takes width
+// 16-byte words and SSE2 packs four values with each shift.
+const size_t groupValues = 128;
+
+#if defined(__SSE2__)
+// One step of a group: four values at a bit offset fixed at compile time,
+// so the steps of a group inline into straight-line code with immediate
+// shifts
+template <int width, int step>
+struct PackStep
+{
+  static void run(const int32_t* values,
+                  const __m128i& mask,
+                  __m128i&       word,
+                  uint8_t*&      packed)
+  {
+    const int fill = (step * width) % 32;
+    __m128i   v    = _mm_and_si128(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 4 * step)),
+      mask);
+    word = _mm_or_si128(word, _mm_slli_epi32(v, fill));
+    if (fill + width >= 32)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(packed), word);
+      packed += 16;
+      // the bits that did not fit start the next word
+      word = (fill + width > 32) ? _mm_srli_epi32(v, 32 - fill)
+                                 : _mm_setzero_si128();
+    }
+    PackStep<width, step + 1>::run(values, mask, word, packed);
+  }
+};
+
+template <int width>
+struct PackStep<width, groupValues / 4>
+{
+  static void run(const int32_t*, const __m128i&, __m128i&, uint8_t*&) {}
+};
+
+template <int width, int step>
+struct UnpackStep
+{
+  static void run(const uint8_t*& packed, __m128i& word, int32_t* values)
+  {
+    const int used = (step * width) % 32;
+    __m128i   v    = _mm_srli_epi32(word, used);
+    if ((used + width >= 32) && (step + 1 < (int)groupValues / 4))
+    {
+      word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed));
+      packed += 16;
+      if (used + width > 32)
+      {
+        // the value continues in the low bits of the next word
+        v = _mm_or_si128(v, _mm_slli_epi32(word, 32 - used));
+      }
+    }
+    v = _mm_srai_epi32(_mm_slli_epi32(v, 32 - width), 32 - width);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + 4 * step), v);
+    UnpackStep<width, step + 1>::run(packed, word, values);
+  }
+};
+
+template <int width>
+struct UnpackStep<width, groupValues / 4>
+{
+  static void run(const uint8_t*&, __m128i&, int32_t*) {}
+};
+
+template <int width>
+void packGroupsOf(const int32_t* values, size_t numGroups, uint8_t* packed)
+{
+  const __m128i mask = _mm_set1_epi32((1u << width) - 1);
+  for (size_t group = 0; group < numGroups; ++group)
+  {
+    __m128i word = _mm_setzero_si128();
+    PackStep<width, 0>::run(values, mask, word, packed);
+    values += groupValues;
+  }
+}
+
+template <int width>
+void unpackGroupsOf(const uint8_t* packed, size_t numGroups, int32_t* values)
+{
+  for (size_t group = 0; group < numGroups; ++group)
+  {
+    __m128i word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed));
+    packed += 16;
+    UnpackStep<width, 0>::run(packed, word, values);
+    values += groupValues;
+  }
+}
+
+typedef void (*PackFunction)(const int32_t*, size_t, uint8_t*);
+typedef void (*UnpackFunction)(const uint8_t*, size_t, int32_t*);
+
+const PackFunction packers[17] = {
+  nullptr,           &packGroupsOf<1>,  &packGroupsOf<2>,  &packGroupsOf<3>,
+  &packGroupsOf<4>,  &packGroupsOf<5>,  &packGroupsOf<6>,  &packGroupsOf<7>,
+  &packGroupsOf<8>,  &packGroupsOf<9>,  &packGroupsOf<10>, &packGroupsOf<11>,
+  &packGroupsOf<12>, &packGroupsOf<13>, &packGroupsOf<14>, &packGroupsOf<15>,
+  &packGroupsOf<16>};
+
+const UnpackFunction unpackers[17] = {
+  nullptr,             &unpackGroupsOf<1>,  &unpackGroupsOf<2>,
+  &unpackGroupsOf<3>,  &unpackGroupsOf<4>,  &unpackGroupsOf<5>,
+  &unpackGroupsOf<6>,  &unpackGroupsOf<7>,  &unpackGroupsOf<8>,
+  &unpackGroupsOf<9>,  &unpackGroupsOf<10>, &unpackGroupsOf<11>,
+  &unpackGroupsOf<12>, &unpackGroupsOf<13>, &unpackGroupsOf<14>,
+  &unpackGroupsOf<15>, &unpackGroupsOf<16>};
+#endif
+
+// Packs whole groups of values
+void packGroups(const int32_t* values,
+                size_t         numGroups,
+                int            width,
+                uint8_t*       packed)
+{
+#if defined(__SSE2__)
+  packers[width](values, numGroups, packed);
+#else
+  const uint32_t mask = (1u << width) - 1;
+  for (size_t group = 0; group < numGroups; ++group)
+  {
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+      uint64_t bits = 0;
+      int      fill = 0;
+      uint8_t* word = packed + 4 * lane;
+      for (size_t ii = lane; ii < groupValues; ii += 4)
+      {
+        bits |= (uint64_t)((uint32_t)values[ii] & mask) << fill;
+        fill += width;
+        if (fill >= 32)
+        {
+          const uint32_t low = (uint32_t)bits;
+          std::memcpy(word, &low, sizeof(low));
+          word += 16;
+          bits >>= 32;
+          fill -= 32;
+        }
+      }
+    }
+    values += groupValues;
+    packed += 16 * width;
+  }
+#endif
+}
+
+// Reverses packGroups(), sign extending each value
+void unpackGroups(const uint8_t* packed,
+                  size_t         numGroups,
+                  int            width,
+                  int32_t*       values)
+{
+#if defined(__SSE2__)
+  unpackers[width](packed, numGroups, values);
+#else
+  for (size_t group = 0; group < numGroups; ++group)
+  {
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+      uint64_t       bits  = 0;
+      int            avail = 0;
+      const uint8_t* word  = packed + 4 * lane;
+      for (size_t ii = lane; ii < groupValues; ii += 4)
+      {
+        if (avail < width)
+        {
+          uint32_t next;
+          std::memcpy(&next, word, sizeof(next));
+          word += 16;
+          bits |= (uint64_t)next << avail;
+          avail += 32;
+        }
+        values[ii] =
+          (int32_t)((uint32_t)bits << (32 - width)) >> (32 - width);
+        bits >>= width;
+        avail -= width;
+      }
+    }
+    values += groupValues;
+    packed += 16 * width;
+  }
+#endif
+}
+
+// Maps odd values onto consecutive integers (v = 2 * h + 1)
+void halve(int32_t* values, size_t numValues)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 4 <= numValues; ii += 4)
+  {
+    __m128i* v = reinterpret_cast<__m128i*>(values + ii);
+    _mm_storeu_si128(v, _mm_srai_epi32(_mm_loadu_si128(v), 1));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    values[ii] >>= 1;
+  }
+}
+
+// Reverses halve()
+void restoreOdd(int32_t* values, size_t numValues)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  const __m128i one = _mm_set1_epi32(1);
+  for (; ii + 4 <= numValues; ii += 4)
+  {
+    __m128i* v = reinterpret_cast<__m128i*>(values + ii);
+    _mm_storeu_si128(
+      v, _mm_or_si128(_mm_slli_epi32(_mm_loadu_si128(v), 1), one));
+  }
+#endif
+  for (; ii < numValues; ++ii)
+  {
+    values[ii] = values[ii] * 2 + 1;
+  }
+}
+
+template <typename value_type>
+size_t encodeFrames(const value_type*    values,
+                    size_t               numValues,
+                    const IFCompression& compression,
+                    uint8_t*             encoded)
+{
+  int32_t  raw[ifCodecFrameValues];
+  int32_t  diff[ifCodecFrameValues];
+  int32_t  prev[2] = {0, 0};
+  uint8_t* out     = encoded;
+
+  for (size_t first = 0; first < numValues; first += ifCodecFrameValues)
+  {
+    const size_t count  = std::min(ifCodecFrameValues, numValues - first);
+    const size_t padded =
+      (count + groupValues - 1) / groupValues * groupValues;
+    widen(values + first, count, raw);
+
+    // start with plain packing and keep any transform that needs fewer bits
+    const FrameStats stats = measure(raw, count);
+    int              width = signedWidth(stats);
+    uint8_t          tag   = 0;
+    int32_t*         coded = raw;
+    if ((stats.allBits & 1) && (bitLength(stats.magnitude >> 1) + 1 < width))
+    {
+      width = bitLength(stats.magnitude >> 1) + 1;
+      tag   = oddFlag;
+    }
+    if (compression == IFCompression::Delta)
+    {
+      difference(raw, count, prev, diff);
+      const int diffWidth = signedWidth(measure(diff, count));
+      if (diffWidth < width)
+      {
+        width = diffWidth;
+        tag   = deltaFlag;
+        coded = diff;
+      }
+      if (count >= 2)
+      {
+        prev[0] = raw[count - 2];
+        prev[1] = raw[count - 1];
+      }
+    }
+    if (tag == oddFlag)
+    {
+      halve(raw, count);
+    }
+
+    *out++ = tag | (uint8_t)width;
+    if (width > 0)
+    {
+      std::fill(coded + count, coded + padded, 0);
+      packGroups(coded, padded / groupValues, width, out);
+      out += padded / groupValues * 16 * width;
+    }
+  }
+  return out - encoded;
+}
+
+template <typename value_type>
+size_t decodeFrames(const uint8_t* encoded,
+                    size_t         numBytes,
+                    value_type*    values,
+                    size_t         numValues)
+{
+  const int      maxWidth = 8 * sizeof(value_type);
+  int32_t        coded[ifCodecFrameValues];
+  int32_t        prev[2] = {0, 0};
+  const uint8_t* in      = encoded;
+  const uint8_t* end     = encoded + numBytes;
+
+  for (size_t first = 0; first < numValues; first += ifCodecFrameValues)
+  {
+    const size_t count  = std::min(ifCodecFrameValues, numValues - first);
+    const size_t padded =
+      (count + groupValues - 1) / groupValues * groupValues;
+    if (in == end)
+    {
+      return 0;
+    }
+    const uint8_t tag   = *in++;
+    const int     width = tag & widthBits;
+    const size_t  bytes = padded / groupValues * 16 * width;
+    if ((width > maxWidth) || (tag & ~(widthBits | oddFlag | deltaFlag)) ||
+        ((tag & oddFlag) && (tag & deltaFlag)) ||
+        ((size_t)(end - in) < bytes))
+    {
+      return 0;
+    }
+
+    if (width > 0)
+    {
+      unpackGroups(in, padded / groupValues, width, coded);
+    }
+    else
+    {
+      std::fill(coded, coded + count, 0);
+    }
+    in += bytes;
+
+    if (tag & oddFlag)
+    {
+      restoreOdd(coded, count);
+    }
+    else if (tag & deltaFlag)
+    {
+      for (size_t ii = 0; (ii < 2) && (ii < count); ++ii)
+      {
+        coded[ii] += prev[ii];
+      }
+      for (size_t ii = 2; ii < count; ++ii)
+      {
+        coded[ii] += coded[ii - 2];
+      }
+    }
+    if (count >= 2)
+    {
+      prev[0] = coded[count - 2];
+      prev[1] = coded[count - 1];
+    }
+    narrow(coded, count, values + first);
+  }
+  return in - encoded;
+}
+}  // namespace
+
+size_t maxEncodedBytes(size_t numValues, size_t bytesPerValue)
+{
+  const size_t fullFrames = numValues / ifCodecFrameValues;
+  const size_t remainder  = numValues % ifCodecFrameValues;
+  const size_t numFrames  = fullFrames + (remainder > 0);
+  const size_t padded =
+    (remainder + groupValues - 1) / groupValues * groupValues;
+  return numFrames +
+         bytesPerValue * (fullFrames * ifCodecFrameValues + padded);
+}
+
+size_t encodeValues(const int8_t*        values,
+                    size_t               numValues,
+                    const IFCompression& compression,
+                    uint8_t*             encoded)
+{
+  return encodeFrames(values, numValues, compression, encoded);
+}
+
+size_t encodeValues(const int16_t*       values,
+                    size_t               numValues,
+                    const IFCompression& compression,
+                    uint8_t*             encoded)
+{
+  return encodeFrames(values, numValues, compression, encoded);
+}
+
+size_t decodeValues(const uint8_t* encoded,
+                    size_t         numBytes,
+                    int8_t*        values,
+                    size_t         numValues)
+{
+  return decodeFrames(encoded, numBytes, values, numValues);
+}
+
+size_t decodeValues(const uint8_t* encoded,
+                    size_t         numBytes,
+                    int16_t*       values,
+                    size_t         numValues)
+{
+  return decodeFrames(encoded, numBytes, values, numValues);
+}
+}  // namespace if_data_utils
@@ -37,35 +37,202 @@
 // May 27, 2015
 //
 //===----------------------------------------------------------------------===//
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "if_data_utils/IfData.hpp"
 
 namespace if_data_utils
 {
+namespace
+{
+// MAX2769 2-bit sign/magnitude codes mapped to signed values
+const int8_t sc2Levels[4] = {1, 3, -1, -3};
+
+// Every possible 2-bit data byte decoded to its four samples, least
+// significant pair first
+struct Sc2Table
+{
+  Sc2Table()
+  {
+    for (int byte = 0; byte < 256; ++byte)
+    {
+      for (int ii = 0; ii < 4; ++ii)
+      {
+        samples[byte][ii] = sc2Levels[(byte >> (ii * 2)) & 0x03];
+      }
+    }
+  }
+
+  float samples[256][4];
+};
+
+const Sc2Table sc2Table;
+
+void decodeSc2(const uint8_t* bytes, size_t numBytes, float* samples)
+{
+  for (size_t ii = 0; ii < numBytes; ++ii)
+  {
+    std::memcpy(samples + 4 * ii, sc2Table.samples[bytes[ii]],
+                sizeof(sc2Table.samples[0]));
+  }
+}
+
+void widenSc8(const uint8_t* bytes, size_t numSamples, float* samples)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 16 <= numSamples; ii += 16)
+  {
+    __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + ii));
+    // sign extend by placing each byte in the top of a wider lane and
+    // shifting it back down arithmetically
+    __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(raw, raw), 8);
+    __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(raw, raw), 8);
+    _mm_storeu_ps(samples + ii, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                  _mm_unpacklo_epi16(lo16, lo16), 16)));
+    _mm_storeu_ps(samples + ii + 4, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                      _mm_unpackhi_epi16(lo16, lo16), 16)));
+    _mm_storeu_ps(samples + ii + 8, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                      _mm_unpacklo_epi16(hi16, hi16), 16)));
+    _mm_storeu_ps(samples + ii + 12, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                       _mm_unpackhi_epi16(hi16, hi16), 16)));
+  }
+#endif
+  for (; ii < numSamples; ++ii)
+  {
+    samples[ii] = static_cast<float>(static_cast<int8_t>(bytes[ii]));
+  }
+}
+
+void widenSc16(const uint8_t* bytes, size_t numSamples, float* samples)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  for (; ii + 8 <= numSamples; ii += 8)
+  {
+    __m128i raw =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 2 * ii));
+    _mm_storeu_ps(samples + ii, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                  _mm_unpacklo_epi16(raw, raw), 16)));
+    _mm_storeu_ps(samples + ii + 4, _mm_cvtepi32_ps(_mm_srai_epi32(
+                                      _mm_unpackhi_epi16(raw, raw), 16)));
+  }
+#endif
+  for (; ii < numSamples; ++ii)
+  {
+    int16_t sample;
+    std::memcpy(&sample, bytes + 2 * ii, sizeof(sample));
+    samples[ii] = static_cast<float>(sample);
+  }
+}
+
+void narrowTo8(const int32_t* samples, size_t numSamples, uint8_t* bytes)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  // masking to the low byte first keeps the saturating packs exact, so the
+  // result is the truncation the scalar loop produces
+  const __m128i lowByte = _mm_set1_epi32(0xFF);
+  for (; ii + 16 <= numSamples; ii += 16)
+  {
+    const __m128i* in = reinterpret_cast<const __m128i*>(samples + ii);
+    __m128i s0 = _mm_and_si128(_mm_loadu_si128(in), lowByte);
+    __m128i s1 = _mm_and_si128(_mm_loadu_si128(in + 1), lowByte);
+    __m128i s2 = _mm_and_si128(_mm_loadu_si128(in + 2), lowByte);
+    __m128i s3 = _mm_and_si128(_mm_loadu_si128(in + 3), lowByte);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + ii),
+                     _mm_packus_epi16(_mm_packs_epi32(s0, s1),
+                                      _mm_packs_epi32(s2, s3)));
+  }
+#endif
+  for (; ii < numSamples; ++ii)
+  {
+    bytes[ii] = static_cast<uint8_t>(samples[ii]);
+  }
+}
+
+void narrowTo16(const int32_t* samples, size_t numSamples, uint8_t* bytes)
+{
+  size_t ii = 0;
+#if defined(__SSE2__)
+  // sign extending the low half first keeps the saturating pack exact
+  for (; ii + 8 <= numSamples; ii += 8)
+  {
+    const __m128i* in = reinterpret_cast<const __m128i*>(samples + ii);
+    __m128i s0 = _mm_srai_epi32(_mm_slli_epi32(_mm_loadu_si128(in), 16), 16);
+    __m128i s1 =
+      _mm_srai_epi32(_mm_slli_epi32(_mm_loadu_si128(in + 1), 16), 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + 2 * ii),
+                     _mm_packs_epi32(s0, s1));
+  }
+#endif
+  for (; ii < numSamples; ++ii)
+  {
+    int16_t sample = static_cast<int16_t>(samples[ii]);
+    std::memcpy(bytes + 2 * ii, &sample, sizeof(sample));
+  }
+}
+}  // namespace
+
 void convertSampleToSigned(uint8_t byte, int8_t samples[4])
 {
-  uint8_t mask = 0x03;
   for (int ii = 0; ii < 4; ii++)
   {
-    uint8_t sample = (byte & mask) >> (ii * 2);
-    mask           = mask << 2;
+    samples[ii] = sc2Levels[(byte >> (ii * 2)) & 0x03];
+  }
+}
 
-    // convert to signed integer
-    if (sample == 1)
-      samples[ii] = 3;
-    else if (sample == 0)
-      samples[ii] = 1;
-    else if (sample == 2)
-      samples[ii] = -1;
-    else
-      samples[ii] = -3;
+void narrowSamples(const int32_t* samples,
+                   size_t         numSamples,
+                   size_t         bytesPerSample,
+                   uint8_t*       bytes)
+{
+  if (bytesPerSample == 1)
+  {
+    narrowTo8(samples, numSamples, bytes);
+  }
+  else if (bytesPerSample == 2)
+  {
+    narrowTo16(samples, numSamples, bytes);
+  }
+  else if (bytesPerSample == sizeof(int32_t))
+  {
+    std::memcpy(bytes, samples, numSamples * sizeof(int32_t));
+  }
+  else
+  {
+    // odd sizes keep the low-order bytes, zero padded past the sample
+    size_t copyBytes = std::min(bytesPerSample, sizeof(int32_t));
+    for (size_t ii = 0; ii < numSamples; ++ii)
+    {
+      uint8_t* out = bytes + ii * bytesPerSample;
+      std::memset(out, 0, bytesPerSample);
+      for (size_t jj = 0; jj < copyBytes; ++jj)
+      {
+        out[jj] = static_cast<uint8_t>(
+          static_cast<uint32_t>(samples[ii]) >> (8 * jj));
+      }
+    }
   }
 }
 
 IfData::IfData()
-  : sampleCount_(0), filesize_(0), samplesPerRead_(0), bytesPerRead_(0)
+  : format_(SampleFormat::SC8),
+    sampleCount_(0),
+    filesize_(0),
+    samplesPerRead_(0),
+    bytesPerRead_(0),
+    leftoverSamples_(),
+    leftoverHead_(0),
+    leftoverCount_(0)
 {
 }
 
@@ -78,6 +245,27 @@ bool IfData::open(Settings settings)
 {
   settings_ = std::move(settings);
 
+  // anything other than 2-bit, 16-bit or float data is read a byte per
+  // sample
+  if (settings_.bytesPerSample == 0.25)
+  {
+    format_ = SampleFormat::SC2;
+  }
+  else if (settings_.bytesPerSample == 2)
+  {
+    format_ = SampleFormat::SC16;
+  }
+  else if (settings_.bytesPerSample == sizeof(float))
+  {
+    format_ = SampleFormat::FC32;
+  }
+  else
+  {
+    format_ = SampleFormat::SC8;
+  }
+  leftoverHead_  = 0;
+  leftoverCount_ = 0;
+
   try
   {
     // log_("Opening IF data file.", logutils::LogLevel::Info);
@@ -95,7 +283,7 @@ bool IfData::open(Settings settings)
 
     // log_(settingsOut.str(), logutils::LogLevel::Info);
 
-    samplesFile_.open(settings_.dataFilename);
+    samplesFile_.open(settings_.dataFilename, std::ios::in | std::ios::binary);
 
     if (!samplesFile_.is_open())
     {
@@ -133,10 +321,28 @@ void IfData::openOutFile(const std::string& metadataFilename)
 void IfData::writeSamples(Eigen::RowVectorXi& samplesEigen,
                           std::size_t         sampleSize)
 {
-  for (int ii = 0; ii < samplesEigen.size(); ii++)
+  size_t numSamples = samplesEigen.size();
+  size_t numBytes   = numSamples * sampleSize;
+  if (numBytes == 0)
   {
-    outFile_.write((char*)&samplesEigen[ii], sampleSize);
+    return;
   }
+  if (writeBuffer_.size() < numBytes)
+  {
+    writeBuffer_.resize(numBytes);
+  }
+
+  // narrow the whole block and hand it to the stream in one write
+  narrowSamples(samplesEigen.data(), numSamples, sampleSize,
+                writeBuffer_.data());
+  outFile_.write(reinterpret_cast<const char*>(writeBuffer_.data()),
+                 numBytes);
+}
+
+void IfData::writeSamples(const float* samples, std::size_t numSamples)
+{
+  outFile_.write(reinterpret_cast<const char*>(samples),
+                 numSamples * sizeof(float));
 }
 
 void IfData::close()
@@ -145,135 +351,165 @@ void IfData::close()
   {
     samplesFile_.close();
   }
+  if (outFile_.is_open())
+  {
+    outFile_.close();
+  }
+}
+
+size_t IfData::bytesForSamples(size_t numSamples) const
+{
+  switch (format_)
+  {
+    case SampleFormat::SC2:
+      return (numSamples + 3) / 4;
+    case SampleFormat::SC16:
+      return numSamples * 2;
+    case SampleFormat::FC32:
+      return numSamples * sizeof(float);
+    default:
+      return numSamples;
+  }
 }
 
 uint64_t IfData::getSamples(Eigen::VectorXf& samplesEigen)
 {
-  size_t numSamples       = samplesEigen.size();  // number of samples to read
-  size_t samplesFromQueue = 0;  // samples to read from the leftover queue
-  size_t bytesFromFile    = 0;  // bytes to read from the file
-  size_t samplesRead      = 0;  // samples read so far
+  return getSamples(samplesEigen.data(), samplesEigen.size());
+}
 
-  uint64_t initialSampleCount = sampleCount_;
+uint64_t IfData::getSamples(float* samples, size_t numSamples)
+{
+  size_t samplesRead = 0;  // samples read so far
 
-  // determine number of bytes to read from queue and file
-  if (leftoverSamples_.size() > numSamples)
-  {
-    samplesFromQueue = numSamples;
-    bytesFromFile    = 0;
-  }
-  else
-  {
-    samplesFromQueue = leftoverSamples_.size();
-    bytesFromFile =
-      ceil((numSamples - leftoverSamples_.size()) * settings_.bytesPerSample);
-  }
+  uint64_t initialSampleCount = sampleCount_;
 
   // read any data from the leftover buffer before reading from the file
-  for (size_t ii = 0; ii < samplesFromQueue; ii++)
+  while (samplesRead < numSamples && leftoverCount_ > 0)
   {
-    samplesEigen[samplesRead++] = leftoverSamples_.front();
-    leftoverSamples_.pop();
-    sampleCount_++;
-    // std::cout << "Reading buffered sample." << std::endl;
+    samples[samplesRead++] = leftoverSamples_[leftoverHead_];
+    leftoverHead_          = (leftoverHead_ + 1) % leftoverSamples_.size();
+    --leftoverCount_;
   }
 
-  // see if we also need to read data from the file
-  if (bytesFromFile == 0)
+  size_t samplesWanted = numSamples - samplesRead;
+  size_t bytesFromFile = bytesForSamples(samplesWanted);
+
+  if ((bytesFromFile > 0) && (format_ == SampleFormat::FC32))
   {
-    return initialSampleCount;
+    // float samples are already in the output format, so they are read
+    // straight into the caller's storage
+    samplesFile_.read(reinterpret_cast<char*>(samples + samplesRead),
+                      bytesFromFile);
+    samplesRead += static_cast<size_t>(samplesFile_.gcount()) / sizeof(float);
   }
-
-  char* readData = new char[bytesFromFile];
-  try
+  else if (bytesFromFile > 0)
   {
-    uint16_t temp = 0;
-    samplesFile_.read(readData, bytesFromFile);
-    // convert samples to vector of floats
-    for (size_t ii = 0; ii < bytesFromFile; ii++)
+    if (readBuffer_.size() < bytesFromFile)
     {
-      int     samplesPerByte = 1 / settings_.bytesPerSample;
-      int8_t* samples        = new int8_t[samplesPerByte];
-      if (samplesPerByte == 4)
-      {
-        // std::cout << "Byte read: 0x" << std::hex << (int)readData[ii] <<
-        // std::endl;
-        if_data_utils::convertSampleToSigned(readData[ii], samples);
-        for (size_t jj = 0; jj < 4; jj++)
-        {
-          // see if we've read all the samples that we've been asked for
-          // if not, read another sample
-          // if so, store the remaining data in the buffer for next time
-          if (samplesRead < numSamples)
-          {
-            samplesEigen[samplesRead++] = (float)samples[jj];
-            sampleCount_++;
-            // std::cout << "Count: " << std::dec << sampleCount_ << " Sample: "
-            // << (float)samples[jj] << std::endl;
-          }
-          else
-          {
-            leftoverSamples_.push((float)samples[jj]);
-            // std::cout << "Buffering sample." << std::endl;
-          }
-        }
-      }
-      else if (settings_.bytesPerSample == 2)
-      {
-        int idx = ii % 2;
-        if (idx == 0)
-        {
-          // first byte
-          temp = readData[ii];
-        }
-        else
-        {
-          // second byte
-          temp                        = (temp << 8) | readData[ii];
-          samplesEigen[samplesRead++] = (float)temp;
-          sampleCount_++;
-        }
-      }
-      else
+      readBuffer_.resize(bytesFromFile);
+    }
+
+    samplesFile_.read(reinterpret_cast<char*>(readBuffer_.data()),
+                      bytesFromFile);
+    size_t bytesRead = static_cast<size_t>(samplesFile_.gcount());
+
+    const uint8_t* bytes = readBuffer_.data();
+    float*         out   = samples + samplesRead;
+    if (format_ == SampleFormat::SC2)
+    {
+      size_t available = std::min(samplesWanted, bytesRead * 4);
+      size_t fullBytes = available / 4;
+      decodeSc2(bytes, fullBytes, out);
+      size_t partial = available - fullBytes * 4;
+      if (partial > 0)
       {
-        // see if we've read all the samples that we've been asked for
-        // if so, store the remaining data in the buffer for next time
-        if (samplesRead < numSamples)
-        {
-          samplesEigen[samplesRead++] = (float)readData[ii];
-          sampleCount_++;
-        }
-        else
-        {
-          std::cout << "Error: we read too much data!" << std::endl;
-        }
+        // the final byte holds more samples than were asked for, so keep
+        // the rest for next time (the ring was emptied above)
+        const float* last = sc2Table.samples[bytes[fullBytes]];
+        std::copy(last, last + partial, out + fullBytes * 4);
+        std::copy(last + partial, last + 4, leftoverSamples_.begin());
+        leftoverHead_  = 0;
+        leftoverCount_ = 4 - partial;
       }
-      delete[] samples;
+      samplesRead += available;
+    }
+    else if (format_ == SampleFormat::SC16)
+    {
+      widenSc16(bytes, bytesRead / 2, out);
+      samplesRead += bytesRead / 2;
+    }
+    else
+    {
+      widenSc8(bytes, bytesRead, out);
+      samplesRead += bytesRead;
     }
   }
-  catch (std::exception& e)
-  {
-    std::cout << "Error getting IF sample: " << e.what() << std::endl;
-  }
-  delete[] readData;
 
-  return sampleCount_;
+  sampleCount_ += samplesRead;
+
+  // pad a short read at the end of the file
+  std::fill(samples + samplesRead, samples + numSamples, 0.0f);
+
+  return initialSampleCount;
 }
 
 /// Moves the file pointer to the given sample count value
 bool IfData::setSampleCount(uint64_t sampleCount)
 {
-  //    size_t offset = sampleCount - sampleCount_;
-  samplesFile_.seekg(sampleCount, samplesFile_.beg);
-  sampleCount_ = sampleCount;
+  // 2-bit samples may start part way through a byte
+  size_t sampleInByte = 0;
+  if (format_ == SampleFormat::SC2)
+  {
+    sampleInByte = sampleCount % 4;
+  }
+
+  samplesFile_.clear();
+  samplesFile_.seekg(bytesForSamples(sampleCount - sampleInByte),
+                     samplesFile_.beg);
+  sampleCount_   = sampleCount;
+  leftoverCount_ = 0;
+
+  if (sampleInByte > 0)
+  {
+    char byte = 0;
+    samplesFile_.read(&byte, 1);
+    const float* decoded = sc2Table.samples[static_cast<uint8_t>(byte)];
+    std::copy(decoded + sampleInByte, decoded + 4, leftoverSamples_.begin());
+    leftoverHead_  = 0;
+    leftoverCount_ = 4 - sampleInByte;
+  }
   return !samplesFile_.eof();
 }
 
 bool IfData::skipSamples(size_t numSamples)
 {
-  size_t bytesToSkip = numSamples * settings_.bytesPerSample;
-  samplesFile_.seekg(bytesToSkip, std::ios_base::cur);
+  // samples already read from the file are skipped first
+  size_t fromLeftover = std::min(numSamples, leftoverCount_);
+  leftoverHead_ = (leftoverHead_ + fromLeftover) % leftoverSamples_.size();
+  leftoverCount_ -= fromLeftover;
+  sampleCount_ += fromLeftover;
+  numSamples -= fromLeftover;
+
+  // 2-bit samples may end part way through a byte
+  size_t sampleInByte = 0;
+  if (format_ == SampleFormat::SC2)
+  {
+    sampleInByte = numSamples % 4;
+  }
+
+  samplesFile_.seekg(bytesForSamples(numSamples - sampleInByte),
+                     std::ios_base::cur);
   sampleCount_ += numSamples;
+
+  if (sampleInByte > 0)
+  {
+    char byte = 0;
+    samplesFile_.read(&byte, 1);
+    const float* decoded = sc2Table.samples[static_cast<uint8_t>(byte)];
+    std::copy(decoded + sampleInByte, decoded + 4, leftoverSamples_.begin());
+    leftoverHead_  = 0;
+    leftoverCount_ = 4 - sampleInByte;
+  }
   return !samplesFile_.eof();
 }
 
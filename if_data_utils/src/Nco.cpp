@@ -0,0 +1,90 @@
+//============================================================================//
+//-------------------------- if_data_utils/Nco.cpp -------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+// This file contains the definition of the Nco class.
+//
+// October 16, 2026
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/Nco.hpp"
+
+#include <cmath>
+
+namespace if_data_utils
+{
+namespace
+{
+const double twoPi = 6.283185307179586476925286766559;
+}
+
+Nco::Nco() : phase_(0.0), phaseStep_(0.0)
+{
+}
+
+void Nco::configure(double frequency, double sampFreq, size_t maxBlockSize)
+{
+  phaseStep_ = std::fmod(twoPi * frequency / sampFreq, twoPi);
+  phase_     = 0.0;
+
+  stepCos_.resize(maxBlockSize);
+  stepSin_.resize(maxBlockSize);
+  for (size_t ii = 0; ii < maxBlockSize; ++ii)
+  {
+    // reduce in double precision before rounding to float
+    double phase = std::fmod(phaseStep_ * ii, twoPi);
+    stepCos_[ii] = static_cast<float>(std::cos(phase));
+    stepSin_[ii] = static_cast<float>(std::sin(phase));
+  }
+}
+
+void Nco::reset(double phase)
+{
+  phase_ = std::fmod(phase, twoPi);
+}
+
+void Nco::generate(size_t numSamples, float* cosine, float* sine)
+{
+  const float startCos = static_cast<float>(std::cos(phase_));
+  const float startSin = static_cast<float>(std::sin(phase_));
+
+  // rotate the table by the phase at the start of the block
+  Eigen::Map<Eigen::ArrayXf> outCos(cosine, numSamples);
+  Eigen::Map<Eigen::ArrayXf> outSin(sine, numSamples);
+  outCos = startCos * stepCos_.head(numSamples) -
+           startSin * stepSin_.head(numSamples);
+  outSin = startSin * stepCos_.head(numSamples) +
+           startCos * stepSin_.head(numSamples);
+
+  phase_ = std::fmod(phase_ + phaseStep_ * numSamples, twoPi);
+}
+}  // namespace if_data_utils
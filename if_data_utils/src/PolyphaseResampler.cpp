@@ -0,0 +1,176 @@
+//============================================================================//
+//---------------- if_data_utils/PolyphaseResampler.cpp --------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//===----------------------------------------------------------------------===//
+// This file contains the definition of the PolyphaseResampler class.
+//
+// October 16, 2026
+//
+//===----------------------------------------------------------------------===//
+#include "if_data_utils/PolyphaseResampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace if_data_utils
+{
+namespace
+{
+const double pi = 3.14159265358979323846;
+
+// keeps the branch matrix to a few megabytes
+const size_t maxFilterLength = 1 << 20;
+
+unsigned greatestCommonDivisor(unsigned a, unsigned b)
+{
+  while (b != 0)
+  {
+    unsigned r = a % b;
+    a          = b;
+    b          = r;
+  }
+  return a;
+}
+}  // namespace
+
+PolyphaseResampler::PolyphaseResampler()
+  : interpolation_(1), decimation_(1), tapsPerPhase_(1), index_(0), phase_(0)
+{
+  coeffs_.setOnes(1, 1);
+}
+
+bool PolyphaseResampler::configure(unsigned interpolation,
+                                   unsigned decimation,
+                                   size_t   maxInputs,
+                                   unsigned tapsPerPhase)
+{
+  if ((interpolation == 0) || (decimation == 0) || (tapsPerPhase == 0))
+  {
+    return false;
+  }
+  unsigned divisor = greatestCommonDivisor(interpolation, decimation);
+  interpolation /= divisor;
+  decimation /= divisor;
+  if ((size_t)interpolation * tapsPerPhase > maxFilterLength)
+  {
+    return false;
+  }
+
+  interpolation_ = interpolation;
+  decimation_    = decimation;
+  tapsPerPhase_  = tapsPerPhase;
+
+  // Blackman windowed sinc at the upsampled rate, cut off below the lower
+  // of the two Nyquist frequencies
+  size_t length = (size_t)interpolation_ * tapsPerPhase_;
+  double cutoff = 0.45 / std::max(interpolation_, decimation_);
+  double center = (length - 1) / 2.0;
+  Eigen::VectorXd prototype(length);
+  for (size_t ii = 0; ii < length; ++ii)
+  {
+    double t      = ii - center;
+    double sinc   = (t == 0.0) ? 1.0 : std::sin(2 * pi * cutoff * t) /
+                                       (2 * pi * cutoff * t);
+    double window = 0.42 -
+                    0.5 * std::cos(2 * pi * (ii + 0.5) / length) +
+                    0.08 * std::cos(4 * pi * (ii + 0.5) / length);
+    prototype[ii] = sinc * window;
+  }
+  // unity gain through each branch on average
+  prototype *= interpolation_ / prototype.sum();
+
+  // tap k of branch p multiplies the sample k steps before the newest one
+  coeffs_.resize(tapsPerPhase_, interpolation_);
+  for (unsigned p = 0; p < interpolation_; ++p)
+  {
+    for (unsigned k = 0; k < tapsPerPhase_; ++k)
+    {
+      coeffs_(tapsPerPhase_ - 1 - k, p) =
+        static_cast<float>(prototype[p + (size_t)k * interpolation_]);
+    }
+  }
+
+  bufferI_.resize(tapsPerPhase_ - 1 + maxInputs);
+  bufferQ_.resize(tapsPerPhase_ - 1 + maxInputs);
+  reset();
+  return true;
+}
+
+void PolyphaseResampler::reset()
+{
+  bufferI_.setZero();
+  bufferQ_.setZero();
+  index_ = tapsPerPhase_ - 1;
+  phase_ = 0;
+}
+
+size_t PolyphaseResampler::getMaxOutputs(size_t numInputs) const
+{
+  return (numInputs * interpolation_) / decimation_ + 1;
+}
+
+size_t PolyphaseResampler::process(const float* input,
+                                   size_t       numInputs,
+                                   float*       output)
+{
+  size_t history = tapsPerPhase_ - 1;
+  size_t end     = history + numInputs;
+  for (size_t ii = 0; ii < numInputs; ++ii)
+  {
+    bufferI_[history + ii] = input[2 * ii];
+    bufferQ_[history + ii] = input[2 * ii + 1];
+  }
+
+  size_t numOutputs = 0;
+  while (index_ < end)
+  {
+    size_t first               = index_ - history;
+    output[2 * numOutputs]     = coeffs_.col(phase_).dot(
+      bufferI_.segment(first, tapsPerPhase_));
+    output[2 * numOutputs + 1] = coeffs_.col(phase_).dot(
+      bufferQ_.segment(first, tapsPerPhase_));
+    ++numOutputs;
+
+    phase_ += decimation_;
+    index_ += phase_ / interpolation_;
+    phase_ %= interpolation_;
+  }
+
+  // keep the newest samples as the history for the next call
+  std::copy(bufferI_.data() + end - history, bufferI_.data() + end,
+            bufferI_.data());
+  std::copy(bufferQ_.data() + end - history, bufferQ_.data() + end,
+            bufferQ_.data());
+  index_ -= numInputs;
+  return numOutputs;
+}
+}  // namespace if_data_utils
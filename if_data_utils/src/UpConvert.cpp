@@ -39,32 +39,48 @@
 //===----------------------------------------------------------------------===//
 
 #include "if_data_utils/UpConvert.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <utility>
 
 namespace if_data_utils
 {
+namespace
+{
+// The sample magnitude that corresponds to full scale in each data format
+float fullScale(const std::string& dataFormat)
+{
+  if (dataFormat == "sc2")
+  {
+    return 4.f;
+  }
+  else if (dataFormat == "sc16")
+  {
+    return 32768.f;
+  }
+  else if (dataFormat == "fc32")
+  {
+    return 1.f;
+  }
+  return 128.f;
+}
+}  // namespace
+
 // Class constructor
 UpConvert::UpConvert()
+  : outputIf_(0.0),
+    outputIfSet_(false),
+    outputSampFreq_(0.0),
+    outputComplex_(false),
+    gain_(1.f),
+    scale_(1.f),
+    resample_(false)
 {
   // Declare block size
   blkSize_ = 20000;
-
-  // Generate mixing sine and cosine wave at creation of class object
-  mixSine_.reserve(blkSize_);
-  mixCos_.reserve(blkSize_);
-  for (int ii = 0; ii < blkSize_; ii = ii + 4)
-  {
-    mixSine_.push_back(0);
-    mixSine_.push_back(1);
-    mixSine_.push_back(0);
-    mixSine_.push_back(-1);
-
-    mixCos_.push_back(1);
-    mixCos_.push_back(0);
-    mixCos_.push_back(-1);
-    mixCos_.push_back(0);
-  }
 }
 // Class deconstructor
 UpConvert::~UpConvert()
@@ -80,72 +96,156 @@ bool UpConvert::upconvertFile(std::string outFile)
     return false;
   }
 
-  ////////////////////
-  /// Upconvert File///
-  ////////////////////
-  // Determine size of input and output signal vectors
-  int dataSize = blkSize_ * (int)fileIn_.samplePerMeas;
+  if ((fileIn_.dataFormat != "sc2") && (fileIn_.dataFormat != "sc8") &&
+      (fileIn_.dataFormat != "sc16") && (fileIn_.dataFormat != "fc32"))
+  {
+    std::cout << "Input format must be sc2, sc8, sc16 or fc32!!! Exiting"
+              << std::endl;
+    return false;
+  }
+
+  // Resolve the output settings against the input file
+  double outSampFreq =
+    (outputSampFreq_ > 0) ? outputSampFreq_ : fileIn_.sampFreq;
+  double      outIf     = outputIfSet_ ? outputIf_ : outSampFreq / 4;
+  std::string outFormat = outputFormat_;
+  if (outFormat.empty())
+  {
+    outFormat = (fileIn_.dataFormat == "sc2") ? "sc8" : fileIn_.dataFormat;
+  }
+  if ((outFormat != "sc8") && (outFormat != "sc16") && (outFormat != "fc32"))
+  {
+    std::cout << "Output format must be sc8, sc16 or fc32!!! Exiting"
+              << std::endl;
+    return false;
+  }
+  scale_ = gain_ * fullScale(outFormat) / fullScale(fileIn_.dataFormat);
+
+  // Set up the resampler (input rate) and the mixer (output rate)
+  size_t blkSize    = std::max(blkSize_, 1);
+  size_t maxOutputs = blkSize;
+  resample_         = (outSampFreq != fileIn_.sampFreq);
+  if (resample_)
+  {
+    if (!resampler_.configure((unsigned)std::llround(outSampFreq),
+                              (unsigned)std::llround(fileIn_.sampFreq),
+                              blkSize))
+    {
+      std::cout << "Cannot resample from " << fileIn_.sampFreq << " Hz to "
+                << outSampFreq << " Hz!!! Exiting" << std::endl;
+      return false;
+    }
+    maxOutputs = resampler_.getMaxOutputs(blkSize);
+  }
+  nco_.configure(outIf - fileIn_.ifFreq, outSampFreq, maxOutputs);
+
+  // Declare I/O variables
+  inputSamples_.resize(2 * blkSize);
+  resampled_.resize(2 * maxOutputs);
+  inPhase_.resize(maxOutputs);
+  quadrature_.resize(maxOutputs);
+  cosine_.resize(maxOutputs);
+  sine_.resize(maxOutputs);
+  mixed_.resize(2 * maxOutputs);
 
   // Open Files
   openFile();
   ifDataOut_.openOutFile(std::move(outFile));
 
-  // Declare I/O variables
-  Eigen::VectorXf    dataFile(dataSize);
-  Eigen::RowVectorXi dataOutput(blkSize_);
+  // Run until the end of the file or the end time (in I/Q pairs)
+  uint64_t skip    = ifData_.getSampleCount() / 2;
+  uint64_t fileEnd = ifData_.getFilesizeInSamples() / 2;
+  uint64_t end     = std::min<uint64_t>(
+    fileEnd, (uint64_t)(fileIn_.event.endTime * fileIn_.sampFreq));
+  uint64_t numSamples = (end > skip) ? end - skip : 0;
+  numOfLoops_         = (int)((numSamples + blkSize - 1) / blkSize);
 
-  // Determine if upconvert should be ran until end of file or set end time
-  if (ifData_.getFilesize() < fileIn_.event.endTime * fileIn_.sampFreq)
+  // The output format is resolved once for the whole file
+  if (outFormat == "sc8")
   {
-    numOfLoops_ = int(ifData_.getFilesize() - ifData_.getSampleCount()) /
-                  (blkSize_ * fileIn_.samplePerMeas * fileIn_.bytesPerSample);
-    std::cout << "File size smaller" << numOfLoops_ << std::endl;
+    translateFile<int8_t>(numSamples);
+  }
+  else if (outFormat == "sc16")
+  {
+    translateFile<int16_t>(numSamples);
   }
   else
   {
-    numOfLoops_ = int(fileIn_.event.endTime * fileIn_.sampFreq *
-                        fileIn_.samplePerMeas * fileIn_.bytesPerSample -
-                      ifData_.getSampleCount()) /
-                  (blkSize_ * fileIn_.samplePerMeas * fileIn_.bytesPerSample);
-    std::cout << "end smaller " << numOfLoops_ << std::endl;
+    translateFile<float>(numSamples);
   }
 
-  // Calculate the number of blocks required to process the entire file
+  ifDataOut_.close();
+  ifData_.close();
+  return true;
+}
+
+template <typename out_type>
+void UpConvert::writeOutput(size_t numSamples)
+{
+  // Scale into the range of the output data type
+  const float minValue = std::numeric_limits<out_type>::min();
+  const float maxValue = std::numeric_limits<out_type>::max();
+  dataOutput_.resize(numSamples);
+  dataOutput_ = (mixed_.head(numSamples) * scale_)
+                  .cwiseMax(minValue)
+                  .cwiseMin(maxValue)
+                  .template cast<int>()
+                  .matrix()
+                  .transpose();
+  ifDataOut_.writeSamples(dataOutput_, sizeof(out_type));
+}
+
+template <>
+void UpConvert::writeOutput<float>(size_t numSamples)
+{
+  mixed_.head(numSamples) *= scale_;
+  ifDataOut_.writeSamples(mixed_.data(), numSamples);
+}
 
-  for (int jj = 0; jj < numOfLoops_; jj++)
+template <typename out_type>
+void UpConvert::translateFile(uint64_t numSamples)
+{
+  size_t blkSize = std::max(blkSize_, 1);
+  for (uint64_t done = 0; done < numSamples; done += blkSize)
   {
     // Read data files
-    ifData_.getSamples(dataFile);
+    size_t count = (size_t)std::min<uint64_t>(blkSize, numSamples - done);
+    ifData_.getSamples(inputSamples_.data(), 2 * count);
 
-    std::vector<float>::iterator itSine = mixSine_.begin();
-    std::vector<float>::iterator itCos  = mixCos_.begin();
-    int                          outIdx = 0;  // index to write to output file
-    for (int kk = 0; kk < blkSize_ * fileIn_.samplePerMeas;
-         kk     = kk + 2, outIdx++)
+    const float* samples = inputSamples_.data();
+    if (resample_)
     {
-      // Sort into I and Q signal and combine signals
-      if (fileIn_.dataFormat == "sc8")
-      {
-        dataOutput[outIdx] =
-          (int8_t)((dataFile[kk] * (*itCos) - dataFile[kk + 1] * (*itSine)));
-        // std::cout << dataOutput[outIdx] << " ";
-      }
-      else if (fileIn_.dataFormat == "sc16")
+      count   = resampler_.process(samples, count, resampled_.data());
+      samples = resampled_.data();
+    }
+
+    // Sort into I and Q signal
+    for (size_t ii = 0; ii < count; ii++)
+    {
+      inPhase_[ii]    = samples[2 * ii];
+      quadrature_[ii] = samples[2 * ii + 1];
+    }
+
+    // Mix with the oscillator, continuing its phase from the last block
+    nco_.generate(count, cosine_.data(), sine_.data());
+    if (outputComplex_)
+    {
+      for (size_t ii = 0; ii < count; ii++)
       {
-        dataOutput[outIdx] = (int16_t)(
-          (dataFile[kk] * (*itCos) - dataFile[kk + 1] * (*itSine)) / 3.);
+        mixed_[2 * ii] =
+          inPhase_[ii] * cosine_[ii] - quadrature_[ii] * sine_[ii];
+        mixed_[2 * ii + 1] =
+          inPhase_[ii] * sine_[ii] + quadrature_[ii] * cosine_[ii];
       }
-
-      // Iterate mixer signal iterators
-      itCos++;
-      itSine++;
+      writeOutput<out_type>(2 * count);
+    }
+    else
+    {
+      mixed_.head(count) = inPhase_.head(count) * cosine_.head(count) -
+                           quadrature_.head(count) * sine_.head(count);
+      writeOutput<out_type>(count);
     }
-    // Write combined signal to output file
-    ifDataOut_.writeSamples(dataOutput, sizeof(char) * fileIn_.bytesPerSample);
   }
-  ifDataOut_.close();
-  ifData_.close();
-  return true;
 }
 
 void UpConvert::addFile(dataFile file)
@@ -166,6 +266,11 @@ void UpConvert::addFile(dataFile file)
     file.bytesPerSample = 0.25;
     file.maxValue       = 2;
   }
+  else if (file.dataFormat == "fc32")
+  {
+    file.bytesPerSample = 4;
+    file.maxValue       = 1;
+  }
   if (file.isComplex)
   {
     file.samplePerMeas = 2;
@@ -186,18 +291,12 @@ void UpConvert::openFile()
   ifSettings.intermediateFrequency = fileIn_.ifFreq;
   ifSettings.bytesPerSample        = fileIn_.bytesPerSample;
   ifSettings.complex               = fileIn_.isComplex;
-  ifSettings.sampleCountOffset     = (uint64_t)fileIn_.skipSeconds *
-                                 ifSettings.samplingFreq *
-                                 fileIn_.samplePerMeas * fileIn_.bytesPerSample;
+  ifSettings.sampleCountOffset     = (uint64_t)(
+    fileIn_.skipSeconds * ifSettings.samplingFreq * fileIn_.samplePerMeas);
   ifSettings.dataFilename = fileIn_.fileName;
 
   // Open file and move to correct position in file
   ifData_.open(ifSettings);
   ifData_.setSampleCount(ifSettings.sampleCountOffset);
 }
-
-void UpConvert::readFile(Eigen::VectorXf& samplesEigen)
-{
-  ifData_.getSamples(samplesEigen);
-}
 }  // namespace if_data_utils
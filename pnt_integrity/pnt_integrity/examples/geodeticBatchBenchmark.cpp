@@ -0,0 +1,166 @@
+//============================================================================//
+//---------- pnt_integrity/geodeticBatchBenchmark.cpp ----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Microbenchmark for the batched geodetic to ECEF and distance kernels
+// October 16, 2026
+//============================================================================//
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "logutils/logutils.hpp"
+#include "pnt_integrity/GeodeticBatch.hpp"
+
+using namespace logutils;
+using namespace pnt_integrity;
+
+namespace
+{
+// Returns the elapsed time of the provided function call in seconds
+template <class Func>
+double timeCall(Func func)
+{
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  // the number of positions per batch and the number of times the batch is
+  // evaluated
+  size_t numPositions = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000;
+  size_t numRepeats   = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1000;
+
+  // generate positions scattered within a few hundred meters of a reference
+  data::GeodeticPosition3d reference(0.5718, -1.5156, 200.0);
+
+  std::mt19937                     gen(42);
+  std::uniform_real_distribution<> angleNoise(-5e-5, 5e-5);
+  std::uniform_real_distribution<> altNoise(-50.0, 50.0);
+
+  GeodeticPositionBatch                 batch(numPositions);
+  std::vector<data::GeodeticPosition3d> positions;
+  for (size_t ii = 0; ii < numPositions; ++ii)
+  {
+    data::GeodeticPosition3d pos(reference.latitude + angleNoise(gen),
+                                 reference.longitude + angleNoise(gen),
+                                 reference.altitude + altNoise(gen));
+    positions.push_back(pos);
+    batch.push_back(pos);
+  }
+
+  double totalConversions = (double)numPositions * (double)numRepeats;
+
+  // scalar conversion
+  std::vector<double> scalarEcef(3 * numPositions);
+  double              scalarTime = timeCall([&]() {
+    for (size_t rr = 0; rr < numRepeats; ++rr)
+    {
+      for (size_t ii = 0; ii < numPositions; ++ii)
+      {
+        positions[ii].getECEF(&scalarEcef[3 * ii]);
+      }
+    }
+  });
+
+  // batch conversion
+  EcefPositionBatch batchEcef;
+  double            batchTime = timeCall([&]() {
+    for (size_t rr = 0; rr < numRepeats; ++rr)
+    {
+      geodeticToEcef(batch, batchEcef);
+    }
+  });
+
+  // largest disagreement between the two conversions
+  double maxDiff = 0.0;
+  for (size_t ii = 0; ii < numPositions; ++ii)
+  {
+    maxDiff = std::max(maxDiff, std::fabs(scalarEcef[3 * ii] - batchEcef.x[ii]));
+    maxDiff =
+      std::max(maxDiff, std::fabs(scalarEcef[3 * ii + 1] - batchEcef.y[ii]));
+    maxDiff =
+      std::max(maxDiff, std::fabs(scalarEcef[3 * ii + 2] - batchEcef.z[ii]));
+  }
+
+  // scalar distance to the reference, converting both points every time
+  size_t scalarCount        = 0;
+  double scalarDistanceTime = timeCall([&]() {
+    for (size_t rr = 0; rr < numRepeats; ++rr)
+    {
+      scalarCount = 0;
+      for (size_t ii = 0; ii < numPositions; ++ii)
+      {
+        double p1[3], p2[3];
+        positions[ii].getECEF(p1);
+        reference.getECEF(p2);
+        double dist = sqrt(pow(p1[0] - p2[0], 2.0) + pow(p1[1] - p2[1], 2.0) +
+                           pow(p1[2] - p2[2], 2.0));
+        scalarCount += (dist <= 100.0) ? 1 : 0;
+      }
+    }
+  });
+
+  // batch distance to a cached reference
+  EcefReference cachedReference(reference);
+  size_t        batchCount        = 0;
+  double        batchDistanceTime = timeCall([&]() {
+    for (size_t rr = 0; rr < numRepeats; ++rr)
+    {
+      batchCount = cachedReference.countWithin(batch, 100.0);
+    }
+  });
+
+  std::stringstream msg;
+  msg << "Geodetic batch benchmark (" << numPositions << " positions x "
+      << numRepeats << " repeats)" << std::endl;
+  msg << "scalar getECEF:        " << totalConversions / scalarTime
+      << " conversions / sec" << std::endl;
+  msg << "batch geodeticToEcef:  " << totalConversions / batchTime
+      << " conversions / sec" << std::endl;
+  msg << "max ECEF difference:   " << maxDiff << " m" << std::endl;
+  msg << "scalar distance:       " << totalConversions / scalarDistanceTime
+      << " distances / sec (" << scalarCount << " within 100 m)" << std::endl;
+  msg << "cached batch distance: " << totalConversions / batchDistanceTime
+      << " distances / sec (" << batchCount << " within 100 m)";
+  printLogToStdOut(msg.str(), LogLevel::Info);
+
+  return 0;
+}
@@ -0,0 +1,190 @@
+//============================================================================//
+//------------- pnt_integrity/orbitBatchBenchmark.cpp ----------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Throughput and accuracy of the batched orbit propagation kernel
+// October 16, 2026
+//============================================================================//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "logutils/logutils.hpp"
+#include "pnt_integrity/OrbitBatch.hpp"
+
+using namespace logutils;
+using namespace pnt_integrity;
+
+namespace
+{
+// Returns the elapsed time of the provided function call in seconds
+template <class Func>
+double timeCall(Func func)
+{
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+// Builds a representative GPS ephemeris spread around the constellation
+GpsEphemeris makeEphemeris(uint16_t prn)
+{
+  EphemerisParameters params   = {};
+  params.prn                   = prn;
+  params.svHealth.signalHealth = SVSignalHealth::AllSignalsOk;
+  params.iodc                  = 10;
+  params.iodeSf2               = 10;
+  params.iodeSf3               = 10;
+  params.clockCorrectionTime   = 302400.0;
+  params.clockAging1           = 1e-4;
+  params.clockAging2           = 1e-11;
+  params.groupDelay            = -5e-9;
+  params.timeOfEphemeris       = 302400.0;
+  params.sqrtSemiMajorAxis     = 5153.6;
+  params.eccentricity          = 0.002 + 0.0006 * (prn % 32);
+  params.inclinationAngle      = 0.96;
+  params.rightAscension        = (prn % 6) * gpsPi / 3.0 - gpsPi;
+  params.meanAnomaly           = (prn * 0.7) - gpsPi;
+  params.argumentOfPerigee     = 0.5 - (prn % 5) * 0.3;
+  params.meanMotionDifference  = 4.5e-9;
+  params.ascensionRate         = -8.0e-9;
+  params.inclinationRate       = 1.0e-10;
+  params.cosLatitude           = 1.5e-6;
+  params.sinLatitude           = 8.0e-6;
+  params.cosOrbitRadius        = 200.0;
+  params.sinOrbitRadius        = 40.0;
+  params.cosInclination        = 5e-8;
+  params.sinInclination        = -5e-8;
+
+  GpsEphemeris ephemeris;
+  ephemeris.setEphemeris(params, false);
+  return ephemeris;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  // the number of satellites and the number of epochs evaluated (1 s apart)
+  size_t numSvs    = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 32;
+  size_t numEpochs = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 7200;
+
+  std::vector<GpsEphemeris> ephemerides;
+  OrbitParameterBatch       batch(numSvs);
+  std::vector<double>       ranges;
+  for (size_t ii = 0; ii < numSvs; ++ii)
+  {
+    ephemerides.push_back(makeEphemeris((uint16_t)(ii + 1)));
+    batch.push_back(ephemerides.back());
+    ranges.push_back(2.0e7 + 1.0e5 * ii);
+  }
+
+  double startTime   = 302400.0 - 0.5 * numEpochs;
+  double totalStates = (double)numEpochs * (double)numSvs;
+
+  // scalar propagation
+  std::vector<double> scalar(7 * numEpochs * numSvs);
+  double              scalarTime = timeCall([&]() {
+    for (size_t ee = 0; ee < numEpochs; ++ee)
+    {
+      for (size_t ii = 0; ii < numSvs; ++ii)
+      {
+        double* s = &scalar[7 * (ee * numSvs + ii)];
+        ephemerides[ii].getSvState(startTime + ee,
+                                   s[0],
+                                   s[1],
+                                   s[2],
+                                   s[3],
+                                   s[4],
+                                   s[5],
+                                   s[6],
+                                   ranges[ii]);
+      }
+    }
+  });
+
+  // batch propagation
+  std::vector<SvStateBatch> batched(numEpochs);
+  double                    batchTime = timeCall([&]() {
+    for (size_t ee = 0; ee < numEpochs; ++ee)
+    {
+      batch.getSvStates(startTime + ee, ranges, batched[ee]);
+    }
+  });
+
+  // largest disagreement between the two paths
+  double maxPosDiff   = 0.0;
+  double maxPosUlp    = 0.0;
+  double maxVelDiff   = 0.0;
+  double maxClockDiff = 0.0;
+  for (size_t ee = 0; ee < numEpochs; ++ee)
+  {
+    const SvStateBatch& b = batched[ee];
+    for (size_t ii = 0; ii < numSvs; ++ii)
+    {
+      const double* s = &scalar[7 * (ee * numSvs + ii)];
+      double posDiff =
+        sqrt(pow(s[0] - b.x[ii], 2.0) + pow(s[1] - b.y[ii], 2.0) +
+             pow(s[2] - b.z[ii], 2.0));
+      double radius = sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+      maxPosDiff    = std::max(maxPosDiff, posDiff);
+      maxPosUlp     = std::max(
+        maxPosUlp, posDiff / (radius * std::numeric_limits<double>::epsilon()));
+      maxVelDiff =
+        std::max(maxVelDiff,
+                 sqrt(pow(s[3] - b.vx[ii], 2.0) + pow(s[4] - b.vy[ii], 2.0) +
+                      pow(s[5] - b.vz[ii], 2.0)));
+      maxClockDiff =
+        std::max(maxClockDiff, std::fabs(s[6] - b.clockCorrection[ii]));
+    }
+  }
+
+  std::stringstream msg;
+  msg << "Orbit batch benchmark (" << numSvs << " satellites x " << numEpochs
+      << " epochs)" << std::endl;
+  msg << "scalar getSvState:   " << totalStates / scalarTime
+      << " states / sec" << std::endl;
+  msg << "batch getSvStates:   " << totalStates / batchTime << " states / sec"
+      << std::endl;
+  msg << "max position error:  " << maxPosDiff << " m (" << maxPosUlp
+      << " ulp of the orbit radius)" << std::endl;
+  msg << "max velocity error:  " << maxVelDiff << " m/s" << std::endl;
+  msg << "max clock error:     " << maxClockDiff << " s";
+  printLogToStdOut(msg.str(), LogLevel::Info);
+
+  return 0;
+}
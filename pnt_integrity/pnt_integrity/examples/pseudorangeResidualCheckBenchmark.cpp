@@ -0,0 +1,261 @@
+//============================================================================//
+//------ pnt_integrity/pseudorangeResidualCheckBenchmark.cpp ---*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//----------------------------------------------------------------------------//
+//
+// Timing, allocation, and detection performance of the pseudorange residual
+// check on a simulated constellation
+// October 16, 2026
+//============================================================================//
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "logutils/logutils.hpp"
+#include "pnt_integrity/GPSNavDataCommon.hpp"
+#include "pnt_integrity/PseudorangeResidualCheck.hpp"
+
+using namespace logutils;
+using namespace pnt_integrity;
+
+namespace
+{
+// the number of heap allocations made by the process
+std::atomic<size_t> numAllocations(0);
+
+// Builds a representative GPS ephemeris spread around the constellation
+GpsEphemeris makeEphemeris(uint16_t prn)
+{
+  EphemerisParameters params   = {};
+  params.prn                   = prn;
+  params.svHealth.signalHealth = SVSignalHealth::AllSignalsOk;
+  params.iodc                  = 10;
+  params.iodeSf2               = 10;
+  params.iodeSf3               = 10;
+  params.clockCorrectionTime   = 302400.0;
+  params.clockAging1           = 1e-4;
+  params.clockAging2           = 1e-11;
+  params.groupDelay            = -5e-9;
+  params.timeOfEphemeris       = 302400.0;
+  params.sqrtSemiMajorAxis     = 5153.6;
+  params.eccentricity          = 0.002 + 0.0006 * (prn % 32);
+  params.inclinationAngle      = 0.96;
+  params.rightAscension        = (prn % 6) * gpsPi / 3.0 - gpsPi;
+  params.meanAnomaly           = (prn * 0.7) - gpsPi;
+  params.argumentOfPerigee     = 0.5 - (prn % 5) * 0.3;
+  params.meanMotionDifference  = 4.5e-9;
+  params.ascensionRate         = -8.0e-9;
+  params.inclinationRate       = 1.0e-10;
+  params.cosLatitude           = 1.5e-6;
+  params.sinLatitude           = 8.0e-6;
+  params.cosOrbitRadius        = 200.0;
+  params.sinOrbitRadius        = 40.0;
+  params.cosInclination        = 5e-8;
+  params.sinInclination        = -5e-8;
+
+  GpsEphemeris ephemeris;
+  ephemeris.setEphemeris(params, false);
+  return ephemeris;
+}
+}  // namespace
+
+void* operator new(size_t size)
+{
+  ++numAllocations;
+  void* ptr = std::malloc(size);
+  if (!ptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+int main(int argc, char** argv)
+{
+  // the number of 10 Hz epochs, and the bias (m) added to PRN 7 in the
+  // second half of the run
+  size_t numEpochs = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 36000;
+  double faultBias = (argc > 2) ? std::strtod(argv[2], nullptr) : 50.0;
+
+  const uint16_t numSvs       = 32;
+  const uint16_t faultPrn     = 7;
+  const double   sigma        = 1.0;
+  const double   receiver[3]  = {422600.0, -5362000.0, 3415500.0};
+  const double   clockBias    = 3000.0;
+  const double   startTime    = 302400.0 - 0.05 * numEpochs;
+  const size_t   faultedEpoch = numEpochs / 2;
+
+  // simulated pseudoranges (every satellite is used, regardless of whether
+  // it is above the horizon, since only the geometry matters here)
+  std::vector<GpsEphemeris> ephemerides;
+  for (uint16_t prn = 1; prn <= numSvs; ++prn)
+  {
+    ephemerides.push_back(makeEphemeris(prn));
+  }
+
+  std::mt19937                     generator(1);
+  std::normal_distribution<double> noise(0.0, sigma);
+  std::vector<double>              pseudoranges(numEpochs * numSvs);
+  for (size_t ee = 0; ee < numEpochs; ++ee)
+  {
+    for (uint16_t ii = 0; ii < numSvs; ++ii)
+    {
+      double pr = 2.0e7;
+      for (int iter = 0; iter < 3; ++iter)
+      {
+        double px, py, pz, vx, vy, vz, clk;
+        ephemerides[ii].getSvState(
+          startTime + 0.1 * ee, px, py, pz, vx, vy, vz, clk, pr);
+        double range = std::sqrt(std::pow(px - receiver[0], 2.0) +
+                                 std::pow(py - receiver[1], 2.0) +
+                                 std::pow(pz - receiver[2], 2.0));
+        pr           = range + clockBias - speedOfLight * clk;
+      }
+      pr += noise(generator);
+      if ((ee >= faultedEpoch) && (ii + 1 == faultPrn))
+      {
+        pr += faultBias;
+      }
+      pseudoranges[ee * numSvs + ii] = pr;
+    }
+  }
+
+  PseudorangeResidualCheck check("Pseudorange Residual Check",
+                                 1e-5,
+                                 sigma,
+                                 1,
+                                 [](const std::string&, const LogLevel&) {});
+  for (auto ephIt = ephemerides.begin(); ephIt != ephemerides.end(); ++ephIt)
+  {
+    check.setEphemeris(*ephIt);
+  }
+
+  data::GNSSObservables gnssObs;
+  for (uint16_t prn = 1; prn <= numSvs; ++prn)
+  {
+    gnssObs.observables[prn] =
+      data::GNSSObservable(prn,
+                           data::SatelliteSystem::GPS,
+                           data::CodeType::SigC,
+                           data::FrequencyBand::Band1,
+                           data::AssuranceLevel::Unavailable,
+                           45.0,
+                           true,
+                           0.0,
+                           sigma * sigma);
+  }
+
+  size_t falseAlarms      = 0;
+  size_t detections       = 0;
+  size_t correctExclusion = 0;
+  size_t epochAllocations = 0;
+  double maxEpochTime     = 0.0;
+  double totalTime        = 0.0;
+  for (size_t ee = 0; ee < numEpochs; ++ee)
+  {
+    gnssObs.gnssTime.secondsOfWeek = startTime + 0.1 * ee;
+    for (uint16_t prn = 1; prn <= numSvs; ++prn)
+    {
+      gnssObs.observables[prn].pseudorange =
+        pseudoranges[ee * numSvs + prn - 1];
+    }
+
+    size_t allocationsBefore = numAllocations;
+    auto   start             = std::chrono::steady_clock::now();
+    check.handleGnssObservables(gnssObs, 0.1 * ee);
+    auto stop = std::chrono::steady_clock::now();
+
+    // the first epoch fills the per-PRN maps
+    if (ee > 0)
+    {
+      epochAllocations += numAllocations - allocationsBefore;
+    }
+    double epochTime = std::chrono::duration<double>(stop - start).count();
+    totalTime += epochTime;
+    maxEpochTime = std::max(maxEpochTime, epochTime);
+
+    // the satellite levels reflect each epoch's test, while the check level
+    // is held for the assurance level period
+    MultiPrnAssuranceMap prnLevels = check.getMultiPrnAssuranceData();
+    bool                 faultFound =
+      std::any_of(prnLevels.begin(),
+                  prnLevels.end(),
+                  [](const MultiPrnAssuranceMap::value_type& level) {
+                    return level.second != data::AssuranceLevel::Assured;
+                  });
+    if (ee < faultedEpoch)
+    {
+      falseAlarms += faultFound ? 1 : 0;
+    }
+    else if (faultFound)
+    {
+      ++detections;
+      if (prnLevels[faultPrn] == data::AssuranceLevel::Unassured)
+      {
+        ++correctExclusion;
+      }
+    }
+  }
+
+  std::stringstream msg;
+  msg << "Pseudorange residual check benchmark (" << numSvs
+      << " satellites x " << numEpochs << " epochs)" << std::endl;
+  msg << "mean epoch time:      " << 1e6 * totalTime / numEpochs << " us"
+      << std::endl;
+  msg << "max epoch time:       " << 1e6 * maxEpochTime << " us" << std::endl;
+  msg << "epoch allocations:    " << epochAllocations << std::endl;
+  msg << "false alarms:         " << falseAlarms << " / " << faultedEpoch
+      << std::endl;
+  msg << "detections (" << faultBias << " m): " << detections << " / "
+      << numEpochs - faultedEpoch << std::endl;
+  msg << "correct exclusions:   " << correctExclusion << " / " << detections;
+  printLogToStdOut(msg.str(), LogLevel::Info);
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+//============================================================================//
+//------------ pnt_integrity/svStateCacheBenchmark.cpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Accuracy and throughput of the interpolating satellite state cache
+// October 16, 2026
+//============================================================================//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#include "logutils/logutils.hpp"
+#include "pnt_integrity/SvStateCache.hpp"
+
+using namespace logutils;
+using namespace pnt_integrity;
+
+namespace
+{
+// Returns the elapsed time of the provided function call in seconds
+template <class Func>
+double timeCall(Func func)
+{
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+// Builds a representative GPS ephemeris spread around the constellation
+GpsEphemeris makeEphemeris(uint16_t prn)
+{
+  EphemerisParameters params = {};
+  params.prn                  = prn;
+  params.svHealth.signalHealth = SVSignalHealth::AllSignalsOk;
+  params.iodc                 = 10;
+  params.iodeSf2              = 10;
+  params.iodeSf3              = 10;
+  params.clockCorrectionTime  = 302400.0;
+  params.clockAging1          = 1e-4;
+  params.clockAging2          = 1e-11;
+  params.groupDelay           = -5e-9;
+  params.timeOfEphemeris      = 302400.0;
+  params.sqrtSemiMajorAxis    = 5153.6;
+  params.eccentricity         = 0.002 + 0.0006 * (prn % 32);
+  params.inclinationAngle     = 0.96;
+  params.rightAscension       = (prn % 6) * gpsPi / 3.0 - gpsPi;
+  params.meanAnomaly          = (prn * 0.7) - gpsPi;
+  params.argumentOfPerigee    = 0.5 - (prn % 5) * 0.3;
+  params.meanMotionDifference = 4.5e-9;
+  params.ascensionRate        = -8.0e-9;
+  params.inclinationRate      = 1.0e-10;
+  params.cosLatitude          = 1.5e-6;
+  params.sinLatitude          = 8.0e-6;
+  params.cosOrbitRadius       = 200.0;
+  params.sinOrbitRadius       = 40.0;
+  params.cosInclination       = 5e-8;
+  params.sinInclination       = -5e-8;
+
+  GpsEphemeris ephemeris;
+  ephemeris.setEphemeris(params, false);
+  return ephemeris;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  // the number of satellites, the evaluation rate, and the time span
+  size_t numSvs   = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 32;
+  double rate     = (argc > 2) ? std::strtod(argv[2], nullptr) : 10.0;
+  double duration = (argc > 3) ? std::strtod(argv[3], nullptr) : 7200.0;
+
+  std::vector<GpsEphemeris> ephemerides;
+  SvStateCache              cache;
+  for (size_t ii = 0; ii < numSvs; ++ii)
+  {
+    ephemerides.push_back(makeEphemeris((uint16_t)(ii + 1)));
+    cache.setEphemeris(ephemerides.back());
+  }
+
+  size_t numEpochs = (size_t)(duration * rate);
+  double startTime = 302400.0 - 0.5 * duration;
+  double range     = 2.2e7;
+
+  double totalStates = (double)numEpochs * (double)numSvs;
+
+  // direct evaluation of every state
+  std::vector<double> direct(7 * numEpochs * numSvs);
+  double              directTime = timeCall([&]() {
+    for (size_t ee = 0; ee < numEpochs; ++ee)
+    {
+      double t = startTime + ee / rate;
+      for (size_t ii = 0; ii < numSvs; ++ii)
+      {
+        double* s = &direct[7 * (ee * numSvs + ii)];
+        ephemerides[ii].getSvState(
+          t, s[0], s[1], s[2], s[3], s[4], s[5], s[6], range);
+      }
+    }
+  });
+
+  // interpolated states
+  std::vector<double> cached(7 * numEpochs * numSvs);
+  double              cachedTime = timeCall([&]() {
+    for (size_t ee = 0; ee < numEpochs; ++ee)
+    {
+      double t = startTime + ee / rate;
+      for (size_t ii = 0; ii < numSvs; ++ii)
+      {
+        double* s = &cached[7 * (ee * numSvs + ii)];
+        cache.getSvState((uint16_t)(ii + 1),
+                         t,
+                         s[0],
+                         s[1],
+                         s[2],
+                         s[3],
+                         s[4],
+                         s[5],
+                         s[6],
+                         range);
+      }
+    }
+  });
+
+  // largest disagreement between the direct and interpolated states
+  double maxPosDiff   = 0.0;
+  double maxVelDiff   = 0.0;
+  double maxClockDiff = 0.0;
+  for (size_t ii = 0; ii < numEpochs * numSvs; ++ii)
+  {
+    const double* d = &direct[7 * ii];
+    const double* c = &cached[7 * ii];
+    maxPosDiff      = std::max(maxPosDiff,
+                          sqrt(pow(d[0] - c[0], 2.0) + pow(d[1] - c[1], 2.0) +
+                               pow(d[2] - c[2], 2.0)));
+    maxVelDiff      = std::max(maxVelDiff,
+                          sqrt(pow(d[3] - c[3], 2.0) + pow(d[4] - c[4], 2.0) +
+                               pow(d[5] - c[5], 2.0)));
+    maxClockDiff    = std::max(maxClockDiff, std::fabs(d[6] - c[6]));
+  }
+
+  std::stringstream msg;
+  msg << "SV state cache benchmark (" << numSvs << " satellites at " << rate
+      << " Hz for " << duration << " s, knots every " << cache.getKnotSpacing()
+      << " s)" << std::endl;
+  msg << "direct getSvState:   " << totalStates / directTime
+      << " states / sec" << std::endl;
+  msg << "cached getSvState:   " << totalStates / cachedTime
+      << " states / sec (" << cache.getNumKnotEvaluations()
+      << " knot evaluations)" << std::endl;
+  msg << "max position error:  " << maxPosDiff * 1e3 << " mm" << std::endl;
+  msg << "max velocity error:  " << maxVelDiff * 1e3 << " mm/s" << std::endl;
+  msg << "max clock error:     " << maxClockDiff * speedOfLight * 1e3
+      << " mm";
+  printLogToStdOut(msg.str(), LogLevel::Info);
+
+  return 0;
+}
@@ -37,7 +37,7 @@
 //  September 30, 2019
 //============================================================================//
 
-#include "if_data_utils/IFDataFileReader.hpp"
+#include "if_data_utils/IFDataFileMap.hpp"
 #include "logutils/logutils.hpp"
 #include "pnt_integrity/AcquisitionCheck.hpp"
 #include "useFftw.h"
@@ -82,35 +82,54 @@ int main(int argc, char** argv)
   sampleHeader.numSamples_ =
     numIntPeriods * integrationPeriod * sampleHeader.fs_;
 
-  // build the data structure
-  IFSampleData<std::complex<int8_t> > sampleData(sampleHeader);
-
   std::stringstream sizeMsg;
   sizeMsg << "Analysis data chunks: " << std::endl;
   sizeMsg << "Num integration periods: " << numIntPeriods << std::endl;
-  sizeMsg << "Num samples: " << sampleData.getNumberOfSamples() << std::endl;
-  sizeMsg << "Num bytes: " << sampleData.getNumberOfBytes();
+  sizeMsg << "Num samples: " << sampleHeader.numSamples_ << std::endl;
+  sizeMsg << "Num bytes: "
+          << sampleHeader.numSamples_ * sampleHeader.bytesPerSample_;
   printLogToStdOut(sizeMsg.str(), LogLevel::Info);
 
-  // define the sample buffer to hold the data to be read from the file
-  //   std::vector<char> sampleBuffer(readBufferSize);
-
-  // create a pointer to the data type that the file reader is expecting
-  if_data_utils::read_element* readElementPtr =
-    (if_data_utils::read_element*)(sampleData.getBufferPtr());
-
-  // create the file reader object
-  if_data_utils::IFDataFileReader<std::complex<int8_t> > fileReader(
-    sampleData.getNumberOfBytes(), logutils::printLogToStdOut);
-
-  // open the IF data file
-  fileReader.openFile(ifDataFile);
+  // map the IF data file, the samples are processed in place
+  if_data_utils::IFDataFileMap<std::complex<int8_t> > fileMap(
+    logutils::printLogToStdOut);
+  if (!fileMap.openFile(ifDataFile))
+  {
+    return 1;
+  }
 
   // read samples from the file
-  fileReader.readSamplesFromFile(*readElementPtr);
-
-  // pass the data to the check
-  acqCheck.processIFSampleData(sampleData);
+  const std::complex<int8_t>* samples;
+  if (!fileMap.readSamples(samples, sampleHeader.numSamples_))
+  {
+    printLogToStdOut("Not enough samples in " + ifDataFile, LogLevel::Error);
+    return 1;
+  }
+
+  // pass the data to the check (the samples are adopted, not copied)
+  IFSampleData<IFSampleSC8> sc8Data(sampleHeader, samples);
+  acqCheck.handleIFSampleData(0.0, sc8Data);
+
+  std::stringstream sc8Msg;
+  sc8Msg << "SC8 assurance level: " << (int)acqCheck.getAssuranceLevel();
+  printLogToStdOut(sc8Msg.str(), LogLevel::Info);
+
+  // run the same samples normalized to complex floats, which are checked
+  // against the thresholds scaled to the FC32 full scale
+  IFSampleHeader fc32Header(
+    sampleHeader.numSamples_, IFSampleType::FC32, 0.0, sampleHeader.fs_);
+  IFSampleData<IFSampleFC32> fc32Data(fc32Header);
+  IFSampleFC32*              fc32Samples = fc32Data.getBufferPtr();
+  for (size_t ii = 0; ii < fc32Header.numSamples_; ++ii)
+  {
+    fc32Samples[ii] = IFSampleFC32(samples[ii].real() / 128.f,
+                                   samples[ii].imag() / 128.f);
+  }
+  acqCheck.handleIFSampleData(0.0, fc32Data);
+
+  std::stringstream fc32Msg;
+  fc32Msg << "FC32 assurance level: " << (int)acqCheck.getAssuranceLevel();
+  printLogToStdOut(fc32Msg.str(), LogLevel::Info);
 
   return 0;
 }
\ No newline at end of file
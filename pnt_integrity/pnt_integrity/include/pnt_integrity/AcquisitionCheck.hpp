@@ -126,6 +126,13 @@ public:
   /// configures the check for L1-CA at 5 MSps. Acquisition parameters will
   /// be recalculated if a different sampling frequency is detected
   ///
+  /// The power thresholds are absolute correlation powers for SC8 samples
+  /// (full scale of 128). Samples of other types are compared against
+  /// thresholds scaled by the square of the ratio of their full scale to SC8
+  /// (32768 for SC16, 1.0 for the normalized FC32 and FC64 types), so the
+  /// same settings apply to a signal at the same level relative to full
+  /// scale.
+  ///
   /// \param name A string name for the check instance
   /// \param highPowerThreshold A threshold that indicates abnormally high power
   /// levels
@@ -166,6 +173,7 @@ public:
     , highPowerThreshold_(highPowerThreshold)
     , peakRatioThreshold_(peakRatioThreshold)
     , acquisitionThreshold_(acqusitionThreshold)
+    , thresholdScale_(1.0)
     , lastProcessTime_(0.0)
     , samplesPerIntPeriod_(0)
     , samplesPerCode_(0)
@@ -203,7 +211,6 @@ public:
   {
     std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-    // return processIFSampleData(ifData);
     if (processIFSampleData(ifData))
     {
       lastProcessTime_ = checkTime;
@@ -230,7 +237,59 @@ public:
   {
     std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-    // return processIFSampleData(ifData);
+    if (processIFSampleData(ifData))
+    {
+      lastProcessTime_ = checkTime;
+      return runCheck();
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /// \brief Handler function for IF sample data (FC32)
+  ///
+  /// Function to handle provided IF data (Overriding inherited function from
+  /// parent class). Calls the common templated function processIfSampleData for
+  /// convenience. The samples are correlated in place
+  /// without a conversion pass
+  ///
+  /// \param checkTime The timestamp associated with the data
+  /// \param ifData The provided IF data sample set
+  /// \returns True if successful
+  bool handleIFSampleData(
+    const double&                                                   checkTime,
+    const if_data_utils::IFSampleData<if_data_utils::IFSampleFC32>& ifData)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+    if (processIFSampleData(ifData))
+    {
+      lastProcessTime_ = checkTime;
+      return runCheck();
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /// \brief Handler function for IF sample data (FC64)
+  ///
+  /// Function to handle provided IF data (Overriding inherited function from
+  /// parent class). Calls the common templated function processIfSampleData for
+  /// convenience
+  ///
+  /// \param checkTime The timestamp associated with the data
+  /// \param ifData The provided IF data sample set
+  /// \returns True if successful
+  bool handleIFSampleData(
+    const double&                                                   checkTime,
+    const if_data_utils::IFSampleData<if_data_utils::IFSampleFC64>& ifData)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
     if (processIFSampleData(ifData))
     {
       lastProcessTime_ = checkTime;
@@ -249,7 +308,26 @@ public:
   /// \param sampleData Incoming sample data
   template <typename samp_type>
   bool processIFSampleData(
-    const if_data_utils::IFSampleData<samp_type>& sampleData);
+    const if_data_utils::IFSampleData<samp_type>& sampleData)
+  {
+    return processIFSamples(sampleData.getHeader(),
+                            sampleData.getBufferPtr(),
+                            sampleData.getNumberOfSamples());
+  }
+
+  /// \brief Functon to process incoming samples held in external storage
+  ///
+  /// Use this to process samples in place (e.g. from an
+  /// if_data_utils::IFDataFileMap) without first copying them into an
+  /// IFSampleData structure
+  ///
+  /// \param header The header describing the samples
+  /// \param samples Pointer to the first sample
+  /// \param numSamples The number of samples available
+  template <typename samp_type>
+  bool processIFSamples(const if_data_utils::IFSampleHeader& header,
+                        const samp_type*                     samples,
+                        const size_t&                        numSamples);
 
   /// \brief Function to explicitly set the assurance level of the check
   ///
@@ -309,6 +387,9 @@ private:
   double peakRatioThreshold_;
   double acquisitionThreshold_;
 
+  // scale applied to the power thresholds for the last processed sample type
+  double thresholdScale_;
+
   double lastProcessTime_;
 
   size_t samplesPerIntPeriod_;
@@ -384,16 +465,47 @@ private:
             (header.if_ != intermediateFrequency_));
   }
 
-  bool generateAcquisitionPlane(const Eigen::ArrayXcf& signalSamples);
+  bool generateAcquisitionPlane(
+    const Eigen::Ref<const Eigen::ArrayXcf>& signalSamples);
 
-  void acquisitionCorrelation(const int&              prn,
-                              const Eigen::ArrayXcf&  signalSamples,
-                              const Eigen::VectorXcf& phasePoints);
+  void acquisitionCorrelation(
+    const int&                               prn,
+    const Eigen::Ref<const Eigen::ArrayXcf>& signalSamples,
+    const Eigen::VectorXcf&                  phasePoints);
 
   template <typename samp_type>
-  void buildSampleVector(const samp_type*                  bufferPtr,
-                         const size_t&                     numSamples,
-                         std::vector<std::complex<float>>& sampleVec);
+  const std::complex<float>* buildSampleVector(
+    const samp_type*                  bufferPtr,
+    const size_t&                     numSamples,
+    std::vector<std::complex<float>>& sampleVec);
+
+  // complex float samples are already in the processing format, so they are
+  // used in place rather than copied
+  const std::complex<float>* buildSampleVector(
+    const std::complex<float>* bufferPtr,
+    const size_t& /*numSamples*/,
+    std::vector<std::complex<float>>& /*sampleVec*/)
+  {
+    return bufferPtr;
+  }
+
+  // the magnitude of a full scale sample for each sample type
+  static double sampleFullScale(const if_data_utils::IFSampleSC8*)
+  {
+    return 128.0;
+  }
+  static double sampleFullScale(const if_data_utils::IFSampleSC16*)
+  {
+    return 32768.0;
+  }
+  static double sampleFullScale(const if_data_utils::IFSampleFC32*)
+  {
+    return 1.0;
+  }
+  static double sampleFullScale(const if_data_utils::IFSampleFC64*)
+  {
+    return 1.0;
+  }
 
   std::function<void(const CorrelationResultsMap&)> publishAquisitionData_;
   std::function<void(const double&, const PeakResultsMap&)> publishPeakData_;
@@ -403,41 +515,49 @@ private:
     publishDiagnostics_;
 
   AcqCheckDiagnostics diagnostics_;
+
+  // the processed samples converted to floats
+  std::vector<std::complex<float>> sampleVecFloat_;
 };
 
 //==============================================================================
-//--------------------------- processIFSampleData()-----------------------------
+//----------------------------- processIFSamples() -----------------------------
 //==============================================================================
 template <typename samp_type>
-bool AcquisitionCheck::processIFSampleData(
-  const if_data_utils::IFSampleData<samp_type>& sampleData)
+bool AcquisitionCheck::processIFSamples(
+  const if_data_utils::IFSampleHeader& header,
+  const samp_type*                     samples,
+  const size_t&                        numSamples)
 {
   // if the sampling rate has changed, recalculate necessary parameters
-  if (checkForDifferentSettings(sampleData.getHeader()) or
-      (!replicasInitialized_))
+  if (checkForDifferentSettings(header) or (!replicasInitialized_))
   {
     std::stringstream recalcMsg;
     recalcMsg
-      << "AcquisitionCheck::processIFSampleData(): calculating acquisition"
-      << " paramters with sampling frequency " << sampleData.getSampleRate();
+      << "AcquisitionCheck::processIFSamples(): calculating acquisition"
+      << " paramters with sampling frequency " << header.fs_;
     logMsg_(recalcMsg.str(), logutils::LogLevel::Warn);
 
-    samplingFrequency_ = sampleData.getSampleRate();
+    samplingFrequency_ = header.fs_;
     acquisitionSetup();
   }
 
   size_t numSampsToProcess = 2 * samplesPerIntPeriod_;
-  if (sampleData.getNumberOfSamples() >= numSampsToProcess)
+  if (numSamples >= numSampsToProcess)
   {
-    // convert samples to a vector of floats
-    std::vector<std::complex<float>> sampleVecFloat;
-    buildSampleVector(
-      sampleData.getBufferPtr(), numSampsToProcess, sampleVecFloat);
+    // convert samples to floats (complex float samples pass straight through)
+    const std::complex<float>* floatSamples =
+      buildSampleVector(samples, numSampsToProcess, sampleVecFloat_);
 
     // Extract 1 integration period for processing
     // Eigen::ArrayXXf resultsP1;
-    Eigen::Map<Eigen::ArrayXcf> sampleVecP1(&sampleVecFloat[0],
-                                            samplesPerIntPeriod_);
+    Eigen::Map<const Eigen::ArrayXcf> sampleVecP1(floatSamples,
+                                                  samplesPerIntPeriod_);
+
+    // the correlation power scales with the square of the sample amplitude,
+    // so scale the thresholds (tuned for SC8) to the full scale of this type
+    double fullScaleRatio = sampleFullScale(samples) / 128.0;
+    thresholdScale_ = fullScaleRatio * fullScaleRatio;
 
     generateAcquisitionPlane(sampleVecP1);
     // std::cout << "results[0][0]" << resultsP1(0,0) << std::endl;
@@ -448,7 +568,7 @@ bool AcquisitionCheck::processIFSampleData(
   else
   {
     logMsg_(
-      "AcquisitionCheck::processIFSampleData(): did not receive "
+      "AcquisitionCheck::processIFSamples(): did not receive "
       " enough samples to process",
       logutils::LogLevel::Warn);
     return false;
@@ -456,24 +576,20 @@ bool AcquisitionCheck::processIFSampleData(
 }
 
 template <typename samp_type>
-void AcquisitionCheck::buildSampleVector(
+const std::complex<float>* AcquisitionCheck::buildSampleVector(
   const samp_type*                  bufferPtr,
   const size_t&                     numSamples,
   std::vector<std::complex<float>>& sampleVec)
 {
-  sampleVec.clear();
+  // the vector is reused between calls, so this only allocates when the
+  // number of samples grows
+  sampleVec.resize(numSamples);
   for (size_t ii = 0; ii < numSamples; ++ii)
   {
-    samp_type sampleValue = *(bufferPtr + ii);
-    // std::cout << "sample value = " << (int16_t)(sampleValue.real()) << ", "
-    //           << (int16_t)(sampleValue.imag()) << std::endl;
-
-    // std::complex<float> tmpVal = static_cast<std::complex<float>>(*(bufferPtr
-    // + ii)); std::cout << "converted value = " << tmpVal << std::endl;
-    sampleVec.push_back(
-      std::complex<float>(sampleValue.real(), sampleValue.imag()));
-    ;
+    sampleVec[ii] =
+      std::complex<float>(bufferPtr[ii].real(), bufferPtr[ii].imag());
   }
+  return sampleVec.data();
 }
 
 }  // namespace pnt_integrity
@@ -39,6 +39,10 @@
 #ifndef PNT_INTEGRITY__AGC_CHECK_HPP
 #define PNT_INTEGRITY__AGC_CHECK_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "pnt_integrity/AssuranceCheck.hpp"
 
 namespace pnt_integrity
@@ -48,6 +52,21 @@ const std::string INTEGRITY_AGC_DIAGNOSTICS = "INTEGRITY_AGC_DIAGNOSTICS";
 /// String ID for the AGC check survey inconsistent thresh
 const std::string INTEGRITY_AGC_DIAG_ITHRESH = "INTEGRITY_AGC_DIAG_ITHRESH";
 
+/// Statistics of the high-rate AGC samples for one frequency band
+struct AgcBandStatistics
+{
+  /// The number of samples since the previous check evaluation
+  size_t numSamples;
+  /// The minimum sample since the previous check evaluation
+  double min;
+  /// The maximum sample since the previous check evaluation
+  double max;
+  /// The mean of the samples since the previous check evaluation
+  double mean;
+  /// The variance of the samples since the previous check evaluation
+  double variance;
+};
+
 /// Diagnostic data for AGC check
 struct AgcCheckDiagnostics
 {
@@ -55,9 +74,22 @@ struct AgcCheckDiagnostics
   data::AgcValue values;
   /// The inconsistent threshold
   double inconsistentThresh;
+  /// Statistics of the high-rate AGC samples (bands provided through
+  /// AgcCheck::handleAgcSamples() only)
+  std::map<data::FrequencyBand, AgcBandStatistics> bandStatistics;
+  /// Deviation of each AGC value from its learned baseline, in standard
+  /// deviations (bands with a learned baseline only)
+  std::map<data::FrequencyBand, double> sigmaDeviations;
 };
 
 /// \brief Class implementation for the AGC check
+///
+/// By default, AGC values are normalized with fixed minimum and maximum
+/// values and compared to the inconsistent threshold. With the adaptive
+/// baseline enabled, the check learns the nominal AGC of each band with an
+/// exponentially weighted mean and variance while the integrity monitor (or,
+/// if the check is used without a monitor, the check itself) is assured,
+/// and flags deviations from the baseline in standard deviations.
 class AgcCheck : public AssuranceCheck
 {
 public:
@@ -74,6 +106,16 @@ public:
     : AssuranceCheck::AssuranceCheck(true, name, log)
     , maxValue_(maxValue)
     , minValue_(minValue)
+    , decimationFactor_(10)
+    , evaluationPeriod_(1.0)
+    , lastEvaluationTime_(-std::numeric_limits<double>::infinity())
+    , adaptiveBaseline_(false)
+    , inconsistentSigma_(3.0)
+    , unassuredSigma_(6.0)
+    , baselineTimeConstant_(1000.0)
+    , baselineMinSamples_(100)
+    , monitorLevel_(data::AssuranceLevel::Unavailable)
+    , monitorLevelSet_(false)
     , lastDiagPublishTime_(0.0)
   {
     allowPositiveWeighting_ = false;
@@ -92,16 +134,93 @@ public:
   ///
   /// \param agcValue The provided AGC message / structure
   /// \returns True if successful
-  bool handleAGC(const data::AgcValue& agcValue)
-  {
-    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
-    currentAgcVals_ = agcValue;
-    return runCheck();
-  }
+  bool handleAGC(const data::AgcValue& agcValue);
+
+  /// \brief Handler function for a batch of high-rate AGC samples
+  ///
+  /// Samples are passed through a moving-average decimator and a
+  /// min / max / variance tracker for their band, in O(1) per sample. The
+  /// check is only evaluated at the configured evaluation period, or
+  /// immediately when a decimated value crosses the threshold.
+  ///
+  /// \param batch The AGC samples for one frequency band
+  /// \returns True if the samples triggered a check evaluation
+  bool handleAgcSamples(const data::AgcSampleBatch& batch);
 
   /// \brief Function to explicitly set the assurance level of the check
   void calculateAssuranceLevel(const double& /*time*/) { runCheck(); };
 
+  /// \brief Sets the decimation factor for high-rate AGC samples
+  ///
+  /// \param factor The number of samples averaged into each decimated value
+  void setDecimationFactor(const size_t& factor)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    decimationFactor_ = std::max(factor, (size_t)1);
+  };
+
+  /// \brief Sets the evaluation period for high-rate AGC samples
+  ///
+  /// \param period The time between check evaluations [s] when no threshold
+  /// crossing occurs
+  void setEvaluationPeriod(const double& period)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    evaluationPeriod_ = period;
+  };
+
+  /// \brief Enables the adaptive AGC baseline
+  ///
+  /// Until a band's baseline has learned from minSamples values, the band is
+  /// checked with the fixed min / max normalization.
+  ///
+  /// \param inconsistentSigma Deviation (in standard deviations) from the
+  /// baseline that indicates an inconsistent level
+  /// \param unassuredSigma Deviation (in standard deviations) from the
+  /// baseline that indicates an unassured level
+  /// \param timeConstant The time constant of the exponentially weighted
+  /// baseline, in (decimated) AGC values
+  /// \param minSamples The number of values to learn before the baseline is
+  /// used
+  void enableAdaptiveBaseline(const double& inconsistentSigma = 3.0,
+                              const double& unassuredSigma    = 6.0,
+                              const double& timeConstant      = 1000.0,
+                              const size_t& minSamples        = 100)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    adaptiveBaseline_     = true;
+    inconsistentSigma_    = inconsistentSigma;
+    unassuredSigma_       = unassuredSigma;
+    baselineTimeConstant_ = std::max(timeConstant, 1.0);
+    baselineMinSamples_   = minSamples;
+  };
+
+  /// \brief Disables the adaptive AGC baseline (learned baselines are kept)
+  void disableAdaptiveBaseline()
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    adaptiveBaseline_ = false;
+  };
+
+  /// \brief Clears the learned AGC baselines
+  void clearBaselines()
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    baselines_.clear();
+  };
+
+  /// \brief Provides the check with the monitor's overall assurance level
+  ///
+  /// Baselines are only learned while the overall level is assured.
+  ///
+  /// \param level The overall assurance level
+  void setMonitorAssuranceLevel(const data::AssuranceLevel& level)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    monitorLevel_    = level;
+    monitorLevelSet_ = true;
+  };
+
   /// \brief Connects the internal publishing function to external interface
   ///
   /// This function connects the internal "publishDiagnostics" function
@@ -117,11 +236,93 @@ public:
   };
 
 private:
+  /// \brief Front-end state for the high-rate AGC samples of one band
+  struct AgcBandState
+  {
+    /// Running sum of the current decimation block
+    double decimatorSum = 0.0;
+    /// The number of samples in the current decimation block
+    size_t decimatorCount = 0;
+    /// The most recent decimated value
+    double output = 0.0;
+    /// Flag to indicate that a decimated value is available
+    bool outputValid = false;
+    /// The level of the last decimated value
+    data::AssuranceLevel level = data::AssuranceLevel::Unavailable;
+    /// Running statistics since the previous check evaluation
+    size_t numSamples = 0;
+    double mean       = 0.0;
+    double m2         = 0.0;
+    double min        = 0.0;
+    double max        = 0.0;
+  };
+
+  /// \brief Normalizes an AGC value with the min and max values
+  double normalizeValue(const double& value) const
+  {
+    return (value - minValue_) / (maxValue_ - minValue_);
+  };
+
+  /// \brief Exponentially weighted AGC baseline for one band
+  struct AgcBaseline
+  {
+    /// The number of values learned
+    size_t numSamples = 0;
+    /// The baseline mean
+    double mean = 0.0;
+    /// The baseline variance
+    double variance = 0.0;
+  };
+
+  /// \brief Determines the level indicated by an AGC value
+  ///
+  /// \param band The frequency band of the value
+  /// \param value The AGC value
+  /// \param sigmaDeviation Returns the deviation from the baseline in
+  /// standard deviations (NaN if the baseline is not used)
+  /// \returns The level indicated by the value
+  data::AssuranceLevel valueLevel(const data::FrequencyBand& band,
+                                  const double&              value,
+                                  double&                    sigmaDeviation);
+
+  /// \brief Learns an AGC value into the band's baseline
+  ///
+  /// The value is only learned when the adaptive baseline is enabled, the
+  /// overall level is assured, and the value itself is not unassured.
+  ///
+  /// \param band The frequency band of the value
+  /// \param value The AGC value
+  void learnBaseline(const data::FrequencyBand& band, const double& value);
+
+  /// \brief Evaluates the check with the latest decimated value of each band
+  ///
+  /// \param time The time of the evaluation
+  void evaluateBands(const double& time);
+
   double maxValue_;
   double minValue_;
 
   data::AgcValue currentAgcVals_;
 
+  // Front-end state for each band provided through handleAgcSamples()
+  std::map<data::FrequencyBand, AgcBandState> bandStates_;
+
+  size_t decimationFactor_;
+  double evaluationPeriod_;
+  double lastEvaluationTime_;
+
+  // Adaptive baseline configuration and learned baselines
+  bool                                        adaptiveBaseline_;
+  double                                      inconsistentSigma_;
+  double                                      unassuredSigma_;
+  double                                      baselineTimeConstant_;
+  size_t                                      baselineMinSamples_;
+  std::map<data::FrequencyBand, AgcBaseline> baselines_;
+
+  // The overall level most recently provided by the integrity monitor
+  data::AssuranceLevel monitorLevel_;
+  bool                 monitorLevelSet_;
+
   bool runCheck();
 
   std::function<void(const double& /*timestamp*/,
@@ -77,6 +77,8 @@ struct AoaCheckDiagnostics
 {
   /// The threshold that is used when comparing single differences
   double singleDiffThresh;
+  /// The threshold that is used when comparing carrier-phase differences
+  double carrierDiffThresh;
   /// The number of PRNS that are unavailable (UNAVAILABLE)
   double unavailablePrnPercent;
   /// The number of PRNS that appear suspect (UNASSURED or INCONSISTENT)
@@ -91,7 +93,12 @@ struct AoaCheckDiagnostics
   double assuredThresh;
 };
 
-/// Enumeration to indicate what data field to use for the AOA check
+/// \brief Enumeration to indicate what data field to use for the AOA check
+///
+/// UseCarrierPhase compares the between-epoch change of the carrier-phase
+/// single differences, and only uses PRNs with carrier tracking on both nodes.
+/// UseBoth runs both the pseudorange and the carrier-phase comparisons, each
+/// against its own threshold.
 enum class AoaCheckData
 {
   UsePseudorange = 0,
@@ -102,6 +109,32 @@ enum class AoaCheckData
 /// Defines a type that maps PRN to a calculated difference
 using SingleDiffMap = std::map<int, double>;
 
+/// \brief Carrier-phase single difference tracking state
+///
+/// Holds the carrier-phase single difference of a single PRN between the
+/// local node and one remote node from the previous epoch. Differencing it
+/// against the current epoch cancels the (constant) integer ambiguity, so the
+/// between-epoch change is carrier-level (millimeters) as long as lock is
+/// held on both nodes.
+struct CarrierDiffState
+{
+  /// The carrier-phase single difference from the previous epoch (m)
+  double singleDiff;
+  /// The time of the last update to the state
+  double lastUpdateTime;
+  /// True if the state holds a single difference from a previous epoch
+  bool valid;
+
+  /// \brief Default constructor
+  CarrierDiffState() : singleDiff(0.0), lastUpdateTime(0.0), valid(false){};
+};
+
+/// Defines a map that holds the carrier-phase tracking state for each PRN
+using CarrierDiffStateMap = std::map<int, CarrierDiffState>;
+
+/// Defines a map that holds the carrier-phase tracking state for each node
+using CarrierDiffStateEachNode = std::map<std::string, CarrierDiffStateMap>;
+
 /// Defines a map that holds an assurance level for each prn for each node
 using PrnAssuranceEachNode = std::map<int, std::vector<data::AssuranceLevel> >;
 
@@ -121,7 +154,7 @@ public:
   /// \param name The name associated with the check
   /// \param aoaCheckData Sets which type of data will be used
   /// \param singleDiffCompareThresh Sets the threshold for comparing single
-  ///                                difference values
+  ///                                difference values (m)
   /// \param prnCountThresh A threshold used in the AOA check to determine
   ///                       if a PRN has a common AOA with other PRNs.
   /// \param rangeThreshold A distance threshold that is used when to
@@ -141,6 +174,8 @@ public:
     , singleDiffCompareFailureLimit_(0.5)
     , prnCountThresh_(prnCountThresh)
     , rangeThreshold_(rangeThreshold)
+    , carrierDiffCompareThresh_(0.005)
+    , carrierResetGap_(2.0)
     , lastDiagPublishTime_(0.0)
     , lastDiffPublishTime_(0.0)
   {
@@ -149,7 +184,7 @@ public:
             << ") with parameters: " << std::endl;
     initMsg << "data mode (0-psr, 1-cp, 2-both): " << (int)aoaCheckData
             << std::endl;
-    initMsg << "single diff thresh (m / deg): " << singleDiffCompareThresh
+    initMsg << "single diff thresh (m): " << singleDiffCompareThresh
             << std::endl;
     initMsg << "prn count thresh:" << prnCountThresh << std::endl;
     initMsg << "range threshold: " << rangeThreshold;
@@ -185,9 +220,9 @@ public:
   ///
   /// This threshold is used to determine when 2 separate single differences
   /// (between a local and remote node) should be flagged has having a common
-  /// angle of arrival. The units on this threshold depend on the type of data
-  /// that is being used for the check (AoaCheckData). For example if,
-  /// AoaCheckData::UsePseudorange is being used, then the units are in meters.
+  /// angle of arrival. The threshold (m) applies to the pseudorange single
+  /// differences; the carrier-phase comparison uses its own threshold (see
+  /// setCarrierDiffComparisonThreshold).
   ///
   /// \param thresh The threshold value to use
   void setDifferenceComparisonThreshold(const double& thresh)
@@ -233,6 +268,36 @@ public:
     rangeThreshold_ = thresh;
   };
 
+  /// \brief Sets the carrier-phase difference comparison threshold
+  ///
+  /// When carrier-phase data is used, the between-epoch change of each
+  /// carrier-phase single difference is divided by the epoch interval and
+  /// compared across PRNs. The receiver clock terms are common to all PRNs,
+  /// so genuine signals differ by the change in the baseline projection onto
+  /// each line of sight, while signals from a single source do not differ
+  /// beyond carrier noise. The threshold is in meters per second and should
+  /// be at the millimeter level.
+  ///
+  /// \param thresh The threshold value to use (m/s)
+  void setCarrierDiffComparisonThreshold(const double& thresh)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    carrierDiffCompareThresh_ = thresh;
+  };
+
+  /// \brief Sets the carrier tracking reset gap
+  ///
+  /// If no carrier-phase single difference has been formed for a PRN within
+  /// this amount of time, its tracked state is discarded and re-initialized
+  /// on the next valid epoch.
+  ///
+  /// \param gap The reset gap (seconds)
+  void setCarrierResetGap(const double& gap)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    carrierResetGap_ = gap;
+  };
+
   /// \brief Connects the internal publishing function to external interface
   ///
   /// This function connects the internal "publishSingleDiffData" function
@@ -267,10 +332,19 @@ private:
                            const RemoteRepoEntries& remoteEntries);
 
   void nestedForLoopComparison(const SingleDiffMap&  singDiffMap,
+                               const double&         compareThresh,
                                PrnAssuranceEachNode& prnAssuranceEachNode);
 
   void setPrnAssuranceLevels(const PrnAssuranceEachNode& prnAssuranceEachNode);
 
+  bool computeCarrierSingleDiff(const double&               checkTime,
+                                const data::GNSSObservable& localObs,
+                                const data::GNSSObservable& remoteObs,
+                                CarrierDiffState&           state,
+                                double&                     singleDiff);
+
+  void pruneCarrierDiffStates(const double& checkTime);
+
   AoaCheckData aoaCheckData_;
 
   double singleDiffCompareThresh_;
@@ -284,6 +358,16 @@ private:
   // difference is not calculated
   double rangeThreshold_;
 
+  // The threshold for comparing between-epoch carrier-phase single
+  // differences (m/s)
+  double carrierDiffCompareThresh_;
+
+  // The time without an update after which a carrier state is discarded
+  double carrierResetGap_;
+
+  // The carrier-phase tracking state for each remote node and PRN
+  CarrierDiffStateEachNode carrierDiffStates_;
+
   std::function<void(const double&      time,
                      const std::string& remoteNodeId,
                      const SingleDiffMap&)>
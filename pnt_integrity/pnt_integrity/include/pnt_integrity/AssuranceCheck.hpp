@@ -43,12 +43,29 @@
 #include "logutils/logutils.hpp"
 #include "pnt_integrity/IntegrityData.hpp"
 #include "pnt_integrity/IntegrityDataRepository.hpp"
+#include "pnt_integrity/TimerWheel.hpp"
+
+#include <memory>
+#include <mutex>
 
 namespace pnt_integrity
 {
 /// A map for pairing an assurance level to each PRN
 using MultiPrnAssuranceMap = std::map<int, data::AssuranceLevel>;
 
+class IntegrityMonitor;
+
+/// \brief Link from registered checks back to their integrity monitor
+///
+/// Shared between a monitor and the checks registered with it. The monitor
+/// clears the pointer when it is destroyed, so a check that outlives its
+/// monitor does not try to unregister from it.
+struct MonitorLink
+{
+  std::mutex        mutex;
+  IntegrityMonitor* monitor = nullptr;
+};
+
 /// \brief Parent class for all integrity checks
 ///
 /// Pure virtual parent class that holds common functionality accross all
@@ -87,7 +104,8 @@ public:
     , assuranceState_()
     , weight_(1.0){};
 
-  virtual ~AssuranceCheck() = default;
+  /// \brief Destructor, unregisters the check from its integrity monitor
+  virtual ~AssuranceCheck() { leaveMonitor(); };
 
   /// \brief Handler function for GNSS Observables
   ///
@@ -187,6 +205,30 @@ public:
     return false;
   };
 
+  /// \brief Handler function for IF sample data (FC32)
+  ///
+  /// Function to handle provided IF data (virtual)
+  ///
+  /// \returns True if successful
+  virtual bool handleIFSampleData(
+    const double& /*time*/,
+    const if_data_utils::IFSampleData<if_data_utils::IFSampleFC32>& /*ifData*/)
+  {
+    return false;
+  };
+
+  /// \brief Handler function for IF sample data (FC64)
+  ///
+  /// Function to handle provided IF data (virtual)
+  ///
+  /// \returns True if successful
+  virtual bool handleIFSampleData(
+    const double& /*time*/,
+    const if_data_utils::IFSampleData<if_data_utils::IFSampleFC64>& /*ifData*/)
+  {
+    return false;
+  };
+
   /// \brief Handler function for Clock Offset sample data
   ///
   /// Function to handle provided Clock Offset data (virtual)
@@ -214,6 +256,16 @@ public:
   /// \returns True if successful
   virtual bool handleAGC(const data::AgcValue& /*value*/) { return false; };
 
+  /// \brief Handler function for a batch of high-rate AGC samples
+  ///
+  /// Function to handle provided AGC sample batches (virtual)
+  ///
+  /// \returns True if the samples triggered a check evaluation
+  virtual bool handleAgcSamples(const data::AgcSampleBatch& /*batch*/)
+  {
+    return false;
+  };
+
   /// \brief Returns the AssuranceLevel enumeration value associated with the
   /// check's AssuranceState
   data::AssuranceLevel getAssuranceLevel()
@@ -386,6 +438,25 @@ public:
     const data::GeodeticPosition3d& /*position*/,
     const data::AssuranceLevel& /*level*/){};
 
+  /// \brief Provides the check with the monitor's overall assurance level
+  ///
+  /// Called by the integrity monitor each time the overall level is
+  /// determined, for checks that adapt to the overall level (e.g. learning a
+  /// nominal baseline only during assured periods). The default behavior is
+  /// null, but can be overridden in child classes.
+  virtual void setMonitorAssuranceLevel(
+    const data::AssuranceLevel& /*level*/){};
+
+  /// \brief Provides the check with a shared timer wheel
+  ///
+  /// Called by the integrity monitor when it owns a timer wheel, so that
+  /// checks with time-based expiry can schedule re-evaluations without a
+  /// dedicated thread. The check shares ownership of the wheel, so it stays
+  /// valid if the monitor is destroyed first. A null pointer means no wheel
+  /// is available. The default behavior is null, but can be overridden in
+  /// child classes.
+  virtual void setTimerWheel(std::shared_ptr<TimerWheel> /*wheel*/){};
+
   /// \brief Sets the weight of the check
   ///
   /// The weight of the check is used when combining the assurance level of this
@@ -537,7 +608,18 @@ protected:
     return dist > thresh;
   }
 
+  /// \brief Unregisters the check from the integrity monitor it was
+  /// registered with (if any)
+  ///
+  /// Called by the destructor. Child classes that are driven from another
+  /// thread (e.g. by the monitor's timer wheel) should call it first in their
+  /// own destructor, so the monitor stops calling into them before their
+  /// members are destroyed.
+  void leaveMonitor();
+
 private:
+  friend class IntegrityMonitor;
+
   bool multiPrnSupport_;
 
   // The overall assurance level calculated for the check
@@ -546,6 +628,9 @@ private:
   // The weight of this check that will be used when combining with other
   // checks
   double weight_;
+
+  // link to the monitor the check is registered with
+  std::shared_ptr<MonitorLink> monitorLink_;
 };
 
 }  // namespace pnt_integrity
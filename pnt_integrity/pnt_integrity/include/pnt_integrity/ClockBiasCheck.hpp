@@ -39,6 +39,7 @@
 //============================================================================//
 #ifndef PNT_INTEGRITY__CLOCK_BIAS_CHECK_HPP
 #define PNT_INTEGRITY__CLOCK_BIAS_CHECK_HPP
+#include <algorithm>
 #include <cstring>
 #include "pnt_integrity/AssuranceCheck.hpp"
 
@@ -142,6 +143,16 @@ public:
     , minSampleTimeSec_(minSampleTimeSec)
     , driftRateBound_(driftRateBound)
     , driftRateVarBound_(driftRateVarBound)
+    , offsetRing_(std::max(maxNumSamples, 1u))
+    , ringHead_(0)
+    , ringCount_(0)
+    , historyNumSamples_(0)
+    , historyDriftShift_(0.0)
+    , historyDriftSum_(0.0)
+    , historyDriftSumComp_(0.0)
+    , historyDriftSumSq_(0.0)
+    , historyDriftSumSqComp_(0.0)
+    , detailedLogging_(false)
   {
     allowPositiveWeighting_ = false;
 
@@ -177,6 +188,19 @@ public:
   /// \returns True if successful
   bool runCheck();
 
+  /// \brief Enables or disables the detailed per-sample debug log messages
+  ///
+  /// The detailed messages (drift statistics, propagated offset, offset
+  /// error) are only formatted when enabled, keeping the per-sample cost of
+  /// the check low when they are not needed.
+  ///
+  /// \param enable True to enable the detailed log messages
+  void setDetailedLogging(const bool& enable)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    detailedLogging_ = enable;
+  };
+
   /// \brief Connects the internal publishing function to external interface
   ///
   /// This function connects the internal "publishDiagnostics" function
@@ -201,8 +225,29 @@ private:
   /// statement about the position
   bool clockBiasCheck(const double& checkTime);
 
-  /// \brief Prunes the time map of old times
-  void pruneVec();
+  /// \brief Adds a sample to the window, evicting the oldest if full
+  ///
+  /// The running drift statistics cover every sample in the window except
+  /// the newest. They are updated in O(1) as samples enter and leave that
+  /// history.
+  ///
+  /// \param clockOffset The sample to add
+  void pushOffset(const data::ClockOffset& clockOffset);
+
+  /// \brief Adds a drift value to the running history statistics
+  void addHistoryDrift(const double& drift);
+
+  /// \brief Removes a drift value from the running history statistics
+  void removeHistoryDrift(const double& drift);
+
+  /// \brief Adds a value to a compensated (Kahan-Babuska) running sum
+  static void compensatedAdd(double& sum, double& comp, const double& value);
+
+  /// \brief Returns the sample at the given age (0 is the oldest)
+  const data::ClockOffset& offsetAt(const size_t& index) const
+  {
+    return offsetRing_[(ringHead_ + index) % offsetRing_.size()];
+  };
 
   bool enoughSampleTime();
 
@@ -217,7 +262,25 @@ private:
   double       driftRateBound_;
   double       driftRateVarBound_;
 
-  std::vector<data::ClockOffset> offsetVec_;
+  // Ring buffer holding the most recent samples
+  std::vector<data::ClockOffset> offsetRing_;
+  // Index of the oldest sample in the ring buffer
+  size_t ringHead_;
+  // The number of samples in the ring buffer
+  size_t ringCount_;
+
+  // Running drift statistics over all but the newest sample. The sums are of
+  // the drifts less a shift (the first drift in the history), and are kept
+  // with compensated addition so removals do not accumulate rounding error
+  size_t historyNumSamples_;
+  double historyDriftShift_;
+  double historyDriftSum_;
+  double historyDriftSumComp_;
+  double historyDriftSumSq_;
+  double historyDriftSumSqComp_;
+
+  // Flag to enable the detailed per-sample log messages
+  bool detailedLogging_;
 
   std::function<void(const double& /*timestamp*/,
                      const ClockBiasCheckDiagnostics& /*checkData*/)>
@@ -39,6 +39,8 @@
 #ifndef PNT_INTEGRITY__CNO_CHECK_HPP
 #define PNT_INTEGRITY__CNO_CHECK_HPP
 
+#include <algorithm>
+
 #include "pnt_integrity/AssuranceCheck.hpp"
 
 namespace pnt_integrity
@@ -52,19 +54,49 @@ const std::string INTEGRITY_CN0_DIAG_ITHRESH = "INTEGRITY_CN0_DIAG_ITHRESH";
 /// String ID for the CNO check survey unassured thresh
 const std::string INTEGRITY_CN0_DIAG_UTHRESH = "INTEGRITY_CN0_DIAG_UTHRESH";
 
+/// Diagnostic data for one (satellite system, frequency band) group
+struct CnoGroupDiagnostics
+{
+  /// The satellite system of the group
+  data::SatelliteSystem satelliteSystem;
+  /// The frequency band of the group
+  data::FrequencyBand frequencyBand;
+  /// The C/N0 mode of the newest epoch (dB-Hz)
+  double mode;
+  /// The C/N0 variance of the newest epoch (dB-Hz^2)
+  double variance;
+  /// The average number of PRNs within 1 unit of the mode over the window
+  double averageCount;
+  /// The inconsistent threshold scaled to the size of the group
+  double inconsistentThresh;
+  /// The unassured threshold scaled to the size of the group
+  double unassuredThresh;
+  /// The assurance level of the group
+  data::AssuranceLevel assuranceLevel;
+};
+
 /// Diagnostic data for the check
 struct CnoCheckDiagnostics
 {
-  /// the number of PRNs within 1 unit of the mode
+  /// the number of PRNs within 1 unit of the mode (largest over the groups)
   int averageCount;
   /// The threshold for the inconsistent assurance level
   double inconsistentThresh;
   /// The threshold for the unassured assurance level
   double unassuredThresh;
+  /// Per (satellite system, frequency band) group diagnostics
+  std::vector<CnoGroupDiagnostics> groups;
 };
 
 /// \brief Class implementation of the carrier-to-noise (CnO) assurance check.
 /// The check analyzes the CnO values for abnormalities.
+///
+/// Observables are grouped by satellite system and frequency band, since
+/// each sits at its own nominal C/N0 level. Each group has its own mode,
+/// variance and filter window, and the check level is the worst level among
+/// the groups present in the newest epoch. The assurance thresholds are
+/// counts for all of the C/N0 values of an epoch together, so each group is
+/// compared against them scaled by its share of the epoch's values.
 class CnoCheck : public AssuranceCheck
 {
   /// \brief Constructor for the CnoCheck object
@@ -79,6 +111,9 @@ public:
            const logutils::LogCallback& log = logutils::printLogToStdOut)
     : AssuranceCheck::AssuranceCheck(false, name, log)
     , cnoFilterWindow_(cnoFilterWindow)
+    , groupStates_(numCnoGroups)
+    , cnoHistogram_(numCnoBins, 0)
+    , lastProcessedTime_(-1.0)
     , lastPublishTime_(0.0)
   {
     allowPositiveWeighting_ = false;
@@ -122,6 +157,16 @@ public:
   {
     std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
     cnoFilterWindow_ = windowSize;
+
+    // restart the group windows with the new size
+    for (auto groupIt = groupStates_.begin(); groupIt != groupStates_.end();
+         ++groupIt)
+    {
+      groupIt->countWindow.clear();
+      groupIt->countWindowHead = 0;
+      groupIt->countWindowSize = 0;
+      groupIt->countWindowSum  = 0;
+    }
   }
 
   /// \brief Connects the internal publishing function to external interface
@@ -139,10 +184,103 @@ public:
   };
 
 private:
+  /// \brief Running state of one (satellite system, frequency band) group
+  struct CnoGroupState
+  {
+    /// Ring buffer of the per-epoch near-mode counts in the filter window
+    std::vector<size_t> countWindow;
+    /// Index of the oldest count in the window
+    size_t countWindowHead = 0;
+    /// The number of counts in the window
+    size_t countWindowSize = 0;
+    /// Running sum of the counts in the window
+    size_t countWindowSum = 0;
+    /// Reused storage for the group's C/N0 values in the current epoch
+    std::vector<double> epochCnoVals;
+    /// Running sums of the group's C/N0 values in the current epoch
+    double epochCnoSum   = 0.0;
+    double epochCnoSumSq = 0.0;
+    /// The C/N0 mode of the newest epoch with data
+    double mode = 0.0;
+    /// The C/N0 variance of the newest epoch with data
+    double variance = 0.0;
+    /// The time of the newest epoch with data for the group
+    double lastEpochTime = -1.0;
+  };
+
+  /// \brief Computes the mode of the provided C/N0 values
+  ///
+  /// Values are binned into a fixed histogram of cnoBinWidth (dB-Hz) bins,
+  /// and the center of the most populated bin is returned. Non-finite values
+  /// are ignored.
+  ///
+  /// \param cnoVals The C/N0 values (dB-Hz)
+  /// \returns The mode of the values, or -1 if no finite values are provided
   double computeCnoMode(const std::vector<double>& cnoVals);
 
-  std::deque<size_t> cnoCheckCountHist_;
-  size_t             cnoFilterWindow_;
+  /// \brief Returns the histogram bin of a finite C/N0 value
+  ///
+  /// Values outside the histogram are clamped to its first or last bin
+  /// before the conversion to an index.
+  static size_t cnoBin(const double& cno)
+  {
+    const double position = cno / cnoBinWidth;
+    if (position <= 0.0)
+    {
+      return 0;
+    }
+    return (position < (double)(numCnoBins - 1)) ? (size_t)position
+                                                  : numCnoBins - 1;
+  }
+
+  /// \brief Processes a single repository epoch
+  ///
+  /// Distributes the epoch's C/N0 values to their groups in a single pass,
+  /// then computes each group's mode, variance and number of observables
+  /// near the mode and adds the count to the group's filter window
+  ///
+  /// \param entry The repository entry to process
+  void processEpoch(const TimeEntry& entry);
+
+  /// \brief Adds an epoch count to a group's filter window
+  void pushCount(CnoGroupState& group, const size_t& count);
+
+  /// \brief Returns the group index for a satellite system and band
+  static size_t groupIndex(const data::SatelliteSystem& system,
+                           const data::FrequencyBand&   band)
+  {
+    return static_cast<size_t>(system) * numFrequencyBands +
+           static_cast<size_t>(band);
+  }
+
+  /// The width of the C/N0 histogram bins (dB-Hz)
+  constexpr static double cnoBinWidth = 0.25;
+  /// The number of C/N0 histogram bins (covers 0 to 100 dB-Hz)
+  constexpr static size_t numCnoBins = 400;
+  /// The number of satellite systems (data::SatelliteSystem)
+  constexpr static size_t numSatelliteSystems =
+    static_cast<size_t>(data::SatelliteSystem::Other) + 1;
+  /// The number of frequency bands (data::FrequencyBand)
+  constexpr static size_t numFrequencyBands =
+    static_cast<size_t>(data::FrequencyBand::Band10) + 1;
+  /// The number of (satellite system, frequency band) groups
+  constexpr static size_t numCnoGroups =
+    numSatelliteSystems * numFrequencyBands;
+
+  size_t cnoFilterWindow_;
+
+  // Running state for each (satellite system, frequency band) group,
+  // indexed by groupIndex()
+  std::vector<CnoGroupState> groupStates_;
+
+  // Indices of the groups with data in the epoch being processed
+  std::vector<size_t> epochGroups_;
+
+  // Reused working storage for the C/N0 histogram
+  std::vector<unsigned int> cnoHistogram_;
+
+  // The time of the newest repository epoch that has been processed
+  double lastProcessedTime_;
 
   std::function<void(const double& /*timestamp*/,
                      const CnoCheckDiagnostics& /*checkData*/)>
@@ -242,6 +242,9 @@ public:
   /// \brief Get the full GPS reference week
   uint16_t getReferenceWeek() const { return (referenceWeek_); };
 
+  /// \brief Get the almanac reference time (s into the GPS week)
+  double getTimeOfAlmanac() const { return (toa_); };
+
   AlmanacSubframeFaults getSubframeFaults() const { return subframeFaults_; };
 
   /// \brief Parse the given subframe into the Almanac object
@@ -463,6 +463,9 @@ public:
   /// \returns the time of ephemeris in seconds into the week
   double getTimeOfEphemeris() const { return (timeOfEphemeris_); }
 
+  /// \brief Get the issue of data, ephemeris (from subframe 2)
+  uint16_t getIode() const { return (iodeSf2_); }
+
   uint32_t getTowSf1() const { return towSf1_; }
   uint32_t getTowSf2() const { return towSf2_; }
   uint32_t getTowSf3() const { return towSf3_; }
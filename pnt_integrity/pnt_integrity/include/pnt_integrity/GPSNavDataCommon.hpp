@@ -46,7 +46,7 @@
 namespace pnt_integrity
 {
 /// PI as defined in IS-GPS-200 (30.3.3.1.3)
-const double gpsPi = 3.1415926535898;
+constexpr double gpsPi = 3.1415926535898;
 /// 2 * PI as defined in IS-GPS-200 (convenience constant)
 const double twoGpsPi = 2.0 * gpsPi;
 /// Speed of light as defined in IS-GPS-200 (20.3.4.3) [m/s]
@@ -132,6 +132,189 @@ void convertSubframeFrom30To10Word(const uint8_t (&sfIn)[30],
 void removeSubframeParity(const uint32_t (&subframeWordsIn)[10],
                           uint32_t (&subframeWordsOut)[10]);
 
+/// \brief Returns 2^exponent, usable in constant expressions
+constexpr double navPow2(int exponent)
+{
+  double value = 1.0;
+  for (; exponent > 0; --exponent)
+  {
+    value *= 2.0;
+  }
+  for (; exponent < 0; ++exponent)
+  {
+    value /= 2.0;
+  }
+  return value;
+}
+
+/// \brief Description of a field in a navigation data message
+///
+/// Bit offsets count from the most significant bit of the first byte of the
+/// message with parity removed (e.g. an LNAV subframe as 30 bytes, where word
+/// n starts at bit 24 * (n - 1)). A field may be split in two parts, with the
+/// first part holding the most significant bits (e.g. IODC).
+struct NavDataField
+{
+  uint16_t bitOffset;     ///< Offset of the (most significant) part
+  uint8_t  numBits;       ///< Width of the (most significant) part
+  uint16_t lsbBitOffset;  ///< Offset of the least significant part
+  uint8_t  lsbNumBits;    ///< Width of the least significant part (or 0)
+  bool     isSigned;      ///< True for two's complement fields
+  double   scale;         ///< Scale factor of the least significant bit
+
+  /// \brief Constructor for a contiguous field
+  constexpr NavDataField(uint16_t offset,
+                         uint8_t  bits,
+                         bool     sign     = false,
+                         double   lsbScale = 1.0)
+    : bitOffset(offset)
+    , numBits(bits)
+    , lsbBitOffset(0)
+    , lsbNumBits(0)
+    , isSigned(sign)
+    , scale(lsbScale)
+  {
+  }
+
+  /// \brief Constructor for a field split in two parts
+  constexpr NavDataField(uint16_t msbOffset,
+                         uint8_t  msbBits,
+                         uint16_t lsbOffset,
+                         uint8_t  lsbBits,
+                         bool     sign,
+                         double   lsbScale)
+    : bitOffset(msbOffset)
+    , numBits(msbBits)
+    , lsbBitOffset(lsbOffset)
+    , lsbNumBits(lsbBits)
+    , isSigned(sign)
+    , scale(lsbScale)
+  {
+  }
+};
+
+/// \brief Extracts up to 32 bits from a message, most significant bit first
+inline uint32_t extractNavBits(const uint8_t* data,
+                               uint16_t       bitOffset,
+                               uint8_t        numBits)
+{
+  const uint8_t* bytes    = data + (bitOffset >> 3);
+  const unsigned shift    = bitOffset & 7;
+  const unsigned numBytes = (shift + numBits + 7) >> 3;
+
+  uint64_t bits = 0;
+  for (unsigned i = 0; i < numBytes; ++i)
+  {
+    bits = (bits << 8) | bytes[i];
+  }
+  bits >>= (numBytes * 8 - shift - numBits);
+  return (uint32_t)(bits & ((1ULL << numBits) - 1));
+}
+
+/// \brief Extracts the raw (unscaled) bits of a field
+inline uint32_t extractNavRaw(const uint8_t* data, const NavDataField& field)
+{
+  uint32_t raw = extractNavBits(data, field.bitOffset, field.numBits);
+  if (field.lsbNumBits > 0)
+  {
+    raw = (raw << field.lsbNumBits) |
+          extractNavBits(data, field.lsbBitOffset, field.lsbNumBits);
+  }
+  return raw;
+}
+
+/// \brief Extracts a field and applies its sign and scale factor
+inline double extractNavField(const uint8_t* data, const NavDataField& field)
+{
+  const uint32_t raw       = extractNavRaw(data, field);
+  const unsigned totalBits = field.numBits + field.lsbNumBits;
+  if (field.isSigned && (totalBits < 32))
+  {
+    // sign extend from the field's most significant bit
+    const uint32_t signBit = 1U << (totalBits - 1);
+    return (double)((int32_t)(raw ^ signBit) - (int32_t)signBit) * field.scale;
+  }
+  else if (field.isSigned)
+  {
+    return (double)((int32_t)raw) * field.scale;
+  }
+  return (double)raw * field.scale;
+}
+
+/// Field tables for GPS LNAV subframes (IS-GPS-200 20.3.3)
+namespace lnav
+{
+/// TLM and HOW fields common to all subframes
+constexpr NavDataField preamble(0, 8);
+constexpr NavDataField towCount(24, 17, false, 6.0);
+constexpr NavDataField alertFlag(41, 1);
+constexpr NavDataField antiSpoofFlag(42, 1);
+constexpr NavDataField subframeId(43, 3);
+
+/// Subframe 1 (clock correction and health) fields
+namespace sf1
+{
+constexpr NavDataField weekNumber(48, 10);
+constexpr NavDataField codeOnL2(58, 2);
+constexpr NavDataField uraIndex(60, 4);
+constexpr NavDataField svHealth(64, 6);
+constexpr NavDataField iodc(70, 2, 168, 8, false, 1.0);
+constexpr NavDataField l2pDataFlag(72, 1);
+constexpr NavDataField tgd(160, 8, true, navPow2(-31));
+constexpr NavDataField toc(176, 16, false, navPow2(4));
+constexpr NavDataField af2(192, 8, true, navPow2(-55));
+constexpr NavDataField af1(200, 16, true, navPow2(-43));
+constexpr NavDataField af0(216, 22, true, navPow2(-31));
+}  // namespace sf1
+
+/// Subframe 2 (ephemeris) fields
+namespace sf2
+{
+constexpr NavDataField iode(48, 8);
+constexpr NavDataField crs(56, 16, true, navPow2(-5));
+constexpr NavDataField deltaN(72, 16, true, gpsPi * navPow2(-43));
+constexpr NavDataField m0(88, 32, true, gpsPi * navPow2(-31));
+constexpr NavDataField cuc(120, 16, true, navPow2(-29));
+constexpr NavDataField eccentricity(136, 32, false, navPow2(-33));
+constexpr NavDataField cus(168, 16, true, navPow2(-29));
+constexpr NavDataField sqrtA(184, 32, false, navPow2(-19));
+constexpr NavDataField toe(216, 16, false, navPow2(4));
+constexpr NavDataField fitInterval(232, 1);
+constexpr NavDataField aodo(233, 5, false, 900.0);
+}  // namespace sf2
+
+/// Subframe 3 (ephemeris) fields
+namespace sf3
+{
+constexpr NavDataField cic(48, 16, true, navPow2(-29));
+constexpr NavDataField omega0(64, 32, true, gpsPi * navPow2(-31));
+constexpr NavDataField cis(96, 16, true, navPow2(-29));
+constexpr NavDataField i0(112, 32, true, gpsPi * navPow2(-31));
+constexpr NavDataField crc(144, 16, true, navPow2(-5));
+constexpr NavDataField omega(160, 32, true, gpsPi * navPow2(-31));
+constexpr NavDataField omegaDot(192, 24, true, gpsPi * navPow2(-43));
+constexpr NavDataField iode(216, 8);
+constexpr NavDataField iDot(224, 14, true, gpsPi * navPow2(-43));
+}  // namespace sf3
+
+/// Subframe 4 and 5 almanac page fields
+namespace almanac
+{
+constexpr NavDataField svId(50, 6);
+constexpr NavDataField eccentricity(56, 16, false, navPow2(-21));
+constexpr NavDataField toa(72, 8, false, navPow2(12));
+constexpr NavDataField deltaI(80, 16, true, gpsPi * navPow2(-19));
+constexpr NavDataField omegaDot(96, 16, true, gpsPi * navPow2(-38));
+constexpr NavDataField svHealth(112, 8);
+constexpr NavDataField sqrtA(120, 24, false, navPow2(-11));
+constexpr NavDataField omega0(144, 24, true, gpsPi * navPow2(-23));
+constexpr NavDataField omega(168, 24, true, gpsPi * navPow2(-23));
+constexpr NavDataField m0(192, 24, true, gpsPi * navPow2(-23));
+constexpr NavDataField af0(216, 8, 235, 3, true, navPow2(-20));
+constexpr NavDataField af1(224, 11, true, navPow2(-38));
+}  // namespace almanac
+}  // namespace lnav
+
 /// \brief Parse a subframe and return its ID number
 uint16_t parseSubframeID(const uint8_t (&subframe)[30]);
 /// \brief Parse a subframe and return its ID number
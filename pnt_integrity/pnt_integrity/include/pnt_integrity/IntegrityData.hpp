@@ -622,25 +622,26 @@ struct GeodeticPosition3d
   /// \returns false if any values are NaN, true otherwise
   bool getECEF(double* ecef) const
   {
-    if (latitude == std::numeric_limits<double>::quiet_NaN() ||
-        longitude == std::numeric_limits<double>::quiet_NaN() ||
-        altitude == std::numeric_limits<double>::quiet_NaN())
+    if (std::isnan(latitude) || std::isnan(longitude) || std::isnan(altitude))
     {
+      ecef[0] = std::numeric_limits<double>::quiet_NaN();
+      ecef[1] = std::numeric_limits<double>::quiet_NaN();
+      ecef[2] = std::numeric_limits<double>::quiet_NaN();
       return false;
     }
 
-    double a = 6378137.0;
-    double e = 0.081819190842622;
-    // double asq = pow(a, 2);
-    double esq = pow(e, 2);
-    double N   = a / sqrt(1 - esq * pow(sin(latitude), 2));
-    double x   = (N + altitude) * cos(latitude) * cos(longitude);
-    double y   = (N + altitude) * cos(latitude) * sin(longitude);
-    double z   = ((1 - esq) * N + altitude) * sin(latitude);
+    const double a   = 6378137.0;
+    const double e   = 0.081819190842622;
+    const double esq = e * e;
 
-    ecef[0] = x;
-    ecef[1] = y;
-    ecef[2] = z;
+    // evaluate each transcendental once
+    double sinLat = sin(latitude);
+    double cosLat = cos(latitude);
+    double N      = a / sqrt(1 - esq * sinLat * sinLat);
+
+    ecef[0] = (N + altitude) * cosLat * cos(longitude);
+    ecef[1] = (N + altitude) * cosLat * sin(longitude);
+    ecef[2] = ((1 - esq) * N + altitude) * sinLat;
 
     return true;
   };
@@ -843,6 +844,24 @@ struct AgcValue
   std::map<FrequencyBand, double> agcValues;
 };
 
+//==============================================================================
+/// \brief A structure to represent a batch of high-rate AGC samples for a
+/// single frequency band
+struct AgcSampleBatch
+{
+  /// The message header (the valid time is the time of the first sample)
+  Header header;
+
+  /// The frequency band of the samples
+  FrequencyBand band;
+
+  /// The time between consecutive samples [s]
+  double samplePeriod;
+
+  /// The AGC samples, oldest first
+  std::vector<double> values;
+};
+
 }  // namespace data
 
 }  // namespace pnt_integrity
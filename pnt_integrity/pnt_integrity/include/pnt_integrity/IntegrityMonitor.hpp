@@ -69,6 +69,13 @@ public:
   IntegrityMonitor(
     const logutils::LogCallback& log = logutils::printLogToStdOut);
 
+  /// \brief Destructor
+  ///
+  /// Stops the timer wheel thread (if enabled). Registered checks are not
+  /// called, they may already have been destroyed. Checks that outlive the
+  /// monitor keep their share of the (stopped) wheel.
+  ~IntegrityMonitor();
+
   /// \brief Returns an instance to the repository
   ///
   /// \returns A singleton instance of the repository
@@ -88,6 +95,35 @@ public:
   /// \returns True if successful
   bool registerCheck(const std::string& checkName, AssuranceCheck* checkPtr);
 
+  /// \brief Function to unregister a check
+  ///
+  /// Removes all registrations of the provided check from the monitor and
+  /// detaches it from the timer wheel (if enabled). Checks call this
+  /// automatically when they are destroyed.
+  ///
+  /// \param checkPtr A pointer to a registered AssuranceCheck
+  /// \returns True if the check was registered
+  bool unregisterCheck(AssuranceCheck* checkPtr);
+
+  /// \brief Enables a timer wheel shared by all registered checks
+  ///
+  /// Creates a timer wheel driven by a single monitor-owned thread and
+  /// provides it to all registered checks (and checks registered later), so
+  /// checks with time-based expiry need no dedicated threads. Overall
+  /// assurance levels are re-determined whenever a timer fires.
+  ///
+  /// \param tickPeriod The resolution of the timer wheel (seconds)
+  void enableTimerWheel(const double& tickPeriod = 0.1);
+
+  /// \brief Returns the monitor's timer wheel
+  ///
+  /// \returns A pointer to the wheel, or null if it is not enabled
+  TimerWheel* getTimerWheel()
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(checkMutex_);
+    return timerWheel_.get();
+  };
+
   /// \brief Return function for the multi-prn assurance data
   // TODO: This method really needs to be smarter, maybe make it a time vector
   void setMultiPrnAssuranceData(MultiPrnAssuranceMap al)
@@ -208,6 +244,14 @@ public:
   /// \param agcValue The current AGC setting from a a receiver
   void handleAGC(const data::AgcValue& agcValue);
 
+  /// \brief Handler function for a batch of high-rate AGC samples
+  ///
+  /// Call this function with batches of AGC samples from front-ends that
+  /// report AGC at a high rate. Assurance levels are only re-determined when
+  /// a check evaluation was triggered by the batch.
+  /// \param batch The AGC samples for one frequency band
+  void handleAgcSamples(const data::AgcSampleBatch& batch);
+
   /// \brief Template function that determines the correct timestamp
   ///
   /// \param time The timestamp used for time entries into the repo
@@ -292,6 +336,12 @@ private:
 
   std::vector<std::string> checksUsed_;
 
+  // shared with registered checks, which unregister through it
+  std::shared_ptr<MonitorLink> link_;
+
+  // declared last so the driving thread stops before other members go away
+  std::shared_ptr<TimerWheel> timerWheel_;
+
   bool getRoundedValidTime(const data::Header& header, double& timestampValid)
   {
     // throw out measurements with large differences in arrival and validity
@@ -442,7 +492,9 @@ void IntegrityMonitor::handleIfSampleData(
 {
   if_data_utils::IFSampleType sampType = ifData.getHeader().sampleType_;
   if ((sampType == if_data_utils::IFSampleType::SC8) or
-      (sampType == if_data_utils::IFSampleType::SC16))
+      (sampType == if_data_utils::IFSampleType::SC16) or
+      (sampType == if_data_utils::IFSampleType::FC32) or
+      (sampType == if_data_utils::IFSampleType::FC64))
   {
     // grant this thread shared read access to checks_
     std::shared_lock<std::shared_timed_mutex> sharedLock(checkMutex_);
@@ -458,7 +510,7 @@ void IntegrityMonitor::handleIfSampleData(
     std::lock_guard<std::mutex> lock(monitorMutex_);
     logMsg_(
       "IntegrityMonitor::handleIfSampleData(): sample type not supported. "
-      "Currently only SC8 and SC16 are supported data types",
+      "Currently only SC8, SC16, FC32 and FC64 are supported data types",
       logutils::LogLevel::Debug);
     // error message
   }
@@ -43,8 +43,6 @@
 #include "pnt_integrity/GPSAlmanac.hpp"
 #include "pnt_integrity/GPSEphemeris.hpp"
 
-#include <future>
-#include <thread>
 namespace pnt_integrity
 {
 /// String ID for the nav data check diagnostic data
@@ -103,25 +101,21 @@ public:
     , lastWeekNumber_(std::numeric_limits<uint16_t>::max())
     , lastTow_(std::numeric_limits<uint32_t>::max())
     , lastTowTimeStamp_(std::numeric_limits<double>::quiet_NaN())
-    , checkThread_(&NavigationDataCheck::runCheckThread, this)
+    , unassuredHoldTime_(1.0)
+    , unassuredUntil_(-std::numeric_limits<double>::infinity())
+    , timerWheel_()
+    , expiryTimerId_(0)
   {
-    futureObj_ = exitSignal_.get_future();
-    checkThread_.detach();
     std::stringstream initMsg;
     initMsg << "Initializing Navigation Data Check (" << name << ")"
             << std::endl;
     logMsg_(initMsg.str(), logutils::LogLevel::Info);
   }
 
-  ~NavigationDataCheck() 
-  { 
-    stopThreads();
-  }
-
-  void stopThreads()
+  ~NavigationDataCheck()
   {
-    exitSignal_.set_value();
-    checkThread_.join();
+    leaveMonitor();
+    cancelExpiryTimer();
   }
 
   /// \brief Handler function for GNSS Subframes
@@ -144,6 +138,26 @@ public:
   /// Uses whatever data is available to calculate the current assurance level
   virtual void calculateAssuranceLevel(const double& /*time*/) { runCheck(); };
 
+  /// \brief Sets the time the check is held unassured after a bad subframe
+  ///
+  /// The check is evaluated on each subframe arrival. After a subframe fails
+  /// validation the check remains unassured for this amount of time, and
+  /// returns to assured on the first evaluation after it expires. If the
+  /// monitor provides a timer wheel, that evaluation is scheduled on the
+  /// wheel; otherwise it happens on the next subframe or manual check.
+  ///
+  /// \param holdTime The hold time (seconds, defaults to 1.0)
+  void setUnassuredHoldTime(const double& holdTime)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    unassuredHoldTime_ = holdTime;
+  };
+
+  /// \brief Provides the check with the monitor's timer wheel
+  ///
+  /// \param wheel The shared timer wheel (or null to detach)
+  virtual void setTimerWheel(std::shared_ptr<TimerWheel> wheel);
+
   /// \brief Connects the internal publishing function to external interface
   ///
   /// This function connects the internal "publishDiagnostics" function
@@ -169,13 +183,59 @@ private:
   uint32_t lastTow_;           // last valid tow received
   double   lastTowTimeStamp_;  // last PC time that tow was received
 
-  // double lastDiagPubTime_;
   std::vector<NavDataCheckDiagnostics> diagBuffer_;
 
-  std::thread        checkThread_;
-  void               runCheckThread();
-  std::promise<void> exitSignal_;
-  std::future<void>  futureObj_;
+  // Navigation data state cached for a single PRN
+  struct PrnNavState
+  {
+    // ephemeris updated incrementally from subframes 1-3
+    GpsEphemeris ephemeris;
+    // last accepted copy of subframes 1-3, keyed on their IODC / IODE
+    uint8_t  subframes[3][30];
+    bool     hasSubframe[3];
+    uint16_t issue[3];
+    // last valid tow received from this PRN and its timestamp
+    double lastTow;
+    double lastTowTimeStamp;
+    // last tow that did not match the valid tow, and the number of
+    // consecutive mismatching subframes that have been consistent with it
+    double candidateTow;
+    double candidateTowTimeStamp;
+    size_t candidateCount;
+
+    PrnNavState()
+      : hasSubframe{false, false, false}
+      , issue{0, 0, 0}
+      , lastTow(std::numeric_limits<double>::quiet_NaN())
+      , lastTowTimeStamp(std::numeric_limits<double>::quiet_NaN())
+      , candidateTow(0.0)
+      , candidateTowTimeStamp(0.0)
+      , candidateCount(0){};
+  };
+  std::map<int, PrnNavState> prnStates_;
+
+  bool updateEphemeris(int                      prn,
+                       uint16_t                 subframeId,
+                       const uint8_t            (&subframe)[30],
+                       NavDataCheckDiagnostics& diagnostics,
+                       double&                  newTowSec,
+                       uint16_t&                newWeekNumber);
+
+  void checkPrnTow(int                      prn,
+                   uint16_t                 subframeId,
+                   double                   newTowSec,
+                   double                   newTimestamp,
+                   NavDataCheckDiagnostics& diagnostics);
+
+  // steady clock time the unassured hold expires
+  double unassuredHoldTime_;
+  double unassuredUntil_;
+
+  std::shared_ptr<TimerWheel> timerWheel_;
+  TimerWheel::TimerId         expiryTimerId_;
+
+  void scheduleExpiryTimer(const double& now);
+  void cancelExpiryTimer();
 
   std::string getSubframeErrorStr(int                 prn,
                                   uint16_t            subframeId,
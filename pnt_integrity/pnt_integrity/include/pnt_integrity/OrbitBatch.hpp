@@ -0,0 +1,183 @@
+//============================================================================//
+//---------------- pnt_integrity/OrbitBatch.hpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+/// \file
+/// \brief    Batched satellite orbit and clock propagation
+/// \date     October 16, 2026
+//============================================================================//
+#ifndef PNT_INTEGRITY__ORBIT_BATCH_HPP
+#define PNT_INTEGRITY__ORBIT_BATCH_HPP
+
+#include <vector>
+
+#include "pnt_integrity/GPSAlmanac.hpp"
+#include "pnt_integrity/GPSEphemeris.hpp"
+
+namespace pnt_integrity
+{
+/// \brief A structure-of-arrays batch of satellite states
+struct SvStateBatch
+{
+  /// The ECEF x positions (m)
+  std::vector<double> x;
+  /// The ECEF y positions (m)
+  std::vector<double> y;
+  /// The ECEF z positions (m)
+  std::vector<double> z;
+  /// The ECEF x velocities (m/s)
+  std::vector<double> vx;
+  /// The ECEF y velocities (m/s)
+  std::vector<double> vy;
+  /// The ECEF z velocities (m/s)
+  std::vector<double> vz;
+  /// The satellite clock corrections (s)
+  std::vector<double> clockCorrection;
+  /// Non-zero if the state could be computed (states that could not be
+  /// computed are zero, as with GpsEphemeris::getSvState())
+  std::vector<uint8_t> valid;
+};
+
+/// \brief A structure-of-arrays batch of satellite orbit parameters
+///
+/// Holds the broadcast orbit and clock parameters of a set of satellites
+/// (e.g. all visible satellites) in separate contiguous arrays and propagates
+/// them together. The propagation follows GpsEphemeris::getSvState(), but
+/// solves Kepler's equation with a fixed number of Newton iterations and
+/// uses branchless trigonometry so that the whole evaluation vectorizes.
+/// Results agree with the scalar path to within a few ulp of the position.
+///
+/// Terms that do not depend on time are computed when a satellite is added.
+/// Storage is retained across calls to clear(), so a batch that is refilled
+/// every epoch does not allocate once it has reached its working size.
+class OrbitParameterBatch
+{
+public:
+  /// \brief Constructor
+  ///
+  /// \param capacity The number of satellites to reserve storage for
+  OrbitParameterBatch(const size_t& capacity = 0) { reserve(capacity); };
+
+  /// \brief Reserves storage for the provided number of satellites
+  ///
+  /// \param capacity The number of satellites to reserve storage for
+  void reserve(const size_t& capacity);
+
+  /// \brief Removes all satellites from the batch (storage is kept)
+  void clear();
+
+  /// \brief Adds a satellite to the end of the batch from its ephemeris
+  ///
+  /// \param ephemeris The ephemeris of the satellite
+  void push_back(const GpsEphemeris& ephemeris);
+
+  /// \brief Adds a satellite to the end of the batch from its almanac
+  ///
+  /// \param almanac The almanac of the satellite
+  void push_back(const GpsAlmanac& almanac);
+
+  /// \brief Returns the number of satellites in the batch
+  size_t size() const { return prn_.size(); };
+
+  /// \brief Returns the PRN of the satellite at the provided index
+  uint16_t getPrn(const size_t& idx) const { return prn_[idx]; };
+
+  /// \brief Computes the states of all satellites in the batch
+  ///
+  /// \param receiveTime measurement time associated with the pseudoranges
+  ///                    (s into GPS week)
+  /// \param pseudoranges user to satellite range for each satellite (m), or
+  ///                     empty to compute states at the receive time
+  /// \param states The satellite states (resized to match the batch)
+  void getSvStates(const double&              receiveTime,
+                   const std::vector<double>& pseudoranges,
+                   SvStateBatch&              states) const;
+
+private:
+  // Adds a satellite from its individual orbit and clock parameters
+  void push_back(const uint16_t& prn,
+                 const double&   clockCorrectionTime,
+                 const double&   clockAging1,
+                 const double&   clockAging2,
+                 const double&   clockAging3,
+                 const double&   groupDelay,
+                 const double&   timeOfEphemeris,
+                 const double&   sqrtSemiMajorAxis,
+                 const double&   eccentricity,
+                 const double&   meanAnomaly,
+                 const double&   meanMotionDifference,
+                 const double&   argumentOfPerigee,
+                 const double&   rightAscension,
+                 const double&   ascensionRate,
+                 const double&   inclinationAngle,
+                 const double&   inclinationRate,
+                 const double&   cosLatitude,
+                 const double&   sinLatitude,
+                 const double&   cosOrbitRadius,
+                 const double&   sinOrbitRadius,
+                 const double&   cosInclination,
+                 const double&   sinInclination);
+
+  std::vector<uint16_t> prn_;
+
+  // clock parameters
+  std::vector<double> toc_;
+  std::vector<double> af0_;
+  std::vector<double> af1_;
+  std::vector<double> af2_;
+  std::vector<double> tgd_;
+
+  // orbit parameters
+  std::vector<double> toe_;
+  std::vector<double> semiMajorAxis_;
+  std::vector<double> eccentricity_;
+  std::vector<double> m0_;
+  std::vector<double> meanMotion_;           // corrected mean motion
+  std::vector<double> sqrtOneMinusEccSq_;    // sqrt(1 - e^2)
+  std::vector<double> cosPerigee_;           // cos(omega)
+  std::vector<double> sinPerigee_;           // sin(omega)
+  std::vector<double> eFsqrtA_;              // relativistic clock term
+  std::vector<double> lonAscNode0_;          // Omega_0 - OmegaE * toe
+  std::vector<double> lonAscNodeDot_;        // Omega_dot - OmegaE
+  std::vector<double> i0_;
+  std::vector<double> iDot_;
+  std::vector<double> cuc_;
+  std::vector<double> cus_;
+  std::vector<double> crc_;
+  std::vector<double> crs_;
+  std::vector<double> cic_;
+  std::vector<double> cis_;
+  std::vector<double> validScale_;           // 1 if the orbit can be computed
+};
+
+}  // namespace pnt_integrity
+#endif
@@ -44,6 +44,7 @@
 #include <cstring>
 
 #include "pnt_integrity/AssuranceCheck.hpp"
+#include "pnt_integrity/GeodeticBatch.hpp"
 
 namespace pnt_integrity
 {
@@ -170,6 +171,13 @@ private:
 
   double errorThreshScaleFactor_;
 
+  // Reused batches of the measured and propagated positions for each pair
+  GeodeticPositionBatch measuredPositions_;
+  GeodeticPositionBatch propagatedPositions_;
+
+  // Reused storage for the error of each pair
+  std::vector<double> pairErrors_;
+
   std::function<void(const double&                     timestamp,
                      const PosVelConsCheckDiagnostics& checkData)>
     publishDiagnostics_;
@@ -0,0 +1,297 @@
+//============================================================================//
+//--------- pnt_integrity/PseudorangeResidualCheck.hpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//----------------------------------------------------------------------------//
+/// \file
+/// \brief    Assurance check on the residuals of a pseudorange solution
+/// \date     October 16, 2026
+//============================================================================//
+#ifndef PNT_INTEGRITY__PSEUDORANGE_RESIDUAL_CHECK_HPP
+#define PNT_INTEGRITY__PSEUDORANGE_RESIDUAL_CHECK_HPP
+
+#include <Eigen/Dense>
+#include <array>
+
+#include "pnt_integrity/AssuranceCheck.hpp"
+#include "pnt_integrity/GPSEphemeris.hpp"
+#include "pnt_integrity/SvStateCache.hpp"
+
+namespace pnt_integrity
+{
+/// String ID for the pseudorange residual check diagnostic data
+const std::string INTEGRITY_PR_RESIDUAL_DIAGNOSTICS =
+  "INTEGRITY_PR_RESIDUAL_DIAGNOSTICS";
+/// String ID for the pseudorange residual check number of satellites
+const std::string INTEGRITY_PR_RESIDUAL_DIAG_NUM_SATS =
+  "INTEGRITY_PR_RESIDUAL_DIAG_NUM_SATS";
+/// String ID for the pseudorange residual check number of excluded satellites
+const std::string INTEGRITY_PR_RESIDUAL_DIAG_NUM_EXCLUDED =
+  "INTEGRITY_PR_RESIDUAL_DIAG_NUM_EXCLUDED";
+/// String ID for the pseudorange residual check test statistic
+const std::string INTEGRITY_PR_RESIDUAL_DIAG_TEST_STAT =
+  "INTEGRITY_PR_RESIDUAL_DIAG_TEST_STAT";
+/// String ID for the pseudorange residual check test threshold
+const std::string INTEGRITY_PR_RESIDUAL_DIAG_THRESHOLD =
+  "INTEGRITY_PR_RESIDUAL_DIAG_THRESHOLD";
+
+/// \brief Structure used to publish diagnostic data
+struct PseudorangeResidualDiagnostics
+{
+  /// The number of satellites with a usable pseudorange and ephemeris
+  int numSatellites;
+  /// The number of satellites excluded from the final solution
+  int numExcluded;
+  /// The weighted sum of squared residuals of the final solution
+  double testStatistic;
+  /// The chi-square threshold for the final solution
+  double threshold;
+  /// The ECEF position of the final solution (m)
+  double positionEcef[3];
+  /// The receiver clock bias of the final solution (m)
+  double clockBias;
+  /// The PRNs excluded from the final solution
+  std::vector<int> excludedPrns;
+  /// The post-fit residual of each satellite in the final solution (m)
+  std::vector<std::pair<int, double>> residuals;
+
+  PseudorangeResidualDiagnostics()
+    : numSatellites(0)
+    , numExcluded(0)
+    , testStatistic(0.0)
+    , threshold(0.0)
+    , positionEcef{0.0, 0.0, 0.0}
+    , clockBias(0.0){};
+};
+
+/// \brief Class implementation of the pseudorange residual check
+///
+/// The check computes a weighted least-squares position and clock solution
+/// from the GPS L1 pseudoranges of each GNSSObservables epoch, using the
+/// satellite positions and clock corrections from the broadcast ephemeris.
+/// The weighted sum of squared post-fit residuals is compared against the
+/// chi-square threshold for the configured probability of false alarm.
+///
+/// When the test fails, the satellite with the largest normalized residual
+/// is excluded and the solution is recomputed, up to the configured number
+/// of exclusions. Excluded satellites are marked unassured. If the remaining
+/// satellites pass, the check is inconsistent; otherwise it is unassured.
+/// Fewer than five usable satellites leaves the check unavailable.
+///
+/// Pseudoranges are weighted by their reported variance, or by the default
+/// pseudorange sigma when none is reported. No atmospheric corrections are
+/// applied, so the sigma should cover the ionospheric and tropospheric
+/// delays.
+///
+/// Ephemerides are decoded from the GNSS subframes (or provided through
+/// setEphemeris()). All per-epoch storage is sized for maxSatellites at
+/// construction, so processing an epoch does not allocate.
+class PseudorangeResidualCheck : public AssuranceCheck
+{
+public:
+  /// The largest number of satellites used in a solution
+  static constexpr int maxSatellites = 40;
+
+  /// \brief Constructor for the check class
+  ///
+  /// \param name The name of the check
+  /// \param falseAlarmProbability The probability of false alarm of the
+  /// residual test
+  /// \param defaultPseudorangeSigma The pseudorange standard deviation used
+  /// when the observable does not report a variance (m)
+  /// \param maxExclusions The largest number of satellites to exclude
+  /// \param log A provided log callback function to use
+  PseudorangeResidualCheck(
+    const std::string&           name = "Pseudorange Residual Check",
+    const double&                falseAlarmProbability   = 1e-5,
+    const double&                defaultPseudorangeSigma = 5.0,
+    const int&                   maxExclusions           = 1,
+    const logutils::LogCallback& log = logutils::printLogToStdOut);
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /// \brief Handler function for GNSS Observables
+  ///
+  /// Computes the solution and residual test for the provided epoch
+  ///
+  /// \param gnssObs The provided GNSS observable data
+  /// \param time The time associated with the observables
+  /// \returns True if the residual test could be evaluated
+  bool handleGnssObservables(const data::GNSSObservables& gnssObs,
+                             const double&                time = 0);
+
+  /// \brief Handler function for GNSS Subframes
+  ///
+  /// Decodes GPS LNAV subframes 1-3 into the ephemeris used for each PRN
+  ///
+  /// \param gnssSubframe The provided subframe
+  /// \returns True if the subframe was decoded
+  bool handleGnssSubframe(const data::GNSSSubframe& gnssSubframe);
+
+  /// \brief Sets the ephemeris used for a satellite
+  ///
+  /// Use this to provide ephemerides decoded outside of the check. An
+  /// unhealthy ephemeris removes the satellite from the solution.
+  ///
+  /// \param ephemeris The ephemeris for the satellite
+  void setEphemeris(const GpsEphemeris& ephemeris);
+
+  /// \brief Function to explicitly set the assurance level of the check
+  ///
+  /// Re-evaluates the residual test on the most recent epoch
+  void calculateAssuranceLevel(const double& /*time*/) { runCheck(); };
+
+  /// \brief Triggers a manual check calculation
+  ///
+  /// Re-evaluates the residual test on the most recent epoch
+  ///
+  /// \returns True if the residual test could be evaluated
+  virtual bool runCheck();
+
+  /// \brief Sets the probability of false alarm of the residual test
+  ///
+  /// \param falseAlarmProbability The probability of false alarm
+  void setFalseAlarmProbability(const double& falseAlarmProbability);
+
+  /// \brief Sets the default pseudorange standard deviation
+  ///
+  /// \param sigma The pseudorange standard deviation used when the observable
+  /// does not report a variance (m)
+  void setDefaultPseudorangeSigma(const double& sigma)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    defaultPseudorangeSigma_ = sigma;
+  };
+
+  /// \brief Sets the largest number of satellites to exclude
+  ///
+  /// \param maxExclusions The largest number of satellites to exclude
+  void setMaxExclusions(const int& maxExclusions)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    maxExclusions_ = maxExclusions;
+  };
+
+  /// \brief Connects the internal publishing function to external interface
+  ///
+  /// This function connects the internal "publishDiagnostics" function
+  /// to an external, custom function of choice
+  ///
+  /// \param handler Provided handler function
+  void setPublishDiagnostics(
+    std::function<void(const double&                         timestamp,
+                       const PseudorangeResidualDiagnostics& checkData)>
+      handler)
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    publishDiagnostics_ = handler;
+  };
+
+private:
+  using GeometryMatrix  = Eigen::Matrix<double, maxSatellites, 4>;
+  using SatelliteVector = Eigen::Matrix<double, maxSatellites, 1>;
+
+  // Decoded ephemeris subframes for a single PRN
+  struct PrnEphemerisState
+  {
+    GpsEphemeris ephemeris;
+    bool         hasSubframe[3];
+    uint16_t     issue[3];
+    // issue of data of the ephemeris provided to the state cache (or -1)
+    int cachedIssue;
+
+    PrnEphemerisState()
+      : hasSubframe{false, false, false}, issue{0, 0, 0}, cachedIssue(-1){};
+  };
+
+  // Provides a complete ephemeris to the state cache (or removes the PRN
+  // if it is unhealthy)
+  void cacheEphemeris(const int& prn, PrnEphemerisState& state);
+
+  // Loads the usable observables of an epoch into the working storage
+  void loadEpoch(const data::GNSSObservables& gnssObs);
+
+  // Iterates the weighted least-squares solution over the satellites in use
+  bool solve();
+
+  // Computes the geometry rows and residuals at the current solution
+  void linearize();
+
+  // Returns the index of the satellite in use with the largest normalized
+  // residual
+  int findLargestNormalizedResidual();
+
+  std::function<void(const double&                         timestamp,
+                     const PseudorangeResidualDiagnostics& diagnostics)>
+    publishDiagnostics_;
+
+  double falseAlarmProbability_;
+  double defaultPseudorangeSigma_;
+  int    maxExclusions_;
+
+  // chi-square threshold indexed by the degrees of freedom
+  std::array<double, maxSatellites + 1> chiSquareThresholds_;
+
+  std::map<int, PrnEphemerisState> prnEphemerides_;
+  SvStateCache                     svStateCache_;
+
+  // working storage for the most recent epoch (receive time in seconds of
+  // the GPS week, check time, and the satellites with usable data)
+  bool                                    hasEpoch_;
+  double                                  epochTime_;
+  double                                  checkTime_;
+  int                                     numSatellites_;
+  std::array<int, maxSatellites>          prns_;
+  std::array<bool, maxSatellites>         inUse_;
+  Eigen::Matrix<double, maxSatellites, 3> satellitePositions_;
+  SatelliteVector                         correctedPseudoranges_;
+  SatelliteVector                         variances_;
+
+  // linearized solution over the satellites in use
+  GeometryMatrix  geometry_;
+  SatelliteVector residuals_;
+  Eigen::Matrix4d normalMatrix_;
+  Eigen::Vector4d normalVector_;
+
+  // ECEF position and clock bias (m), kept as the next epoch's starting point
+  Eigen::Vector4d solution_;
+  bool            solutionValid_;
+
+  // number of exclusions (or -1 for a failed test) of the last evaluation,
+  // used to log changes in the fault state
+  int lastFaultState_;
+
+  PseudorangeResidualDiagnostics diagnostics_;
+};
+
+}  // namespace pnt_integrity
+#endif
@@ -40,6 +40,7 @@
 #define PNT_INTEGRITY__RANGE_POSITION_CHECK_HPP
 
 #include "pnt_integrity/AssuranceCheck.hpp"
+#include "pnt_integrity/GeodeticBatch.hpp"
 
 namespace pnt_integrity
 {
@@ -158,11 +159,18 @@ private:
 
   bool compareRanges(const data::PositionVelocity& posVel1,
                      const data::PositionVelocity& posVel2,
+                     const double&                 calculatedRange,
                      const data::MeasuredRange&    measRange,
                      RngPosCheckNodeDiagnostic&    diagnostic);
 
   std::map<std::string, data::AssuranceLevel> rangeCheckLevels_;
 
+  // Reused batch of the remote positions that have a valid range, the
+  // remote entries they came from, and their distances from the local node
+  GeodeticPositionBatch                          remotePositions_;
+  std::vector<RemoteRepoEntries::const_iterator> remoteEntries_;
+  std::vector<double>                            remoteDistances_;
+
   std::function<void(const double&                 timestamp,
                      const RngPosCheckDiagnostics& diagnostics)>
     publishDiagnostics_;
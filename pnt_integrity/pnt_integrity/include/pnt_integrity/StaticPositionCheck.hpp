@@ -40,9 +40,12 @@
 #ifndef PNT_INTEGRITY__STATIC_POSITON_CHECK_HPP
 #define PNT_INTEGRITY__STATIC_POSITON_CHECK_HPP
 
+#include <array>
 #include <cstring>
 
 #include "pnt_integrity/AssuranceCheck.hpp"
+#include "pnt_integrity/GeodeticBatch.hpp"
+#include "pnt_integrity/GeodeticConverter.hpp"
 
 namespace pnt_integrity
 {
@@ -86,6 +89,32 @@ struct StaticPosCheckDiagnostics
   double unassuredThresh;
 };
 
+/// \brief Structure holding the running state of the static position survey
+///
+/// The survey accumulates positions in ECEF with constant memory. The state
+/// can be exported and reloaded (see StaticPositionCheck::getSurveyState()
+/// and StaticPositionCheck::setSurveyState()) so that a restart does not
+/// restart the survey.
+struct StaticPositionSurveyState
+{
+  /// The number of positions accumulated in the survey
+  size_t numPositions = 0;
+  /// Running ECEF mean of all positions (m)
+  double mean[3] = {0.0, 0.0, 0.0};
+  /// Running sum of ECEF deviation outer products (m^2), i.e. the
+  /// covariance scaled by (numPositions - 1)
+  double sumSqDev[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  /// The number of positions in each median-of-means group (0 if the survey
+  /// does not use median-of-means)
+  size_t groupSize = 0;
+  /// The number of positions in the current median-of-means group
+  size_t groupNumPositions = 0;
+  /// Running ECEF mean of the current median-of-means group (m)
+  double groupMean[3] = {0.0, 0.0, 0.0};
+  /// ECEF means of the completed median-of-means groups (m)
+  std::vector<std::array<double, 3> > groupMeans;
+};
+
 /// \brief Class implementation for the static-position check
 class StaticPositionCheck : public AssuranceCheck
 {
@@ -118,8 +147,13 @@ public:
     , numPositionsForInit_(numPositionsForInit)
     , checkWindowSize_(checkWindowSize)
     , posChangeThresh_(posChangeThresh)
+    , surveyNumGroups_(0)
     , staticPositionInitialized_(false)
     , lastSurveyPointTime_(0.0)
+    , windowFlags_(checkWindowSize + 1, 0)
+    , windowHead_(0)
+    , windowCount_(0)
+    , windowNumNear_(0)
   {
     std::stringstream initMsg;
     initMsg << "Initializing Static-Position Check (" << name
@@ -158,6 +192,32 @@ public:
   /// \param staticPos The provided position value
   void setStaticPosition(const data::GeodeticPosition3d& staticPos);
 
+  /// \brief Sets the number of median-of-means groups for the survey
+  ///
+  /// With more than one group, the survey splits its positions into
+  /// consecutive groups, averages each group, and takes the per-axis median
+  /// of the group means as the surveyed position. This rejects outliers
+  /// (e.g. multipath excursions) that would bias a plain mean. With zero or
+  /// one group, the surveyed position is the mean of all positions.
+  ///
+  /// Changing the number of groups restarts a survey in progress.
+  ///
+  /// \param numGroups The number of median-of-means groups
+  void setSurveyNumGroups(const size_t& numGroups);
+
+  /// \brief Returns the running state of the static position survey
+  ///
+  /// \returns The survey state
+  StaticPositionSurveyState getSurveyState();
+
+  /// \brief Restores a previously exported survey state
+  ///
+  /// The survey continues from the provided state. If the state already
+  /// holds enough positions, the static position is set immediately.
+  ///
+  /// \param state The survey state to restore
+  void setSurveyState(const StaticPositionSurveyState& state);
+
   /// \brief Connects the internal publishing function to external interface
   ///
   /// This function connects the internal "publishDiagnostics" function
@@ -179,13 +239,10 @@ private:
   /// a stationary position drifts off of the original position
   void posHistoryCheck(TimeEntry& timeEntryVec);
 
-  /// \brief Adds position b to position a, i.e. a+b
+  /// \brief Adds a position to the running survey
   ///
-  /// \param a The position to add to
-  /// \param b The position to add
-  /// \returns The position created from a+b
-  data::GeodeticPosition3d addTwoPositions(data::GeodeticPosition3d a,
-                                           data::GeodeticPosition3d b);
+  /// \param position The position to add
+  void addSurveyPosition(const data::GeodeticPosition3d& position);
 
   /// \brief Calculates if a given GeodeticPosition3d is within a
   /// given threshold
@@ -202,18 +259,22 @@ private:
                          data::GeodeticPosition3d mean,
                          double                   thresh);
 
-  /// \brief Returns the percentage of positions that are within
-  /// a threshold distance of the center
+  /// \brief Adds a position's near / not-near flag to the check window
+  ///
+  /// The flag is evaluated once on arrival and the running count of near
+  /// positions is updated, evicting the oldest flag if the window is full.
   ///
-  /// \param center The center point to check proximity against
-  /// \param positions The positions to check for proximity
-  /// \param thresh The maximum euclidean distance before returning false
-  double percentNearPos(const data::GeodeticPosition3d&              center,
-                        const std::vector<data::GeodeticPosition3d>& positions,
-                        double                                       thresh);
+  /// \param nearStatic True if the position is within the threshold of the
+  /// static position
+  void pushWindowFlag(const bool& nearStatic);
 
-  data::GeodeticPosition3d computeSurveyedPosition(
-    const std::vector<data::GeodeticPosition3d>& positions);
+  /// \brief Empties the check window
+  void clearWindow();
+
+  /// \brief Computes the surveyed position from the running survey
+  ///
+  /// \returns The surveyed position
+  data::GeodeticPosition3d computeSurveyedPosition();
 
   // THe number of saved points required for survey initialization
   size_t numPositionsForInit_;
@@ -225,20 +286,40 @@ private:
   // position
   double posChangeThresh_;
 
-  // vector to hold positions for surveying
-  std::vector<data::GeodeticPosition3d> positionsToSurvey_;
+  // The number of median-of-means groups used by the survey
+  size_t surveyNumGroups_;
+
+  // Running state of the survey
+  StaticPositionSurveyState surveyState_;
+
+  // Used to convert the surveyed ECEF position back to geodetic
+  geodetic_converter::GeodeticConverter geodeticConverter_;
 
   /// The static position used by the check (calculated through survey or
   /// provided)
   data::GeodeticPosition3d staticPosition_;
 
+  // The static position with its ECEF conversion cached
+  EcefReference staticReference_;
+
   // Flag to indicate whether or not position has been initialized
   bool staticPositionInitialized_;
 
   // The last time a valid position was pulled from the repo
   double lastSurveyPointTime_;
 
-  std::deque<data::GeodeticPosition3d> positionsToCheck_;
+  // Ring buffer of near (1) / not-near (0) flags for the positions in the
+  // check window
+  std::vector<unsigned char> windowFlags_;
+
+  // Index of the oldest flag in the ring buffer
+  size_t windowHead_;
+
+  // The number of flags in the ring buffer
+  size_t windowCount_;
+
+  // The number of positions in the window near the static position
+  size_t windowNumNear_;
 
   // std::chrono::system_clock::time_point lastAssuranceUpdate_;
 
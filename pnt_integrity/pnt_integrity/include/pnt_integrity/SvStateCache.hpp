@@ -0,0 +1,188 @@
+//============================================================================//
+//--------------- pnt_integrity/SvStateCache.hpp ---------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+/// \file
+/// \brief    Interpolating cache of satellite position, velocity, and clock
+/// \date     October 16, 2026
+//============================================================================//
+#ifndef PNT_INTEGRITY__SV_STATE_CACHE_HPP
+#define PNT_INTEGRITY__SV_STATE_CACHE_HPP
+
+#include <map>
+
+#include "pnt_integrity/GPSAlmanac.hpp"
+#include "pnt_integrity/GPSEphemeris.hpp"
+
+namespace pnt_integrity
+{
+/// \brief Serves satellite states interpolated between coarse knots
+///
+/// GpsEphemeris::getSvState() and GpsAlmanac::getSvState() solve Kepler's
+/// equation on every call. This class evaluates each satellite only at knots
+/// spaced knotSpacing seconds apart and serves the states in between with
+/// cubic Hermite interpolation of the knot positions and velocities (linear
+/// for the clock correction). With the default 30 s spacing the interpolated
+/// positions agree with the direct evaluation to well below a millimeter.
+///
+/// Knots are computed at transmit time in the ECEF frame of that time; the
+/// Earth rotation during signal transit is applied to the interpolated state,
+/// so results match getSvState() for any pseudorange.
+///
+/// The knots for a PRN are discarded whenever its ephemeris is replaced with
+/// one of a different IODE or reference time. An almanac is only used for a
+/// PRN that has no ephemeris. This class is not thread safe.
+class SvStateCache
+{
+public:
+  /// \brief Constructor
+  ///
+  /// \param knotSpacing The time between interpolation knots (s)
+  SvStateCache(const double& knotSpacing = 30.0);
+
+  /// \brief Sets the time between interpolation knots (clears all knots)
+  ///
+  /// \param knotSpacing The time between interpolation knots (s)
+  void setKnotSpacing(const double& knotSpacing);
+
+  /// \brief Returns the time between interpolation knots (s)
+  double getKnotSpacing() const { return knotSpacing_; };
+
+  /// \brief Sets the ephemeris used for a satellite
+  ///
+  /// The PRN is taken from the ephemeris. Cached knots are kept if the IODE
+  /// and time of ephemeris are unchanged.
+  ///
+  /// \param ephemeris The ephemeris for the satellite
+  void setEphemeris(const GpsEphemeris& ephemeris);
+
+  /// \brief Sets the almanac used for a satellite without an ephemeris
+  ///
+  /// \param almanac The almanac for the satellite
+  void setAlmanac(const GpsAlmanac& almanac);
+
+  /// \brief Removes a satellite from the cache
+  ///
+  /// \param prn The PRN of the satellite
+  void removePrn(const uint16_t& prn);
+
+  /// \brief Removes all satellites from the cache
+  void clear() { prns_.clear(); };
+
+  /// \brief Returns true if orbit data has been set for the provided PRN
+  ///
+  /// \param prn The PRN of the satellite
+  bool hasPrn(const uint16_t& prn) const
+  {
+    return prns_.find(prn) != prns_.end();
+  };
+
+  /// \brief Computes the interpolated satellite state
+  ///
+  /// The arguments match GpsEphemeris::getSvState().
+  ///
+  /// \param prn The PRN of the satellite
+  /// \param receiveTime measurement time associated with the pseudorange
+  ///                    measurement (s into GPS week).
+  /// \param positionEcefX ECEF X position (m)
+  /// \param positionEcefY ECEF Y position (m)
+  /// \param positionEcefZ ECEF Z position (m)
+  /// \param velocityEcefX ECEF X speed (m/s)
+  /// \param velocityEcefY ECEF Y speed (m/s)
+  /// \param velocityEcefZ ECEF Z speed (m/s)
+  /// \param svClockCorrection satellite clock correction (s)
+  /// \param pseudorange (optional) user to satellite range (m)
+  /// \returns False if there is no orbit data for the PRN or the satellite
+  ///          state could not be computed
+  bool getSvState(const uint16_t& prn,
+                  const double&   receiveTime,
+                  double&         positionEcefX,
+                  double&         positionEcefY,
+                  double&         positionEcefZ,
+                  double&         velocityEcefX,
+                  double&         velocityEcefY,
+                  double&         velocityEcefZ,
+                  double&         svClockCorrection,
+                  const double&   pseudorange = 0.0);
+
+  /// \brief Returns the number of direct orbit evaluations made for knots
+  size_t getNumKnotEvaluations() const { return numKnotEvaluations_; };
+
+  /// \brief Returns the number of states served by interpolation
+  size_t getNumInterpolations() const { return numInterpolations_; };
+
+private:
+  // A satellite state evaluated directly from the orbit data
+  struct SvKnot
+  {
+    double position[3];
+    double velocity[3];
+    double clockCorrection;
+  };
+
+  // Orbit data and the current interpolation interval for a single PRN
+  struct PrnEntry
+  {
+    bool         hasEphemeris;
+    GpsEphemeris ephemeris;
+    bool         hasAlmanac;
+    GpsAlmanac   almanac;
+
+    // true if knots holds the interval starting at knot knotIndex (knot
+    // time is knotIndex * knotSpacing_)
+    bool   knotsValid;
+    long   knotIndex;
+    SvKnot knots[2];
+
+    PrnEntry()
+      : hasEphemeris(false), hasAlmanac(false), knotsValid(false), knotIndex(0)
+    {
+    }
+  };
+
+  // Evaluates the orbit data of an entry directly at the knot with the
+  // provided index
+  bool evaluateKnot(const PrnEntry& entry, const long& index, SvKnot& knot);
+
+  // Moves the interpolation interval of an entry to the knot index
+  bool updateKnots(PrnEntry& entry, const long& index);
+
+  double knotSpacing_;
+
+  std::map<uint16_t, PrnEntry> prns_;
+
+  size_t numKnotEvaluations_;
+  size_t numInterpolations_;
+};
+
+}  // namespace pnt_integrity
+#endif
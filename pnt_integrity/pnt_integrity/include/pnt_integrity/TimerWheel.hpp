@@ -0,0 +1,163 @@
+//============================================================================//
+//---------------- pnt_integrity/TimerWheel.hpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+/// \file
+/// \brief    Hashed timer wheel for time-based check expiry
+/// \date     October 16, 2026
+//============================================================================//
+#ifndef PNT_INTEGRITY__TIMER_WHEEL_HPP
+#define PNT_INTEGRITY__TIMER_WHEEL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace pnt_integrity
+{
+/// \brief A hashed timer wheel for time-based expiry in assurance checks
+///
+/// Timers are hashed into a fixed number of slots by their expiry tick, so
+/// scheduling, cancelling and advancing are O(1) per timer regardless of the
+/// number of checks sharing the wheel. The wheel runs on the steady clock and
+/// is either advanced manually via advance(), or by a single driving thread
+/// started with start(). Callbacks are invoked outside of the wheel's lock,
+/// so they may schedule or cancel other timers.
+class TimerWheel
+{
+public:
+  /// Identifier for a scheduled timer (0 is never a valid identifier)
+  using TimerId = uint64_t;
+
+  /// \brief Constructor for the timer wheel
+  ///
+  /// \param tickPeriod The resolution of the wheel (seconds)
+  /// \param numSlots The number of hashed slots in the wheel
+  TimerWheel(const double& tickPeriod = 0.1, const size_t& numSlots = 256);
+
+  /// \brief Destructor, stops the driving thread if it is running
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /// \brief Schedules a callback to run after the provided delay
+  ///
+  /// The callback runs on the first advance() at least delay seconds from
+  /// now, rounded up to the tick period.
+  ///
+  /// \param delay The delay before the callback is run (seconds)
+  /// \param callback The function to call on expiry
+  /// \returns The identifier of the scheduled timer
+  TimerId schedule(const double& delay, std::function<void()> callback);
+
+  /// \brief Cancels a scheduled timer
+  ///
+  /// If the timer's callback is currently running on another thread, this
+  /// function blocks until it returns, so that the callback's owner may be
+  /// safely destroyed afterwards.
+  ///
+  /// \param id The identifier returned by schedule()
+  /// \returns True if the timer was pending and has been removed
+  bool cancel(const TimerId& id);
+
+  /// \brief Runs the callbacks of all timers that have expired
+  ///
+  /// Calls to advance() are serialized, so it must not be called from within
+  /// a timer callback.
+  ///
+  /// \returns The number of callbacks that were run
+  size_t advance();
+
+  /// \brief Sets a handler called after each advance that fired a timer
+  ///
+  /// The integrity monitor uses this to re-determine the overall assurance
+  /// level once after the checks have updated their own levels.
+  ///
+  /// \param handler The provided handler function
+  void setFiredHandler(std::function<void()> handler);
+
+  /// \brief Starts a thread that advances the wheel every tick period
+  void start();
+
+  /// \brief Stops the driving thread started by start()
+  void stop();
+
+  /// \brief Returns the number of pending timers
+  size_t getNumPending();
+
+private:
+  struct Timer
+  {
+    TimerId               id;
+    uint64_t              expiryTick;
+    std::function<void()> callback;
+  };
+
+  using Clock = std::chrono::steady_clock;
+
+  uint64_t currentTick() const;
+
+  std::mutex              advanceMutex_;
+  std::mutex              wheelMutex_;
+  std::condition_variable callbackDone_;
+
+  Clock::time_point                startTime_;
+  double                           tickPeriod_;
+  std::vector<std::vector<Timer> > slots_;
+  uint64_t                         lastTick_;
+  TimerId                          nextId_;
+  std::unordered_map<TimerId, uint64_t> pendingTicks_;
+
+  // expired timers removed from the slots but not yet run
+  std::vector<Timer> firing_;
+
+  // timer whose callback is running, and the thread running it
+  TimerId         runningId_;
+  std::thread::id runningThread_;
+
+  std::function<void()> firedHandler_;
+
+  std::thread             driveThread_;
+  std::mutex              driveMutex_;
+  std::condition_variable driveSignal_;
+  bool                    stopDrive_;
+};
+
+}  // namespace pnt_integrity
+
+#endif
@@ -0,0 +1,115 @@
+//============================================================================//
+//---------------- pnt_integrity/VectorMath.hpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+/// \file
+/// \brief    Branchless math kernels for vectorized batch evaluation
+/// \date     October 16, 2026
+//============================================================================//
+#ifndef PNT_INTEGRITY__VECTOR_MATH_HPP
+#define PNT_INTEGRITY__VECTOR_MATH_HPP
+
+namespace pnt_integrity
+{
+/// Math kernels written without branches or library calls so that loops
+/// calling them are vectorized by the compiler
+namespace vector_math
+{
+/// Adding and subtracting this value rounds a double to the nearest integer
+/// (valid for magnitudes below 2^51)
+const double roundMagic = 6755399441055744.0;
+
+/// 2 / pi and pi / 2 split into three parts for Cody-Waite range reduction
+const double twoOverPi = 6.36619772367581382433e-1;
+const double piOver2A  = 1.57079625129699707031e+0;
+const double piOver2B  = 7.54978941586159635335e-8;
+const double piOver2C  = 5.39030285815811905290e-15;
+
+/// Minimax polynomial coefficients for sin and cos on [-pi/4, pi/4]
+/// (Cephes Math Library)
+const double sinCoef[6] = {1.58962301576546568060e-10,
+                           -2.50507477628578072866e-8,
+                           2.75573136213857245213e-6,
+                           -1.98412698295895385996e-4,
+                           8.33333333332211858878e-3,
+                           -1.66666666666666307295e-1};
+const double cosCoef[6] = {-1.13585365213876817300e-11,
+                           2.08757008419747316778e-9,
+                           -2.75573141792967388112e-7,
+                           2.48015872888517045348e-5,
+                           -1.38888888888730564116e-3,
+                           4.16666666666665929218e-2};
+
+/// \brief Computes the sine and cosine of an angle
+///
+/// Agrees with the standard library to within a few ulp for angles up to a
+/// few thousand radians.
+///
+/// \param x The angle (rad)
+/// \param sinOut The sine of the angle
+/// \param cosOut The cosine of the angle
+inline void sinCos(const double& x, double& sinOut, double& cosOut)
+{
+  // reduce to r in [-pi/4, pi/4], x = q * pi/2 + r
+  double q = (x * twoOverPi + roundMagic) - roundMagic;
+  double r = ((x - q * piOver2A) - q * piOver2B) - q * piOver2C;
+
+  // quadrant of q in {0, 1, 2, 3}
+  double quad = q - 4.0 * (((q - 1.5) * 0.25 + roundMagic) - roundMagic);
+
+  double z = r * r;
+  double sinPoly =
+    ((((sinCoef[0] * z + sinCoef[1]) * z + sinCoef[2]) * z + sinCoef[3]) * z +
+     sinCoef[4]) *
+      z +
+    sinCoef[5];
+  double cosPoly =
+    ((((cosCoef[0] * z + cosCoef[1]) * z + cosCoef[2]) * z + cosCoef[3]) * z +
+     cosCoef[4]) *
+      z +
+    cosCoef[5];
+
+  double sinR = r + r * z * sinPoly;
+  double cosR = 1.0 - 0.5 * z + z * z * cosPoly;
+
+  // sin(quad * pi/2) and cos(quad * pi/2) as exact cubics in quad, so that
+  // the quadrant is applied without comparisons or branches
+  double sinQuad = quad * (quad - 2.0) * (quad - 4.0) * (1.0 / 3.0);
+  double cosQuad = (quad + 1.0) * (quad - 1.0) * (quad - 3.0) * (1.0 / 3.0);
+
+  sinOut = sinQuad * cosR + cosQuad * sinR;
+  cosOut = cosQuad * cosR - sinQuad * sinR;
+}
+
+}  // namespace vector_math
+}  // namespace pnt_integrity
+#endif
@@ -281,7 +281,7 @@ float AcquisitionCheck::sinFast(float x)
 //------------------------- generateAcquisitionPlane() -------------------------
 //==============================================================================
 bool AcquisitionCheck::generateAcquisitionPlane(
-  const Eigen::ArrayXcf& signalSamples)
+  const Eigen::Ref<const Eigen::ArrayXcf>& signalSamples)
 {
   auto start = std::chrono::high_resolution_clock::now();
 
@@ -362,9 +362,9 @@ bool AcquisitionCheck::generateAcquisitionPlane(
 //-------------------------- acquisitionCorrelation ----------------------------
 //==============================================================================
 void AcquisitionCheck::acquisitionCorrelation(
-  const int&              prn,
-  const Eigen::ArrayXcf&  signalSamples,
-  const Eigen::VectorXcf& phasePoints)
+  const int&                               prn,
+  const Eigen::Ref<const Eigen::ArrayXcf>& signalSamples,
+  const Eigen::VectorXcf&                  phasePoints)
 {
   // initialize fft engine
   Eigen::FFT<float> fftEngine;
@@ -473,6 +473,10 @@ bool AcquisitionCheck::runCheck()
 void AcquisitionCheck::setPrnAssuranceLevels()
 {
   std::map<int, double> ratioMap;
+
+  double highPowerThreshold   = highPowerThreshold_ * thresholdScale_;
+  double acquisitionThreshold = acquisitionThreshold_ * thresholdScale_;
+
   // look at the peak results map and make determinations bas
   for (auto prnIt = peakResultsMap_.begin(); prnIt != peakResultsMap_.end();
        ++prnIt)
@@ -480,7 +484,7 @@ void AcquisitionCheck::setPrnAssuranceLevels()
     double peakRatio       = (prnIt->second.first / prnIt->second.second);
     ratioMap[prnIt->first] = peakRatio;
 
-    if (prnIt->second.first > highPowerThreshold_)
+    if (prnIt->second.first > highPowerThreshold)
     {
       // power level is suspect, check ratio of 1st and 2nd peak
 
@@ -494,7 +498,7 @@ void AcquisitionCheck::setPrnAssuranceLevels()
       }
     }
     // check the first peak against the threshold
-    else if (prnIt->second.first > acquisitionThreshold_)
+    else if (prnIt->second.first > acquisitionThreshold)
     {
       prnAssuranceLevels_[prnIt->first] = data::AssuranceLevel::Assured;
     }
@@ -562,9 +566,9 @@ void AcquisitionCheck::calculateAssuranceLevel(const double& checkTime)
 
   if (publishDiagnostics_)
   {
-    diagnostics_.highPowerThresh    = highPowerThreshold_;
+    diagnostics_.highPowerThresh    = highPowerThreshold_ * thresholdScale_;
     diagnostics_.peakRatioThresh    = peakRatioThreshold_;
-    diagnostics_.acquisitionThresh  = acquisitionThreshold_;
+    diagnostics_.acquisitionThresh  = acquisitionThreshold_ * thresholdScale_;
     diagnostics_.inconsistentThresh = assuranceInconsistentThresh_;
     diagnostics_.unassuredThresh    = assuranceUnassuredThresh_;
     diagnostics_.unassuredCount     = unassuredCount;
@@ -38,8 +38,40 @@
 //============================================================================//
 #include "pnt_integrity/AgcCheck.hpp"
 
+namespace
+{
+// Floor on the baseline standard deviation, as a fraction of the AGC range
+const double minSigmaFraction = 1e-3;
+}  // namespace
+
 namespace pnt_integrity
 {
+//==============================================================================
+//--------------------------------- handleAGC ----------------------------------
+//==============================================================================
+bool AgcCheck::handleAGC(const data::AgcValue& agcValue)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+  // merge the provided bands into the current values, which may also hold
+  // decimated outputs from handleAgcSamples
+  currentAgcVals_.header = agcValue.header;
+  for (auto agcIt = agcValue.agcValues.begin();
+       agcIt != agcValue.agcValues.end();
+       ++agcIt)
+  {
+    currentAgcVals_.agcValues[agcIt->first] = agcIt->second;
+  }
+  bool success = runCheck();
+
+  for (auto agcIt = agcValue.agcValues.begin();
+       agcIt != agcValue.agcValues.end();
+       ++agcIt)
+  {
+    learnBaseline(agcIt->first, agcIt->second);
+  }
+  return success;
+}
+
 //==============================================================================
 //--------------------------------- runCheck -----------------------------------
 //==============================================================================
@@ -53,31 +85,45 @@ bool AgcCheck::runCheck()
   diagnostics.inconsistentThresh = assuranceInconsistentThresh_;
 
   // go through each provided band of AGC values
-  // if any of them are below the threshold, lower the assurance level
-  size_t inconsistentCount = 0;
+  // the check takes the worst level among the bands
+  data::AssuranceLevel checkLevel = data::AssuranceLevel::Assured;
   for (auto agcIt = currentAgcVals_.agcValues.begin();
        agcIt != currentAgcVals_.agcValues.end();
        ++agcIt)
   {
-    // nomralize the agc count with the max and min values
-    // then compare to threshold
-    double normalizedValue =
-      (agcIt->second - minValue_) / (maxValue_ - minValue_);
-    if (normalizedValue < assuranceInconsistentThresh_)
+    double               sigmaDeviation;
+    data::AssuranceLevel level =
+      valueLevel(agcIt->first, agcIt->second, sigmaDeviation);
+    if (level < checkLevel)
     {
-      inconsistentCount++;
+      checkLevel = level;
+    }
+
+    diagnostics.values.agcValues[agcIt->first] = normalizeValue(agcIt->second);
+    if (!std::isnan(sigmaDeviation))
+    {
+      diagnostics.sigmaDeviations[agcIt->first] = sigmaDeviation;
+    }
+
+    // statistics from the high-rate front end, if the band has one
+    auto stateIt = bandStates_.find(agcIt->first);
+    if ((stateIt != bandStates_.end()) && (stateIt->second.numSamples > 0))
+    {
+      const AgcBandState& state = stateIt->second;
+      AgcBandStatistics   stats;
+      stats.numSamples = state.numSamples;
+      stats.min        = state.min;
+      stats.max        = state.max;
+      stats.mean       = state.mean;
+      stats.variance =
+        (state.numSamples > 1) ? state.m2 / (state.numSamples - 1) : 0.0;
+      diagnostics.bandStatistics[agcIt->first] = stats;
     }
-    diagnostics.values.agcValues[agcIt->first] = normalizedValue;
-  }
-  if (inconsistentCount)
-  {
-    changeAssuranceLevel(currentAgcVals_.header.timestampValid.sec,
-                         data::AssuranceLevel::Inconsistent);
   }
-  else if (currentAgcVals_.agcValues.size() > 0)
+  if (currentAgcVals_.agcValues.size() > 0)
   {
     changeAssuranceLevel(currentAgcVals_.header.timestampValid.sec,
-                         data::AssuranceLevel::Assured);
+                         checkLevel);
   }
 
   if (publishDiagnostics && (lastDiagPublishTime_ != checkTime))
@@ -88,4 +134,186 @@ bool AgcCheck::runCheck()
   return true;
 }
 
+//==============================================================================
+//----------------------------- handleAgcSamples -------------------------------
+//==============================================================================
+bool AgcCheck::handleAgcSamples(const data::AgcSampleBatch& batch)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  AgcBandState& state = bandStates_[batch.band];
+
+  const double startTime = batch.header.timestampValid.sec +
+                           batch.header.timestampValid.nanoseconds * 1e-9;
+
+  bool evaluated = false;
+  for (size_t ii = 0; ii < batch.values.size(); ++ii)
+  {
+    const double value = batch.values[ii];
+
+    // min / max / variance tracking since the previous evaluation
+    if (state.numSamples == 0)
+    {
+      state.min = value;
+      state.max = value;
+    }
+    else
+    {
+      state.min = std::min(state.min, value);
+      state.max = std::max(state.max, value);
+    }
+    ++state.numSamples;
+    double delta = value - state.mean;
+    state.mean += delta / state.numSamples;
+    state.m2 += delta * (value - state.mean);
+
+    // moving-average decimator
+    state.decimatorSum += value;
+    if (++state.decimatorCount < decimationFactor_)
+    {
+      continue;
+    }
+    state.output      = state.decimatorSum / state.decimatorCount;
+    state.outputValid = true;
+    state.decimatorSum   = 0.0;
+    state.decimatorCount = 0;
+
+    // escalate to a check evaluation on a threshold crossing or when the
+    // evaluation period has elapsed
+    double               sampleTime = startTime + ii * batch.samplePeriod;
+    double               sigmaDeviation;
+    data::AssuranceLevel level =
+      valueLevel(batch.band, state.output, sigmaDeviation);
+    if ((level != state.level) ||
+        (sampleTime - lastEvaluationTime_ >= evaluationPeriod_))
+    {
+      state.level = level;
+      evaluateBands(sampleTime);
+      evaluated = true;
+    }
+
+    learnBaseline(batch.band, state.output);
+  }
+  return evaluated;
+}
+
+//==============================================================================
+//------------------------------ evaluateBands ---------------------------------
+//==============================================================================
+void AgcCheck::evaluateBands(const double& time)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  // the decimated outputs are merged into the current values, so bands that
+  // only arrive through handleAGC keep their latest value
+  currentAgcVals_.header.timestampValid.sec = (int64_t)time;
+  currentAgcVals_.header.timestampValid.nanoseconds =
+    (int32_t)((time - (double)currentAgcVals_.header.timestampValid.sec) *
+              1e9);
+  for (auto stateIt = bandStates_.begin(); stateIt != bandStates_.end();
+       ++stateIt)
+  {
+    if (stateIt->second.outputValid)
+    {
+      currentAgcVals_.agcValues[stateIt->first] = stateIt->second.output;
+    }
+  }
+
+  runCheck();
+  lastEvaluationTime_ = time;
+
+  // restart the statistics for the next evaluation interval
+  for (auto stateIt = bandStates_.begin(); stateIt != bandStates_.end();
+       ++stateIt)
+  {
+    stateIt->second.numSamples = 0;
+    stateIt->second.mean       = 0.0;
+    stateIt->second.m2         = 0.0;
+  }
+}
+
+//==============================================================================
+//-------------------------------- valueLevel ----------------------------------
+//==============================================================================
+data::AssuranceLevel AgcCheck::valueLevel(const data::FrequencyBand& band,
+                                          const double&              value,
+                                          double& sigmaDeviation)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  sigmaDeviation = std::numeric_limits<double>::quiet_NaN();
+
+  auto baselineIt = baselines_.find(band);
+  if (adaptiveBaseline_ && (baselineIt != baselines_.end()) &&
+      (baselineIt->second.numSamples >= baselineMinSamples_))
+  {
+    // floor the standard deviation so a quantized, constant AGC does not
+    // flag every change
+    const AgcBaseline& baseline = baselineIt->second;
+    double minSigma = std::abs(maxValue_ - minValue_) * minSigmaFraction;
+    double sigma    = std::max(sqrt(baseline.variance), minSigma);
+
+    sigmaDeviation = (value - baseline.mean) / sigma;
+    if (std::abs(sigmaDeviation) >= unassuredSigma_)
+    {
+      return data::AssuranceLevel::Unassured;
+    }
+    else if (std::abs(sigmaDeviation) >= inconsistentSigma_)
+    {
+      return data::AssuranceLevel::Inconsistent;
+    }
+    return data::AssuranceLevel::Assured;
+  }
+
+  // nomralize the agc count with the max and min values
+  // then compare to threshold
+  if (normalizeValue(value) < assuranceInconsistentThresh_)
+  {
+    return data::AssuranceLevel::Inconsistent;
+  }
+  return data::AssuranceLevel::Assured;
+}
+
+//==============================================================================
+//------------------------------- learnBaseline --------------------------------
+//==============================================================================
+void AgcCheck::learnBaseline(const data::FrequencyBand& band,
+                             const double&              value)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  if (!adaptiveBaseline_)
+  {
+    return;
+  }
+
+  // learn only during assured periods, using the monitor's overall level
+  // when one is provided
+  data::AssuranceLevel gateLevel =
+    monitorLevelSet_ ? monitorLevel_ : getAssuranceLevel();
+  if (gateLevel != data::AssuranceLevel::Assured)
+  {
+    return;
+  }
+
+  // do not learn gross outliers (excluding anything less would truncate the
+  // distribution and steadily shrink the learned variance)
+  double sigmaDeviation;
+  if (valueLevel(band, value, sigmaDeviation) ==
+      data::AssuranceLevel::Unassured)
+  {
+    return;
+  }
+
+  // exponentially weighted mean and variance, with a cumulative average
+  // while the baseline is shorter than the time constant
+  AgcBaseline& baseline = baselines_[band];
+  ++baseline.numSamples;
+  double alpha =
+    std::max(1.0 / baseline.numSamples, 1.0 / baselineTimeConstant_);
+  double delta = value - baseline.mean;
+  baseline.mean += alpha * delta;
+  baseline.variance = (1.0 - alpha) * (baseline.variance + alpha * delta * delta);
+}
+
 }  // namespace pnt_integrity
@@ -37,6 +37,7 @@
 // June 3, 2019
 //============================================================================//
 #include "pnt_integrity/AngleOfArrivalCheck.hpp"
+#include "pnt_integrity/GPSNavDataCommon.hpp"
 
 #include <algorithm>
 #include <iomanip>
@@ -45,6 +46,127 @@
 
 using namespace logutils;
 
+namespace
+{
+// Returns the nominal carrier wavelength (m) for the provided signal, or NaN
+// if the constellation has no signal in the band or the signal does not have
+// a single fixed carrier (i.e. GLONASS FDMA)
+double getCarrierWavelength(const pnt_integrity::data::SatelliteSystem& system,
+                            const pnt_integrity::data::FrequencyBand&   band)
+{
+  using pnt_integrity::data::FrequencyBand;
+  using pnt_integrity::data::SatelliteSystem;
+
+  double freq = std::numeric_limits<double>::quiet_NaN();
+
+  switch (system)
+  {
+    case SatelliteSystem::GPS:
+    case SatelliteSystem::QZSS:
+    {
+      switch (band)
+      {
+        case FrequencyBand::Band1:
+          freq = 1575.42e6;
+          break;
+        case FrequencyBand::Band2:
+          freq = 1227.60e6;
+          break;
+        case FrequencyBand::Band5:
+          freq = 1176.45e6;
+          break;
+        case FrequencyBand::Band6:
+          // QZSS L6 / LEX
+          freq = 1278.75e6;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    case SatelliteSystem::SBAS:
+    {
+      switch (band)
+      {
+        case FrequencyBand::Band1:
+          freq = 1575.42e6;
+          break;
+        case FrequencyBand::Band5:
+          freq = 1176.45e6;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    case SatelliteSystem::Galileo:
+    {
+      switch (band)
+      {
+        case FrequencyBand::Band1:
+          freq = 1575.42e6;
+          break;
+        // receivers that report a second frequency for Galileo as Band2
+        // are tracking E5b
+        case FrequencyBand::Band2:
+        case FrequencyBand::Band7:
+          freq = 1207.14e6;
+          break;
+        case FrequencyBand::Band5:
+          freq = 1176.45e6;
+          break;
+        case FrequencyBand::Band6:
+          freq = 1278.75e6;
+          break;
+        case FrequencyBand::Band8:
+          freq = 1191.795e6;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    case SatelliteSystem::IRNSS:
+    {
+      switch (band)
+      {
+        case FrequencyBand::Band5:
+          freq = 1176.45e6;
+          break;
+        case FrequencyBand::Band9:
+          freq = 2492.028e6;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    case SatelliteSystem::BeiDou:
+    {
+      switch (band)
+      {
+        case FrequencyBand::Band2:
+          freq = 1561.098e6;
+          break;
+        case FrequencyBand::Band6:
+          freq = 1268.52e6;
+          break;
+        case FrequencyBand::Band7:
+          freq = 1207.14e6;
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  return pnt_integrity::speedOfLight / freq;
+}
+}  // namespace
+
 namespace pnt_integrity
 {
 //==============================================================================
@@ -127,6 +249,9 @@ void AngleOfArrivalCheck::checkAngleOfArrival(
 
   // auto timeSinceLastUpdate = now - lastUpdate;
 
+  // drop any carrier-phase tracking state that has not been updated recently
+  pruneCarrierDiffStates(checkTime);
+
   auto timeSinceLastUpdate = checkTime - lastAssuranceUpdate_;
 
   if (timeSinceLastUpdate > assuranceLevelPeriod_)
@@ -244,8 +369,10 @@ void AngleOfArrivalCheck::checkAngleOfArrival(
       continue;
     }
 
-    // a map to store the single differences
+    // maps to store the pseudorange single differences and the between-epoch
+    // carrier-phase single differences
     SingleDiffMap singleDiffMap;
+    SingleDiffMap carrierDiffMap;
 
     // then look for a match for each local PRN to compute
     data::GNSSObservableMap::const_iterator localMapIt =
@@ -281,13 +408,19 @@ void AngleOfArrivalCheck::checkAngleOfArrival(
         switch (aoaCheckData_)
         {
           case AoaCheckData::UsePseudorange:
+          case AoaCheckData::UseCarrierPhase:
+          case AoaCheckData::UseBoth:
           {
-            // if a match was found and both pseudoranges are valid
-            if (remoteMatchIt != remoteObs.observables.end() &&
+            if (remoteMatchIt == remoteObs.observables.end())
+            {
+              break;
+            }
+
+            // if both pseudoranges are valid, compute the single diff
+            if ((aoaCheckData_ != AoaCheckData::UseCarrierPhase) &&
                 localMapIt->second.pseudorangeValid &&
                 remoteMatchIt->second.pseudorangeValid)
             {
-              // there is a match for this PRN, so compute the single diff
               singleDiffMap[localMapIt->first] =
                 localMapIt->second.pseudorange -
                 remoteMatchIt->second.pseudorange;
@@ -297,25 +430,28 @@ void AngleOfArrivalCheck::checkAngleOfArrival(
               logMsg_(log_str.str(), LogLevel::Debug);
               log_str.str(std::string());
             }
-            break;
-          }  // end UsePseudorange case
-          case AoaCheckData::UseCarrierPhase:
-          {
-            logMsg_(
-              "AngleOfArrivalCheck:checkAngleOfArrival: 'UseCarrierPhase'"
-              " data method not yet implemented",
-              LogLevel::Error);
-            break;
-          }  // end UseCarrierPhase case
-          case AoaCheckData::UseBoth:
-          {
-            logMsg_(
-              "AngleOfArrivalCheck:checkAngleOfArrival: 'UseBoth' "
-              "data method not yet implemented",
-              LogLevel::Error);
-            break;
-          }  // end UseBoth case
 
+            if (aoaCheckData_ != AoaCheckData::UsePseudorange)
+            {
+              CarrierDiffState& state =
+                carrierDiffStates_[remoteIt->first][localMapIt->first];
+
+              double carrierDiff;
+              if (computeCarrierSingleDiff(checkTime,
+                                           localMapIt->second,
+                                           remoteMatchIt->second,
+                                           state,
+                                           carrierDiff))
+              {
+                carrierDiffMap[localMapIt->first] = carrierDiff;
+
+                log_str << "Carrier Diff Rate = " << carrierDiff;
+                logMsg_(log_str.str(), LogLevel::Debug);
+                log_str.str(std::string());
+              }
+            }
+            break;
+          }
         }  // end switch
       }
     }                              // end remote  node for loop match search
@@ -325,21 +461,114 @@ void AngleOfArrivalCheck::checkAngleOfArrival(
               << "():  publishSingleDiffData , checkTime = " << (int)checkTime;
       logMsg_(log_str.str(), LogLevel::Debug);
       log_str.str(std::string());
-      publishSingleDiffData_(checkTime, remoteIt->first, singleDiffMap);
+      publishSingleDiffData_(checkTime,
+                             remoteIt->first,
+                             (aoaCheckData_ == AoaCheckData::UseCarrierPhase)
+                               ? carrierDiffMap
+                               : singleDiffMap);
       lastDiffPublishTime_ = checkTime;
     }
-    nestedForLoopComparison(singleDiffMap, prnAssuranceEachNode);
+
+    if (aoaCheckData_ != AoaCheckData::UseCarrierPhase)
+    {
+      nestedForLoopComparison(
+        singleDiffMap, singleDiffCompareThresh_, prnAssuranceEachNode);
+    }
+    if (aoaCheckData_ != AoaCheckData::UsePseudorange)
+    {
+      nestedForLoopComparison(
+        carrierDiffMap, carrierDiffCompareThresh_, prnAssuranceEachNode);
+    }
 
   }  // end remote node for loop
   setPrnAssuranceLevels(prnAssuranceEachNode);
   calculateAssuranceLevel(checkTime);
 }  // end checkAngleOfArrival
 
+//==============================================================================
+//------------------------- computeCarrierSingleDiff ---------------------------
+//==============================================================================
+bool AngleOfArrivalCheck::computeCarrierSingleDiff(
+  const double&               checkTime,
+  const data::GNSSObservable& localObs,
+  const data::GNSSObservable& remoteObs,
+  CarrierDiffState&           state,
+  double&                     singleDiff)
+{
+  // carrier phase is provided in cycles, so scale it to meters. The single
+  // difference carries an unknown integer ambiguity, which is constant while
+  // lock is held on both nodes and cancels in the between-epoch change.
+  double wavelength =
+    getCarrierWavelength(localObs.satelliteType, localObs.frequencyType);
+
+  // any break in the carrier on either node invalidates the previous epoch
+  if (std::isnan(wavelength) || !localObs.carrierPhaseValid ||
+      !remoteObs.carrierPhaseValid || localObs.lossOfLock ||
+      remoteObs.lossOfLock)
+  {
+    state = CarrierDiffState();
+    return false;
+  }
+
+  double carrierDiff =
+    (localObs.carrierPhase - remoteObs.carrierPhase) * wavelength;
+
+  // the change is scaled by the epoch interval so that PRNs with a missed
+  // epoch remain comparable to the rest
+  double interval = checkTime - state.lastUpdateTime;
+  bool   formed   = state.valid && (interval > 0.0);
+  if (formed)
+  {
+    singleDiff = (carrierDiff - state.singleDiff) / interval;
+  }
+
+  state.singleDiff     = carrierDiff;
+  state.lastUpdateTime = checkTime;
+  state.valid          = true;
+  return formed;
+}
+
+//==============================================================================
+//-------------------------- pruneCarrierDiffStates ----------------------------
+//==============================================================================
+void AngleOfArrivalCheck::pruneCarrierDiffStates(const double& checkTime)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  auto nodeIt = carrierDiffStates_.begin();
+  while (nodeIt != carrierDiffStates_.end())
+  {
+    auto prnIt = nodeIt->second.begin();
+    while (prnIt != nodeIt->second.end())
+    {
+      double age = checkTime - prnIt->second.lastUpdateTime;
+      if ((age > carrierResetGap_) || (age < 0.0))
+      {
+        prnIt = nodeIt->second.erase(prnIt);
+      }
+      else
+      {
+        ++prnIt;
+      }
+    }
+
+    if (nodeIt->second.empty())
+    {
+      nodeIt = carrierDiffStates_.erase(nodeIt);
+    }
+    else
+    {
+      ++nodeIt;
+    }
+  }
+}
+
 //==============================================================================
 //-------------------------- nestedForLoopComparison----------------------------
 //==============================================================================
 void AngleOfArrivalCheck::nestedForLoopComparison(
   const SingleDiffMap&  diffMap,
+  const double&         compareThresh,
   PrnAssuranceEachNode& prnAssuranceEachNode)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
@@ -368,7 +597,7 @@ void AngleOfArrivalCheck::nestedForLoopComparison(
         // flag this comparison PRN
         double singleDiffDiff = std::fabs(sdIt->second - compareIt->second);
 
-        if (singleDiffDiff < singleDiffCompareThresh_)
+        if (singleDiffDiff < compareThresh)
         {
           // count this as a single difference that appears suspect when
           // compared to the PRN we are examining
@@ -505,6 +734,7 @@ void AngleOfArrivalCheck::calculateAssuranceLevel(const double& checkTime)
     AoaCheckDiagnostics diagnostics;
 
     diagnostics.singleDiffThresh      = singleDiffCompareThresh_;
+    diagnostics.carrierDiffThresh     = carrierDiffCompareThresh_;
     diagnostics.unavailablePrnPercent = unavailablePercent;
     diagnostics.suspectPrnPercent     = suspectPercent;
     diagnostics.assuredPrnPercent     = assuredPercent;
@@ -37,11 +37,34 @@
 // May 28, 2019
 //============================================================================//
 #include "pnt_integrity/AssuranceCheck.hpp"
+#include "pnt_integrity/IntegrityMonitor.hpp"
 
 #include <iomanip>
 
 namespace pnt_integrity
 {
+//==============================================================================
+//------------------------------- leaveMonitor ---------------------------------
+//==============================================================================
+void AssuranceCheck::leaveMonitor()
+{
+  std::shared_ptr<MonitorLink> link;
+  {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    link.swap(monitorLink_);
+  }
+
+  if (link)
+  {
+    // the monitor cannot finish destruction while the link is held
+    std::lock_guard<std::mutex> lock(link->mutex);
+    if (link->monitor)
+    {
+      link->monitor->unregisterCheck(this);
+    }
+  }
+}
+
 //==============================================================================
 //--------------------------- changeAssuranceLevel -----------------------------
 //==============================================================================
@@ -52,16 +75,21 @@ void AssuranceCheck::changeAssuranceLevel(const double& updateTime,
   if (newLevel <= assuranceState_.getAssuranceLevel())
   {
     // update immediately if the level is going up
+    bool changed = (newLevel != assuranceState_.getAssuranceLevel());
     assuranceState_.setWithLevel(newLevel);
     lastAssuranceUpdate_ = updateTime;
 
-    std::stringstream changeMsg;
-    changeMsg << "AssuranceCheck::changeAssuranceLevel() : '" << checkName_
-              << "' changing level to: "
-              << (int)assuranceState_.getAssuranceLevel()
-              << " at time : " << std::setprecision(20) << updateTime;
+    // a repeated level only restarts the hold period
+    if (changed)
+    {
+      std::stringstream changeMsg;
+      changeMsg << "AssuranceCheck::changeAssuranceLevel() : '" << checkName_
+                << "' changing level to: "
+                << (int)assuranceState_.getAssuranceLevel()
+                << " at time : " << std::setprecision(20) << updateTime;
 
-    logMsg_(changeMsg.str(), logutils::LogLevel::Debug);
+      logMsg_(changeMsg.str(), logutils::LogLevel::Debug);
+    }
   }
   else if (newLevel > assuranceState_.getAssuranceLevel())
   {
@@ -98,10 +126,10 @@ double AssuranceCheck::calculateDistance(const data::GeodeticPosition3d& pos1,
   double p2Ecef[3];
   pos2.getECEF(p2Ecef);
 
-  double distance =
-    sqrt(pow(p1Ecef[0] - p2Ecef[0], 2.0) + pow(p1Ecef[1] - p2Ecef[1], 2.0) +
-         pow(p1Ecef[2] - p2Ecef[2], 2.0));
-  return distance;
+  double dx = p1Ecef[0] - p2Ecef[0];
+  double dy = p1Ecef[1] - p2Ecef[1];
+  double dz = p1Ecef[2] - p2Ecef[2];
+  return sqrt(dx * dx + dy * dy + dz * dz);
 }
 
 }  // namespace pnt_integrity
@@ -41,6 +41,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <utility>
@@ -54,9 +55,7 @@ bool ClockBiasCheck::handleClockOffset(const data::ClockOffset& clockOffset)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  offsetVec_.push_back(clockOffset);
-
-  this->pruneVec();
+  pushOffset(clockOffset);
 
   return runCheck();
 }
@@ -72,11 +71,11 @@ bool ClockBiasCheck::runCheck()
   IntegrityDataRepository::getInstance().getNewestEntry(newestEntry);
   double checkTime = newestEntry.timeOfWeek_;
 
-  if (this->offsetVec_.size() < this->minNumSamples_)
+  if ((ringCount_ < 2) || (ringCount_ < this->minNumSamples_))
   {
     logMsg_(
       "Clock Bias Check: Unavailable, "
-      "offsetVec_.size() < minNumSamples_",
+      "number of samples < minNumSamples_",
       logutils::LogLevel::Debug);
     changeAssuranceLevel(checkTime, data::AssuranceLevel::Unavailable);
     return false;
@@ -102,60 +101,48 @@ bool ClockBiasCheck::clockBiasCheck(const double& checkTime)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  // Get the expectation and variance of the drift rate
-  // from all but the last sample
-  double       driftExp = 0.0;
-  double       driftVar = 0.0;
-  unsigned int i        = 0;
-  for (auto it = this->offsetVec_.begin(); it != (this->offsetVec_.end() - 1);
-       ++it)
-  {
-    driftExp += it->drift;
-    driftVar += pow(it->drift, 2);
-    ++i;
-  }
-
-  driftExp = driftExp / i;
-  driftVar = driftVar / i;
-  driftVar = driftVar - pow(driftExp, 2);
-  /// \note driftVar - pow(driftExp,2) can sometimes be slightly negative
-  /// due to quantization, set all negative values to 0
+  // The expectation and variance of the drift rate from all but the last
+  // sample are maintained incrementally as samples arrive
+  double numSamples = (double)historyNumSamples_;
+  double sum        = historyDriftSum_ + historyDriftSumComp_;
+  double sumSq      = historyDriftSumSq_ + historyDriftSumSqComp_;
+  double driftExp   = historyDriftShift_ + sum / numSamples;
+  double driftVar   = (sumSq - sum * sum / numSamples) / numSamples;
+  /// \note the variance can become slightly negative due to rounding, set
+  /// all negative values to 0
   if (driftVar < 0)
   {
     driftVar = 0.0;
   }
 
-  char logBuf[1024];
-  snprintf(logBuf, 1024, "\ndriftExp: %0.9lf\ndriftVar: %0.9lf", driftExp, driftVar);
-  std::string logStr(logBuf);
-
-  logMsg_(logStr, logutils::LogLevel::Debug);
+  const data::ClockOffset& lastOffset = offsetAt(ringCount_ - 1);
+  const data::ClockOffset& prevOffset = offsetAt(ringCount_ - 2);
 
   data::Timestamp dt_timestamp =
-    timeDiff((this->offsetVec_.rbegin() + 1)->header.timestampValid,
-             (this->offsetVec_.rbegin())->header.timestampValid);
+    timeDiff(prevOffset.header.timestampValid, lastOffset.header.timestampValid);
   double dt = dt_timestamp.sec + (dt_timestamp.nanoseconds / nSecPerSec);
 
   // propagate the next to last sample forward using that average drift rate
-  double offset_propd = (offsetVec_.rbegin() + 1)->offset + (driftExp * dt);
-
-  snprintf(logBuf, 1024,
-          "offset_propd vs offsetVec_.rbegin()->offset:\n  %0.9lf\n  %0.9lf",
-          offset_propd,
-          offsetVec_.rbegin()->offset);
-  logStr.assign(logBuf);
-  logMsg_(logStr, logutils::LogLevel::Debug);
-
-  snprintf(logBuf, 1024,
-          "fabs(offset_propd - offsetVec_.rbegin()->offset) vs driftRateBound_ "
-          "* dt:\n  %0.9lf\n  %0.9lf",
-          fabs(offset_propd - offsetVec_.rbegin()->offset),
-          this->driftRateBound_ * dt);
-  logStr.assign(logBuf);
-  logMsg_(logStr, logutils::LogLevel::Debug);
+  double offset_propd = prevOffset.offset + (driftExp * dt);
+
+  if (detailedLogging_)
+  {
+    std::stringstream detailMsg;
+    detailMsg << std::fixed << std::setprecision(9) << std::endl
+              << "driftExp: " << driftExp << std::endl
+              << "driftVar: " << driftVar << std::endl
+              << "offset_propd vs last offset:" << std::endl
+              << "  " << offset_propd << std::endl
+              << "  " << lastOffset.offset << std::endl
+              << "fabs(offset_propd - last offset) vs driftRateBound_ * dt:"
+              << std::endl
+              << "  " << fabs(offset_propd - lastOffset.offset) << std::endl
+              << "  " << this->driftRateBound_ * dt;
+    logMsg_(detailMsg.str(), logutils::LogLevel::Debug);
+  }
 
   // if last sample is outside the propagated sample +- driftRateBound*dt
-  double offsetError = fabs(offset_propd - offsetVec_.rbegin()->offset);
+  double offsetError = fabs(offset_propd - lastOffset.offset);
   if (offsetError > (this->driftRateBound_ * dt))
   {
     // Unassured
@@ -180,7 +167,7 @@ bool ClockBiasCheck::clockBiasCheck(const double& checkTime)
   diagnostics.expectedDrift     = driftExp;
   diagnostics.expectedDriftVar  = driftVar;
   diagnostics.propagatedOffset  = offset_propd;
-  diagnostics.actualOffset      = offsetVec_.rbegin()->offset;
+  diagnostics.actualOffset      = lastOffset.offset;
   diagnostics.offsetError       = offsetError;
   diagnostics.driftRateBound    = driftRateBound_ * dt;
   diagnostics.driftRateVarBound = driftRateVarBound_;
@@ -193,18 +180,92 @@ bool ClockBiasCheck::clockBiasCheck(const double& checkTime)
 }
 
 //==============================================================================
-//----------------------------- pruneVec ---------------------------------
+//-------------------------------- pushOffset ----------------------------------
+//==============================================================================
+void ClockBiasCheck::pushOffset(const data::ClockOffset& clockOffset)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  // the current newest sample becomes part of the history
+  if (ringCount_ > 0)
+  {
+    addHistoryDrift(offsetAt(ringCount_ - 1).drift);
+  }
+
+  // evict the oldest sample (always part of the history by now)
+  if (ringCount_ == offsetRing_.size())
+  {
+    removeHistoryDrift(offsetAt(0).drift);
+    ringHead_ = (ringHead_ + 1) % offsetRing_.size();
+    --ringCount_;
+  }
+
+  offsetRing_[(ringHead_ + ringCount_) % offsetRing_.size()] = clockOffset;
+  ++ringCount_;
+}
+
+//==============================================================================
+//----------------------------- addHistoryDrift --------------------------------
 //==============================================================================
-void ClockBiasCheck::pruneVec()
+void ClockBiasCheck::addHistoryDrift(const double& drift)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  if (this->offsetVec_.size() > this->maxNumSamples_)
+  // shift by the first drift of the history so the sums stay small
+  if (historyNumSamples_ == 0)
+  {
+    historyDriftShift_ = drift;
+  }
+
+  ++historyNumSamples_;
+  double shifted = drift - historyDriftShift_;
+  compensatedAdd(historyDriftSum_, historyDriftSumComp_, shifted);
+  compensatedAdd(historyDriftSumSq_, historyDriftSumSqComp_, shifted * shifted);
+}
+
+//==============================================================================
+//--------------------------- removeHistoryDrift -------------------------------
+//==============================================================================
+void ClockBiasCheck::removeHistoryDrift(const double& drift)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  if (historyNumSamples_ <= 1)
+  {
+    historyNumSamples_     = 0;
+    historyDriftSum_       = 0.0;
+    historyDriftSumComp_   = 0.0;
+    historyDriftSumSq_     = 0.0;
+    historyDriftSumSqComp_ = 0.0;
+    return;
+  }
+
+  --historyNumSamples_;
+  double shifted = drift - historyDriftShift_;
+  compensatedAdd(historyDriftSum_, historyDriftSumComp_, -shifted);
+  compensatedAdd(
+    historyDriftSumSq_, historyDriftSumSqComp_, -(shifted * shifted));
+}
+
+//==============================================================================
+//----------------------------- compensatedAdd ---------------------------------
+//==============================================================================
+void ClockBiasCheck::compensatedAdd(double&       sum,
+                                    double&       comp,
+                                    const double& value)
+{
+  // the low-order bits lost from the larger of the two operands are kept in
+  // the compensation term
+  double newSum = sum + value;
+  if (std::fabs(sum) >= std::fabs(value))
+  {
+    comp += (sum - newSum) + value;
+  }
+  else
   {
-    unsigned int offset = this->offsetVec_.size() - this->maxNumSamples_;
-    this->offsetVec_.erase(this->offsetVec_.begin(),
-                           this->offsetVec_.begin() + offset);
+    comp += (value - newSum) + sum;
   }
+  sum = newSum;
 }
 
 //==============================================================================
@@ -215,8 +276,8 @@ bool ClockBiasCheck::enoughSampleTime()
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
   data::Timestamp td =
-    timeDiff(this->offsetVec_.begin()->header.timestampValid,
-             this->offsetVec_.rbegin()->header.timestampValid);
+    timeDiff(offsetAt(0).header.timestampValid,
+             offsetAt(ringCount_ - 1).header.timestampValid);
   return td.sec >= this->minSampleTimeSec_;
 }
 
@@ -38,8 +38,8 @@
 //============================================================================//
 #include "pnt_integrity/CnoCheck.hpp"
 
+#include <cmath>
 #include <iomanip>
-#include <numeric>
 namespace pnt_integrity
 {
 //==============================================================================
@@ -59,95 +59,238 @@ bool CnoCheck::runCheck()
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  std::vector<TimeEntry> timeEntries;
-  if (IntegrityDataRepository::getInstance().getNewestEntries(timeEntries, 0.0))
+  TimeEntry newestEntry;
+  if (!IntegrityDataRepository::getInstance().getNewestEntry(newestEntry))
   {
-    auto entryIt = timeEntries.begin();
+    return false;
+  }
+
+  // start over if time has gone backwards (e.g. week rollover or a cleared
+  // repository)
+  if (newestEntry.timeOfWeek_ < lastProcessedTime_)
+  {
+    lastProcessedTime_ = -1.0;
 
-    double updateTime = entryIt->timeOfWeek_;
-    for (; entryIt != timeEntries.end(); ++entryIt)
+    // epoch times from before the reset would outrank the new ones
+    for (auto groupIt = groupStates_.begin(); groupIt != groupStates_.end();
+         ++groupIt)
     {
-      updateTime           = entryIt->timeOfWeek_;
-      size_t cnoCheckCount = 0;
-      // pull the local observable map
-      data::GNSSObservableMap localObsMap;
-      entryIt->localData_.getData(localObsMap);
-
-      // collect all of the cno's for this time entry
-      std::vector<double> cnoVals;
-      for (auto mapIt = localObsMap.begin(); mapIt != localObsMap.end();
-           ++mapIt)
-      {
-        if (mapIt->second.carrierToNoise > 0)
-        {
-          cnoVals.push_back(mapIt->second.carrierToNoise);
-        }
-      }
+      groupIt->lastEpochTime = -1.0;
+    }
+  }
 
-      // proceed only if we have cno values to process
-      if (cnoVals.size() > 0)
+  // only process the epochs that have not been seen
+  if (newestEntry.timeOfWeek_ > lastProcessedTime_)
+  {
+    std::vector<TimeEntry> timeEntries;
+    IntegrityDataRepository::getInstance().getNewestEntries(
+      timeEntries, lastProcessedTime_);
+
+    for (auto entryIt = timeEntries.begin(); entryIt != timeEntries.end();
+         ++entryIt)
+    {
+      if (entryIt->timeOfWeek_ > lastProcessedTime_)
       {
-        // compute the mode of the cno values
-        double mode = computeCnoMode(cnoVals);
-
-        // determine how many values are within 1 unit of the mode
-        for (auto mapIt = localObsMap.begin(); mapIt != localObsMap.end();
-             ++mapIt)
-        {
-          if ((std::abs(mapIt->second.carrierToNoise - mode)) < 1.0)
-          {
-            cnoCheckCount++;
-          }
-        }
-        // store the count for assurance level calculations
-        cnoCheckCountHist_.push_back(cnoCheckCount);
+        processEpoch(*entryIt);
       }
     }
+    lastProcessedTime_ = newestEntry.timeOfWeek_;
+  }
 
-    if (cnoCheckCountHist_.size() >= cnoFilterWindow_)
+  // only the groups present in the newest epoch with data are evaluated,
+  // so a group that is no longer tracked does not hold the level
+  double newestDataTime = -1.0;
+  for (auto groupIt = groupStates_.begin(); groupIt != groupStates_.end();
+       ++groupIt)
+  {
+    newestDataTime = std::max(newestDataTime, groupIt->lastEpochTime);
+  }
+
+  // the number of values in the newest epoch across all groups, which the
+  // thresholds are sized for
+  size_t epochValCount = 0;
+  for (auto groupIt = groupStates_.begin(); groupIt != groupStates_.end();
+       ++groupIt)
+  {
+    if ((groupIt->lastEpochTime >= 0.0) &&
+        (groupIt->lastEpochTime == newestDataTime))
     {
-      // calculate the mean and then remove 1 vlue
-      uint32_t sum = std::accumulate(
-        cnoCheckCountHist_.begin(), cnoCheckCountHist_.end(), 0);
+      epochValCount += groupIt->epochCnoVals.size();
+    }
+  }
 
-      double avgCount = ((double)sum) / ((double)cnoCheckCountHist_.size());
-      if (avgCount >= assuranceUnassuredThresh_)
-      {
-        changeAssuranceLevel(updateTime, data::AssuranceLevel::Unassured);
-      }
-      else if (avgCount >= assuranceInconsistentThresh_)
+  CnoCheckDiagnostics diagnostics;
+  diagnostics.averageCount       = 0;
+  diagnostics.inconsistentThresh = assuranceInconsistentThresh_;
+  diagnostics.unassuredThresh    = assuranceUnassuredThresh_;
+
+  bool                 levelAvailable = false;
+  data::AssuranceLevel checkLevel     = data::AssuranceLevel::Assured;
+  double               maxAvgCount    = 0.0;
+  for (size_t ii = 0; ii < groupStates_.size(); ++ii)
+  {
+    const CnoGroupState& group = groupStates_[ii];
+    if ((group.lastEpochTime < 0.0) ||
+        (group.lastEpochTime != newestDataTime) ||
+        (group.countWindowSize < cnoFilterWindow_))
+    {
+      continue;
+    }
+
+    double avgCount =
+      ((double)group.countWindowSum) / ((double)group.countWindowSize);
+
+    // scale the thresholds to the group's share of the epoch
+    double groupShare =
+      ((double)group.epochCnoVals.size()) / ((double)epochValCount);
+    double unassuredThresh    = assuranceUnassuredThresh_ * groupShare;
+    double inconsistentThresh = assuranceInconsistentThresh_ * groupShare;
+
+    data::AssuranceLevel groupLevel = data::AssuranceLevel::Assured;
+    if (avgCount >= unassuredThresh)
+    {
+      groupLevel = data::AssuranceLevel::Unassured;
+    }
+    else if (avgCount >= inconsistentThresh)
+    {
+      groupLevel = data::AssuranceLevel::Inconsistent;
+    }
+
+    // keep the worst level among the groups
+    if ((!levelAvailable) || (groupLevel < checkLevel))
+    {
+      checkLevel = groupLevel;
+    }
+    levelAvailable = true;
+    maxAvgCount    = std::max(maxAvgCount, avgCount);
+
+    CnoGroupDiagnostics groupDiag;
+    groupDiag.satelliteSystem =
+      static_cast<data::SatelliteSystem>(ii / numFrequencyBands);
+    groupDiag.frequencyBand =
+      static_cast<data::FrequencyBand>(ii % numFrequencyBands);
+    groupDiag.mode               = group.mode;
+    groupDiag.variance           = group.variance;
+    groupDiag.averageCount       = avgCount;
+    groupDiag.inconsistentThresh = inconsistentThresh;
+    groupDiag.unassuredThresh    = unassuredThresh;
+    groupDiag.assuranceLevel     = groupLevel;
+    diagnostics.groups.push_back(groupDiag);
+  }
+
+  double updateTime = newestEntry.timeOfWeek_;
+  if (levelAvailable)
+  {
+    changeAssuranceLevel(updateTime, checkLevel);
+
+    // only allow publishing when new data has arrived
+    if ((publishDiagnostics_) && (updateTime != lastPublishTime_))
+    {
+      diagnostics.averageCount = maxAvgCount;
+
+      publishDiagnostics_(updateTime, diagnostics);
+
+      lastPublishTime_ = updateTime;
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+//------------------------------ processEpoch ----------------------------------
+//==============================================================================
+void CnoCheck::processEpoch(const TimeEntry& entry)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  // pull the local observable map
+  data::GNSSObservableMap localObsMap;
+  entry.localData_.getData(localObsMap);
+
+  // distribute the cno's for this time entry to their groups
+  epochGroups_.clear();
+  for (auto mapIt = localObsMap.begin(); mapIt != localObsMap.end(); ++mapIt)
+  {
+    const data::GNSSObservable& obs = mapIt->second;
+    if (std::isfinite(obs.carrierToNoise) && (obs.carrierToNoise > 0))
+    {
+      size_t index = groupIndex(obs.satelliteType, obs.frequencyType);
+      if (index >= groupStates_.size())
       {
-        changeAssuranceLevel(updateTime, data::AssuranceLevel::Inconsistent);
+        continue;
       }
-      else
+
+      CnoGroupState& group = groupStates_[index];
+      if (group.lastEpochTime != entry.timeOfWeek_)
       {
-        changeAssuranceLevel(updateTime, data::AssuranceLevel::Assured);
+        // first value for the group in this epoch
+        group.lastEpochTime = entry.timeOfWeek_;
+        group.epochCnoVals.clear();
+        group.epochCnoSum   = 0.0;
+        group.epochCnoSumSq = 0.0;
+        epochGroups_.push_back(index);
       }
+      group.epochCnoVals.push_back(obs.carrierToNoise);
+      group.epochCnoSum += obs.carrierToNoise;
+      group.epochCnoSumSq += obs.carrierToNoise * obs.carrierToNoise;
+    }
+  }
 
-      // only allow publishing when new data has arrived
-      if ((publishDiagnostics_) && (updateTime != lastPublishTime_))
-      {
-        CnoCheckDiagnostics diagnostics;
-        diagnostics.averageCount       = avgCount;
-        diagnostics.inconsistentThresh = assuranceInconsistentThresh_;
-        diagnostics.unassuredThresh    = assuranceUnassuredThresh_;
+  for (auto indexIt = epochGroups_.begin(); indexIt != epochGroups_.end();
+       ++indexIt)
+  {
+    CnoGroupState& group = groupStates_[*indexIt];
 
-        publishDiagnostics_(updateTime, diagnostics);
+    // compute the mode and variance of the group's cno values
+    double numVals = (double)group.epochCnoVals.size();
+    double mean    = group.epochCnoSum / numVals;
+    group.mode     = computeCnoMode(group.epochCnoVals);
+    group.variance =
+      std::max(group.epochCnoSumSq / numVals - mean * mean, 0.0);
 
-        lastPublishTime_ = updateTime;
+    // determine how many values are within 1 unit of the mode
+    size_t cnoCheckCount = 0;
+    for (auto cnoIt = group.epochCnoVals.begin();
+         cnoIt != group.epochCnoVals.end();
+         ++cnoIt)
+    {
+      if (std::abs(*cnoIt - group.mode) < 1.0)
+      {
+        cnoCheckCount++;
       }
-
-      // remove the last value
-      cnoCheckCountHist_.pop_front();
     }
-    //}
+    // store the count for assurance level calculations
+    pushCount(group, cnoCheckCount);
+  }
+}
+
+//==============================================================================
+//-------------------------------- pushCount -----------------------------------
+//==============================================================================
+void CnoCheck::pushCount(CnoGroupState& group, const size_t& count)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-    return true;
+  // the window is allocated the first time the group is seen
+  if (group.countWindow.empty())
+  {
+    group.countWindow.assign(std::max(cnoFilterWindow_, (size_t)1), 0);
   }
-  else
+
+  // evict the oldest count once the window is full
+  if (group.countWindowSize == group.countWindow.size())
   {
-    return false;
+    group.countWindowSum -= group.countWindow[group.countWindowHead];
+    group.countWindowHead =
+      (group.countWindowHead + 1) % group.countWindow.size();
+    --group.countWindowSize;
   }
+
+  group.countWindow[(group.countWindowHead + group.countWindowSize) %
+                    group.countWindow.size()] = count;
+  group.countWindowSum += count;
+  ++group.countWindowSize;
 }
 
 //==============================================================================
@@ -159,36 +302,41 @@ double CnoCheck::computeCnoMode(const std::vector<double>& cnoVals)
 
   if (cnoVals.size() > 0)
   {
-    //   // Allocate an int array of the same size to hold the
-    //   // repetition count
-    //   int* ipRepetition = new int[iSize];
-    std::vector<int> ipRepetition(cnoVals.size());
-
-    for (size_t ii = 0; ii < cnoVals.size(); ++ii)
+    // bin the values, tracking the most populated bin as we go (ties go to
+    // the lowest bin)
+    size_t modeBin = numCnoBins;
+    for (auto cnoIt = cnoVals.begin(); cnoIt != cnoVals.end(); ++cnoIt)
     {
-      ipRepetition[ii] = 0;
-      size_t jj        = 0;
-      // bool bFound      = false;
+      if (!std::isfinite(*cnoIt))
+      {
+        continue;
+      }
+      const size_t bin = cnoBin(*cnoIt);
+      ++cnoHistogram_[bin];
 
-      while ((jj < ii) && (cnoVals[ii] != cnoVals[jj]))
+      if ((modeBin == numCnoBins) ||
+          (cnoHistogram_[bin] > cnoHistogram_[modeBin]) ||
+          ((cnoHistogram_[bin] == cnoHistogram_[modeBin]) && (bin < modeBin)))
       {
-        if (cnoVals[ii] != cnoVals[jj])
-        {
-          ++jj;
-        }
+        modeBin = bin;
       }
-      ++(ipRepetition[jj]);
     }
 
-    int iMaxRepeat = 0;
-    for (size_t ii = 1; ii < cnoVals.size(); ++ii)
+    // reset only the bins that were touched
+    for (auto cnoIt = cnoVals.begin(); cnoIt != cnoVals.end(); ++cnoIt)
     {
-      if (ipRepetition[ii] > ipRepetition[iMaxRepeat])
+      if (std::isfinite(*cnoIt))
       {
-        iMaxRepeat = ii;
+        cnoHistogram_[cnoBin(*cnoIt)] = 0;
       }
     }
-    return cnoVals[iMaxRepeat];
+
+    // no finite values to take the mode of
+    if (modeBin == numCnoBins)
+    {
+      return -1.0;
+    }
+    return (modeBin + 0.5) * cnoBinWidth;
   }
   else
   {
@@ -544,7 +544,7 @@ uint16_t GpsAlmanac::parseAlmanacSVID(const uint8_t (&subframe)[30])
 //------------------------------------------------------------------------------
 void GpsAlmanac::parseAlmanacSVID(const uint8_t (&subframe)[30], uint16_t& svid)
 {
-  svid = (uint16_t)(subframe[6] & 0x3F);
+  svid = (uint16_t)extractNavRaw(subframe, lnav::almanac::svId);
 }
 
 //------------------------------------------------------------------------------
@@ -561,11 +561,7 @@ double GpsAlmanac::parseAlmanacEccentricity(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacEccentricity(const uint8_t (&subframe)[30],
                                           double& ecc)
 {
-  uint16_t tmp = 0;
-  tmp |= subframe[8];
-  tmp |= subframe[7] << 8;
-
-  ecc = (double)tmp * exp2(-21.0);
+  ecc = extractNavField(subframe, lnav::almanac::eccentricity);
 }
 
 //------------------------------------------------------------------------------
@@ -581,7 +577,7 @@ double GpsAlmanac::parseTimeOfAlmanac(const uint8_t (&subframe)[30])
 //------------------------------------------------------------------------------
 void GpsAlmanac::parseTimeOfAlmanac(const uint8_t (&subframe)[30], double& toa)
 {
-  toa = subframe[9] * exp2(12.0);
+  toa = extractNavField(subframe, lnav::almanac::toa);
 }
 
 //------------------------------------------------------------------------------
@@ -598,11 +594,7 @@ double GpsAlmanac::parseAlmanacDeltaI(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacDeltaI(const uint8_t (&subframe)[30],
                                     double& deltaI)
 {
-  uint16_t tmp16 = 0;
-  tmp16 |= subframe[11];
-  tmp16 |= (subframe[10] << 8);
-
-  deltaI = ((int16_t)tmp16) * gpsPi / exp2(19.0);
+  deltaI = extractNavField(subframe, lnav::almanac::deltaI);
 }
 
 //------------------------------------------------------------------------------
@@ -620,11 +612,7 @@ double GpsAlmanac::parseAlmanacRateOfRightAscension(
 void GpsAlmanac::parseAlmanacRateOfRightAscension(const uint8_t (&subframe)[30],
                                                   double& omegaDot)
 {
-  uint16_t tmp16 = 0;
-  tmp16 |= (uint16_t)subframe[13];
-  tmp16 |= ((uint16_t)subframe[12] << 8);
-
-  omegaDot = ((int16_t)tmp16) * gpsPi / exp2(38.0);
+  omegaDot = extractNavField(subframe, lnav::almanac::omegaDot);
 }
 //------------------------------------------------------------------------------
 uint8_t GpsAlmanac::parseAlmanacSVHealth(const uint8_t (&subframe)[30])
@@ -640,7 +628,7 @@ uint8_t GpsAlmanac::parseAlmanacSVHealth(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacSVHealth(const uint8_t (&subframe)[30],
                                       uint8_t& svHealthBits)
 {
-  svHealthBits = subframe[14];
+  svHealthBits = (uint8_t)extractNavRaw(subframe, lnav::almanac::svHealth);
 }
 
 //------------------------------------------------------------------------------
@@ -657,12 +645,7 @@ double GpsAlmanac::parseAlmanacSqrtSemiMajorAxis(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacSqrtSemiMajorAxis(const uint8_t (&subframe)[30],
                                                double& sqrtA)
 {
-  uint32_t tmp32 = 0;
-  tmp32 |= subframe[15] << 24;
-  tmp32 |= subframe[16] << 16;
-  tmp32 |= subframe[17] << 8;
-
-  sqrtA = ((tmp32) >> 8) / exp2(11.0);
+  sqrtA = extractNavField(subframe, lnav::almanac::sqrtA);
 }
 
 //------------------------------------------------------------------------------
@@ -681,12 +664,7 @@ void GpsAlmanac::parseAlmanacLongitudeOfAscendingNode(
   const uint8_t (&subframe)[30],
   double& omega0)
 {
-  uint32_t tmp32 = 0;
-  tmp32 |= subframe[18] << 24;
-  tmp32 |= subframe[19] << 16;
-  tmp32 |= subframe[20] << 8;
-
-  omega0 = (((int32_t)tmp32) >> 8) * gpsPi / exp2(23.0);
+  omega0 = extractNavField(subframe, lnav::almanac::omega0);
 }
 
 //------------------------------------------------------------------------------
@@ -703,12 +681,7 @@ double GpsAlmanac::parseAlmanacArgumentOfPerigee(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacArgumentOfPerigee(const uint8_t (&subframe)[30],
                                                double& w)
 {
-  uint32_t tmp32 = 0;
-  tmp32 |= subframe[21] << 24;
-  tmp32 |= subframe[22] << 16;
-  tmp32 |= subframe[23] << 8;
-
-  w = (((int32_t)tmp32) >> 8) * gpsPi / exp2(23.0);
+  w = extractNavField(subframe, lnav::almanac::omega);
 }
 
 //------------------------------------------------------------------------------
@@ -725,12 +698,7 @@ double GpsAlmanac::parseAlmanacMeanAnomaly(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacMeanAnomaly(const uint8_t (&subframe)[30],
                                          double& m0)
 {
-  uint32_t tmp32 = 0;
-  tmp32 |= subframe[24] << 24;
-  tmp32 |= subframe[25] << 16;
-  tmp32 |= subframe[26] << 8;
-
-  m0 = (((int32_t)tmp32) >> 8) * gpsPi / exp2(23.0);
+  m0 = extractNavField(subframe, lnav::almanac::m0);
 }
 
 //------------------------------------------------------------------------------
@@ -747,11 +715,7 @@ double GpsAlmanac::parseAlmanacClockCoefficient0(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacClockCoefficient0(const uint8_t (&subframe)[30],
                                                double& af0)
 {
-  uint16_t tmp16 = 0;
-  tmp16 |= subframe[27] << 8;
-  tmp16 |= (subframe[29] & 0x1C) << 3;
-
-  af0 = (((int16_t)tmp16) >> 5) / exp2(20.0);
+  af0 = extractNavField(subframe, lnav::almanac::af0);
 }
 
 //------------------------------------------------------------------------------
@@ -768,11 +732,7 @@ double GpsAlmanac::parseAlmanacClockCoefficient1(const uint8_t (&subframe)[30])
 void GpsAlmanac::parseAlmanacClockCoefficient1(const uint8_t (&subframe)[30],
                                                double& af1)
 {
-  uint16_t tmp16 = 0;
-  tmp16 |= subframe[28] << 8;
-  tmp16 |= (subframe[29] & 0xE0);
-
-  af1 = (((int16_t)tmp16) >> 5) / exp2(38.0);
+  af1 = extractNavField(subframe, lnav::almanac::af1);
 }
 //------------------------------------------------------------------------------
 
@@ -1273,57 +1273,24 @@ bool GpsEphemeris::parseSubframe1(const uint8_t (&subframe1)[30],
     return (false);
   }
 
-  // Temporary storage of bit groupings
-  uint32_t tmp   = 0;
-  uint16_t tmp16 = 0;
-
   // Time of week
   towSf1_ = parseTimeOfWeek(subframe1);
 
-  // AS Flag
-  asFlag_ = (AntiSpoofFlag)((subframe1[5] & 0x20) >> 5);
-
-  // Week number
-  weekNumber_ = (uint16_t)(subframe1[7] >> 6);
-  weekNumber_ |= ((uint16_t)subframe1[6]) << 2;
-
-  codeOnL2_ = (L2CodeType)((subframe1[7] & 0x30) >> 4);
-
-  // URA Index
-  uraIndex_ = subframe1[7] & 0x0F;
-
-  // SVHealth
-  svHealth_ = decodeEphemSVHealthBits((uint8_t)((subframe1[8] & 0xFC) >> 2));
-
-  // IODC
-  iodc_ = (uint16_t)((subframe1[8] & 0x03)) << 8;
-  iodc_ |= (uint16_t)subframe1[21];
-
-  // L2P flag
-  l2pDataFlag_ = (L2NavDataFlag)(subframe1[8] >> 7);
-
-  // TGD - estimated group delay differential
-  groupDelay_ = ((int8_t)subframe1[20]) / exp2(31.0);
-
-  // TOC
-  tmp16 = ((uint16_t)subframe1[22]) << 8;
-  tmp16 |= (uint16_t)subframe1[23];
-  clockCorrectionTime_ = tmp16 * 16;
-
-  // af2
-  clockAging3_ = ((int8_t)subframe1[24]) / exp2(55.0);
-
-  // af1
-  tmp16 = ((uint16_t)subframe1[25]) << 8;
-  tmp16 |= (uint16_t)subframe1[26];
-
-  clockAging2_ = ((int16_t)tmp16) / exp2(43.0);
-
-  // af0
-  tmp = (uint32_t)(subframe1[29] & 0xFC) << 8;
-  tmp |= ((uint32_t)subframe1[28]) << 16;
-  tmp |= ((uint32_t)subframe1[27]) << 24;
-  clockAging1_ = (((int32_t)tmp) >> 10) / exp2(31.0);
+  asFlag_      = (AntiSpoofFlag)extractNavRaw(subframe1, lnav::antiSpoofFlag);
+  weekNumber_  = (uint16_t)extractNavRaw(subframe1, lnav::sf1::weekNumber);
+  codeOnL2_    = (L2CodeType)extractNavRaw(subframe1, lnav::sf1::codeOnL2);
+  uraIndex_    = (uint16_t)extractNavRaw(subframe1, lnav::sf1::uraIndex);
+  svHealth_    = decodeEphemSVHealthBits(
+    (uint8_t)extractNavRaw(subframe1, lnav::sf1::svHealth));
+  iodc_        = (uint16_t)extractNavRaw(subframe1, lnav::sf1::iodc);
+  l2pDataFlag_ =
+    (L2NavDataFlag)extractNavRaw(subframe1, lnav::sf1::l2pDataFlag);
+
+  groupDelay_          = extractNavField(subframe1, lnav::sf1::tgd);
+  clockCorrectionTime_ = extractNavField(subframe1, lnav::sf1::toc);
+  clockAging3_         = extractNavField(subframe1, lnav::sf1::af2);
+  clockAging2_         = extractNavField(subframe1, lnav::sf1::af1);
+  clockAging1_         = extractNavField(subframe1, lnav::sf1::af0);
 
   if (checkForValidity)
   {
@@ -1347,72 +1314,20 @@ bool GpsEphemeris::parseSubframe2(const uint8_t (&subframe2)[30],
     return (false);
   }
 
-  // Temporary storage of bit groupings
-  uint32_t tmp32 = 0;
-  uint16_t tmp16 = 0;
-
   // Time of week
   towSf2_ = parseTimeOfWeek(subframe2);
-  // iode
-  iodeSf2_ = (uint16_t)subframe2[6];
-
-  // Crs
-  tmp16 = (uint16_t)subframe2[8];
-  tmp16 |= ((uint16_t)subframe2[7]) << 8;
-
-  sinOrbitRadius_ = ((int16_t)tmp16) / 32.0;
-
-  // delta n
-  tmp16 = (uint16_t)subframe2[10];
-  tmp16 |= ((uint16_t)subframe2[9]) << 8;
-
-  meanMotionDifference_ = ((int16_t)tmp16) * gpsPi / exp2(43.0);
-
-  // M0
-  tmp32 = (uint32_t)subframe2[14];
-  tmp32 |= ((uint32_t)subframe2[13]) << 8;
-  tmp32 |= ((uint32_t)subframe2[12]) << 16;
-  tmp32 |= ((uint32_t)subframe2[11]) << 24;
-
-  meanAnomaly_ = ((int32_t)tmp32) * gpsPi / exp2(31.0);
-
-  // Cuc
-  tmp16 = (uint16_t)subframe2[16];
-  tmp16 |= ((uint16_t)subframe2[15]) << 8;
-
-  cosLatitude_ = ((int16_t)tmp16) / exp2(29.0);
-
-  // eccentricity
-  tmp32 = (uint32_t)subframe2[20];
-  tmp32 |= ((uint32_t)subframe2[19]) << 8;
-  tmp32 |= ((uint32_t)subframe2[18]) << 16;
-  tmp32 |= ((uint32_t)subframe2[17]) << 24;
-
-  eccentricity_ = ((int32_t)tmp32) / exp2(33.0);
-
-  // Cus
-  tmp16 = (uint16_t)subframe2[22];
-  tmp16 |= ((uint16_t)subframe2[21]) << 8;
 
-  sinLatitude_ = ((int16_t)tmp16) / exp2(29.0);
-
-  // sqrtA
-  tmp32 = (uint32_t)subframe2[26];
-  tmp32 |= ((uint32_t)subframe2[25]) << 8;
-  tmp32 |= ((uint32_t)subframe2[24]) << 16;
-  tmp32 |= ((uint32_t)subframe2[23]) << 24;
-
-  sqrtSemiMajorAxis_ = (tmp32) / exp2(19.0);
-
-  // toe
-  tmp32 = (((uint32_t)subframe2[28]) | (((uint32_t)subframe2[27]) << 8));
-  timeOfEphemeris_ = tmp32 * 16.0;
-
-  // fit interval
-  fitInterval_ = (FitInterval)(subframe2[29] >> 7);
-
-  // AODO
-  ageOfDataOffset_ = ((uint16_t)((subframe2[29] & 0x7C) >> 2)) * 900;
+  iodeSf2_              = (uint16_t)extractNavRaw(subframe2, lnav::sf2::iode);
+  sinOrbitRadius_       = extractNavField(subframe2, lnav::sf2::crs);
+  meanMotionDifference_ = extractNavField(subframe2, lnav::sf2::deltaN);
+  meanAnomaly_          = extractNavField(subframe2, lnav::sf2::m0);
+  cosLatitude_          = extractNavField(subframe2, lnav::sf2::cuc);
+  eccentricity_         = extractNavField(subframe2, lnav::sf2::eccentricity);
+  sinLatitude_          = extractNavField(subframe2, lnav::sf2::cus);
+  sqrtSemiMajorAxis_    = extractNavField(subframe2, lnav::sf2::sqrtA);
+  timeOfEphemeris_      = extractNavField(subframe2, lnav::sf2::toe);
+  fitInterval_ = (FitInterval)extractNavRaw(subframe2, lnav::sf2::fitInterval);
+  ageOfDataOffset_ = (uint16_t)extractNavField(subframe2, lnav::sf2::aodo);
 
   if (checkForValidity)
   {
@@ -1436,69 +1351,18 @@ bool GpsEphemeris::parseSubframe3(const uint8_t (&subframe3)[30],
     return (false);
   }
 
-  // Temporary storage of bit groupings
-  uint32_t tmp32 = 0;
-  uint16_t tmp16 = 0;
-
   // Time of week
   towSf3_ = parseTimeOfWeek(subframe3);
 
-  // Cic
-  tmp16 = (uint16_t)subframe3[7];
-  tmp16 |= ((uint16_t)subframe3[6] << 8);
-
-  cosInclination_ = ((int16_t)tmp16) / exp2(29.0);
-
-  // Omega0
-  tmp32 = (uint32_t)subframe3[11];
-  tmp32 |= ((uint32_t)subframe3[10]) << 8;
-  tmp32 |= ((uint32_t)subframe3[9]) << 16;
-  tmp32 |= ((uint32_t)subframe3[8]) << 24;
-
-  rightAscension_ = ((int32_t)tmp32) * gpsPi / exp2(31.0);
-
-  // Cis
-  tmp16 = (uint16_t)subframe3[13];
-  tmp16 |= ((uint16_t)subframe3[12] << 8);
-
-  sinInclination_ = ((int16_t)tmp16) / exp2(29.0);
-
-  // i0
-  tmp32 = (uint32_t)subframe3[17];
-  tmp32 |= ((uint32_t)subframe3[16]) << 8;
-  tmp32 |= ((uint32_t)subframe3[15]) << 16;
-  tmp32 |= ((uint32_t)subframe3[14]) << 24;
-
-  inclinationAngle_ = ((int32_t)tmp32) * gpsPi / exp2(31.0);
-
-  // Crc
-  tmp16 = (uint16_t)subframe3[19];
-  tmp16 |= ((uint16_t)subframe3[18] << 8);
-
-  cosOrbitRadius_ = ((int16_t)tmp16) / 32.0;
-
-  // w
-  tmp32 = (uint32_t)subframe3[23];
-  tmp32 |= ((uint32_t)subframe3[22]) << 8;
-  tmp32 |= ((uint32_t)subframe3[21]) << 16;
-  tmp32 |= ((uint32_t)subframe3[20]) << 24;
-
-  argumentOfPerigee_ = ((int32_t)tmp32) * gpsPi / exp2(31.0);
-
-  // Omega dot
-  tmp32 = subframe3[26] << 8;
-  tmp32 |= subframe3[25] << 16;
-  tmp32 |= subframe3[24] << 24;
-  ascensionRate_ = (((int32_t)tmp32) >> 8) * gpsPi / exp2(43.0);
-
-  // iode
-  iodeSf3_ = (uint16_t)subframe3[27];
-
-  // iDot
-  tmp16 = ((uint16_t)subframe3[29]) & 0xFC;
-  tmp16 |= ((uint16_t)subframe3[28]) << 8;
-
-  inclinationRate_ = (((int16_t)tmp16) >> 2) * gpsPi / exp2(43.0);
+  cosInclination_    = extractNavField(subframe3, lnav::sf3::cic);
+  rightAscension_    = extractNavField(subframe3, lnav::sf3::omega0);
+  sinInclination_    = extractNavField(subframe3, lnav::sf3::cis);
+  inclinationAngle_  = extractNavField(subframe3, lnav::sf3::i0);
+  cosOrbitRadius_    = extractNavField(subframe3, lnav::sf3::crc);
+  argumentOfPerigee_ = extractNavField(subframe3, lnav::sf3::omega);
+  ascensionRate_     = extractNavField(subframe3, lnav::sf3::omegaDot);
+  iodeSf3_           = (uint16_t)extractNavRaw(subframe3, lnav::sf3::iode);
+  inclinationRate_   = extractNavField(subframe3, lnav::sf3::iDot);
 
   if (checkForValidity)
   {
@@ -144,18 +144,14 @@ uint16_t parseSubframeID(const uint8_t (&subframe)[30])
 //------------------------------------------------------------------------------
 void parseSubframeID(const uint8_t (&subframe)[30], uint16_t& subframeID)
 {
-  subframeID = ((uint16_t)((subframe[5] >> 2) & 0x7));
+  subframeID = (uint16_t)extractNavRaw(subframe, lnav::subframeId);
 }
 
 //------------------------------------------------------------------------------
 void parseTimeOfWeek(const uint8_t (&subframe)[30], double& tow)
 {
-  // Time of week
-  uint32_t tmp32 = 0;
-  tmp32 |= subframe[3] << 11;
-  tmp32 |= subframe[4] << 3;
-  tmp32 |= (subframe[5] & 0x80) >> 5;
-  tow = (tmp32 * 3) / 2.0;
+  // Time of week (start of the next subframe)
+  tow = extractNavField(subframe, lnav::towCount);
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,266 @@
+//============================================================================//
+//-------------- pnt_integrity/GeodeticBatch.cpp ---------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Batched geodetic to ECEF conversion and distance kernels
+// October 16, 2026
+//============================================================================//
+#include "pnt_integrity/GeodeticBatch.hpp"
+#include "pnt_integrity/VectorMath.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+// WGS-84 semi-major axis (m)
+const double wgs84A = 6378137.0;
+// WGS-84 first eccentricity
+const double wgs84E = 0.081819190842622;
+// WGS-84 first eccentricity squared
+const double wgs84Esq = wgs84E * wgs84E;
+
+// The number of positions evaluated together. Blocks are held on the stack
+// and always processed at full length so that the loops below have a
+// constant trip count and are vectorized by the compiler.
+const size_t blockSize = 64;
+
+// Computes the sine and cosine of a full block of angles
+void sinCosBlock(const double* angle, double* sinOut, double* cosOut)
+{
+  for (size_t ii = 0; ii < blockSize; ++ii)
+  {
+    pnt_integrity::vector_math::sinCos(angle[ii], sinOut[ii], cosOut[ii]);
+  }
+}
+
+// Converts a block of up to blockSize geodetic positions to ECEF
+void convertBlock(const double* lat,
+                  const double* lon,
+                  const double* alt,
+                  const size_t  num,
+                  double*       x,
+                  double*       y,
+                  double*       z)
+{
+  // copy the inputs into full-length blocks, padding the tail with zeros
+  double latBlock[blockSize] = {0.0};
+  double lonBlock[blockSize] = {0.0};
+  double altBlock[blockSize] = {0.0};
+  std::memcpy(latBlock, lat, num * sizeof(double));
+  std::memcpy(lonBlock, lon, num * sizeof(double));
+  std::memcpy(altBlock, alt, num * sizeof(double));
+
+  double sinLat[blockSize], cosLat[blockSize];
+  double sinLon[blockSize], cosLon[blockSize];
+  sinCosBlock(latBlock, sinLat, cosLat);
+  sinCosBlock(lonBlock, sinLon, cosLon);
+
+  for (size_t ii = 0; ii < blockSize; ++ii)
+  {
+    double primeVertical =
+      wgs84A / sqrt(1.0 - wgs84Esq * sinLat[ii] * sinLat[ii]);
+
+    x[ii] = (primeVertical + altBlock[ii]) * cosLat[ii] * cosLon[ii];
+    y[ii] = (primeVertical + altBlock[ii]) * cosLat[ii] * sinLon[ii];
+    z[ii] = ((1.0 - wgs84Esq) * primeVertical + altBlock[ii]) * sinLat[ii];
+  }
+}
+}  // namespace
+
+namespace pnt_integrity
+{
+//==============================================================================
+//------------------------------ geodeticToEcef --------------------------------
+//==============================================================================
+void geodeticToEcef(const GeodeticPositionBatch& positions,
+                    EcefPositionBatch&           ecef)
+{
+  const size_t num = positions.size();
+  ecef.x.resize(num);
+  ecef.y.resize(num);
+  ecef.z.resize(num);
+
+  double x[blockSize], y[blockSize], z[blockSize];
+  for (size_t start = 0; start < num; start += blockSize)
+  {
+    size_t count = std::min(blockSize, num - start);
+    convertBlock(positions.latitude() + start,
+                 positions.longitude() + start,
+                 positions.altitude() + start,
+                 count,
+                 x,
+                 y,
+                 z);
+
+    std::memcpy(ecef.x.data() + start, x, count * sizeof(double));
+    std::memcpy(ecef.y.data() + start, y, count * sizeof(double));
+    std::memcpy(ecef.z.data() + start, z, count * sizeof(double));
+  }
+}
+
+//==============================================================================
+//---------------------------- calculateDistances ------------------------------
+//==============================================================================
+void calculateDistances(const GeodeticPositionBatch& positions1,
+                        const GeodeticPositionBatch& positions2,
+                        std::vector<double>&         distances)
+{
+  const size_t num = std::min(positions1.size(), positions2.size());
+  distances.resize(num);
+
+  double x1[blockSize], y1[blockSize], z1[blockSize];
+  double x2[blockSize], y2[blockSize], z2[blockSize];
+  double dist[blockSize];
+  for (size_t start = 0; start < num; start += blockSize)
+  {
+    size_t count = std::min(blockSize, num - start);
+    convertBlock(positions1.latitude() + start,
+                 positions1.longitude() + start,
+                 positions1.altitude() + start,
+                 count,
+                 x1,
+                 y1,
+                 z1);
+    convertBlock(positions2.latitude() + start,
+                 positions2.longitude() + start,
+                 positions2.altitude() + start,
+                 count,
+                 x2,
+                 y2,
+                 z2);
+
+    for (size_t ii = 0; ii < blockSize; ++ii)
+    {
+      double dx = x1[ii] - x2[ii];
+      double dy = y1[ii] - y2[ii];
+      double dz = z1[ii] - z2[ii];
+      dist[ii]  = sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    std::memcpy(distances.data() + start, dist, count * sizeof(double));
+  }
+}
+
+//==============================================================================
+//------------------------------- EcefReference --------------------------------
+//==============================================================================
+void EcefReference::setPosition(const data::GeodeticPosition3d& position)
+{
+  position_ = position;
+  position_.getECEF(ecef_);
+}
+
+//------------------------------------------------------------------------------
+double EcefReference::distance(const data::GeodeticPosition3d& position) const
+{
+  double ecef[3];
+  position.getECEF(ecef);
+
+  double dx = ecef[0] - ecef_[0];
+  double dy = ecef[1] - ecef_[1];
+  double dz = ecef[2] - ecef_[2];
+  return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+//------------------------------------------------------------------------------
+void EcefReference::distances(const GeodeticPositionBatch& positions,
+                              std::vector<double>&         distances) const
+{
+  const size_t num = positions.size();
+  distances.resize(num);
+
+  double x[blockSize], y[blockSize], z[blockSize];
+  double dist[blockSize];
+  for (size_t start = 0; start < num; start += blockSize)
+  {
+    size_t count = std::min(blockSize, num - start);
+    convertBlock(positions.latitude() + start,
+                 positions.longitude() + start,
+                 positions.altitude() + start,
+                 count,
+                 x,
+                 y,
+                 z);
+
+    for (size_t ii = 0; ii < blockSize; ++ii)
+    {
+      double dx = x[ii] - ecef_[0];
+      double dy = y[ii] - ecef_[1];
+      double dz = z[ii] - ecef_[2];
+      dist[ii]  = sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    std::memcpy(distances.data() + start, dist, count * sizeof(double));
+  }
+}
+
+//------------------------------------------------------------------------------
+size_t EcefReference::countWithin(const GeodeticPositionBatch& positions,
+                                  const double&                thresh) const
+{
+  const size_t num = positions.size();
+
+  if (thresh < 0.0)
+  {
+    return 0;
+  }
+
+  // compare squared distances to avoid the square root
+  const double threshSq = thresh * thresh;
+
+  size_t count = 0;
+  double x[blockSize], y[blockSize], z[blockSize];
+  for (size_t start = 0; start < num; start += blockSize)
+  {
+    size_t blockCount = std::min(blockSize, num - start);
+    convertBlock(positions.latitude() + start,
+                 positions.longitude() + start,
+                 positions.altitude() + start,
+                 blockCount,
+                 x,
+                 y,
+                 z);
+
+    for (size_t ii = 0; ii < blockCount; ++ii)
+    {
+      double dx = x[ii] - ecef_[0];
+      double dy = y[ii] - ecef_[1];
+      double dz = z[ii] - ecef_[2];
+      count += ((dx * dx + dy * dy + dz * dz) <= threshSq) ? 1 : 0;
+    }
+  }
+  return count;
+}
+
+}  // namespace pnt_integrity
@@ -234,20 +234,25 @@ bool IntegrityDataRepository::getNewestEntries(
 
   if (repository_.size() > 0)
   {
-    for (TimeEntryHistory::iterator it = repository_.begin();
+    bool appending = !timeEntryVec.empty();
+
+    // the history is keyed (and ordered) by time, so skip directly to the
+    // first entry at or after the start time
+    for (TimeEntryHistory::iterator it = repository_.lower_bound(startTime);
          it != repository_.end();
          ++it)
     {
-      if (it->second.timeOfWeek_ >= startTime)
-      {
-        timeEntryVec.push_back(it->second);
-      }
+      timeEntryVec.push_back(it->second);
     }
 
-    // sort entries from oldest to newest
-    std::sort(timeEntryVec.begin(),
-              timeEntryVec.end(),
-              IntegrityDataRepository::sortTimeEntry);
+    // sort entries from oldest to newest (already in order unless appended
+    // to existing entries)
+    if (appending)
+    {
+      std::sort(timeEntryVec.begin(),
+                timeEntryVec.end(),
+                IntegrityDataRepository::sortTimeEntry);
+    }
 
     return true;
   }
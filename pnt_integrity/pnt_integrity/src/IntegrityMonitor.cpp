@@ -46,12 +46,30 @@ namespace pnt_integrity
 //-------------------------- Constructor / Destructor --------------------------
 //==============================================================================
 IntegrityMonitor::IntegrityMonitor(const logutils::LogCallback& log)
-  : logMsg_(log)
+  : logMsg_(log), link_(std::make_shared<MonitorLink>())
 {
+  link_->monitor = this;
+
   // set the repo's logger to use the integrity monitor's logging
   IntegrityDataRepository::getInstance().setLogMessageHandler(log);
 }
 
+IntegrityMonitor::~IntegrityMonitor()
+{
+  // checks destroyed from here on no longer unregister
+  {
+    std::lock_guard<std::mutex> lock(link_->mutex);
+    link_->monitor = nullptr;
+  }
+
+  if (timerWheel_)
+  {
+    // checks may still share the wheel, so it only has to stop firing
+    timerWheel_->stop();
+    timerWheel_->setFiredHandler(nullptr);
+  }
+}
+
 //==============================================================================
 //----------------------------- registerCheck ----------------------------------
 //==============================================================================
@@ -63,15 +81,83 @@ bool IntegrityMonitor::registerCheck(const std::string& checkName,
     std::lock_guard<std::mutex> lock(monitorMutex_);
     check->setLogMessageHandler(logMsg_);
   }
+  {
+    std::lock_guard<std::recursive_mutex> lock(check->assuranceCheckMutex_);
+    check->monitorLink_ = link_;
+  }
   // grant exclusive access to checks_ to add the check to the vector
   std::unique_lock<std::shared_timed_mutex> lock(checkMutex_);
 
   // "register" the check with the integrity monitor
   checks_[checkName] = check;
 
+  if (timerWheel_)
+  {
+    check->setTimerWheel(timerWheel_);
+  }
+
   return true;
 }
 
+//==============================================================================
+//---------------------------- unregisterCheck ---------------------------------
+//==============================================================================
+bool IntegrityMonitor::unregisterCheck(AssuranceCheck* check)
+{
+  bool found = false;
+  {
+    // grant exclusive access to checks_ to remove the check
+    std::unique_lock<std::shared_timed_mutex> lock(checkMutex_);
+    for (auto checkIt = checks_.begin(); checkIt != checks_.end();)
+    {
+      if (checkIt->second == check)
+      {
+        checkIt = checks_.erase(checkIt);
+        found   = true;
+      }
+      else
+      {
+        ++checkIt;
+      }
+    }
+  }
+
+  if (found)
+  {
+    {
+      std::lock_guard<std::recursive_mutex> lock(check->assuranceCheckMutex_);
+      if (check->monitorLink_ == link_)
+      {
+        check->monitorLink_.reset();
+      }
+    }
+    // detach outside checkMutex_, cancelling a timer waits on its callback
+    check->setTimerWheel(nullptr);
+  }
+  return found;
+}
+
+//==============================================================================
+//---------------------------- enableTimerWheel --------------------------------
+//==============================================================================
+void IntegrityMonitor::enableTimerWheel(const double& tickPeriod)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(checkMutex_);
+  if (timerWheel_)
+  {
+    return;
+  }
+
+  timerWheel_.reset(new TimerWheel(tickPeriod));
+  timerWheel_->setFiredHandler([this]() { determineAssuranceLevels(); });
+
+  for (auto check : checks_)
+  {
+    check.second->setTimerWheel(timerWheel_);
+  }
+  timerWheel_->start();
+}
+
 //==============================================================================
 //-------------------------- handleGNSSObservables -----------------------------
 //==============================================================================
@@ -291,6 +377,26 @@ void IntegrityMonitor::handleAGC(const data::AgcValue& agcValue)
 
   determineAssuranceLevels();
 }
+
+//==============================================================================
+//----------------------------- handleAgcSamples -------------------------------
+//==============================================================================
+void IntegrityMonitor::handleAgcSamples(const data::AgcSampleBatch& batch)
+{
+  // grant shared access to the checks_ vector
+  std::shared_lock<std::shared_timed_mutex> lock(checkMutex_);
+
+  bool evaluated = false;
+  for (auto checkIt = checks_.begin(); checkIt != checks_.end(); ++checkIt)
+  {
+    evaluated |= checkIt->second->handleAgcSamples(batch);
+  }
+
+  if (evaluated)
+  {
+    determineAssuranceLevels();
+  }
+}
 //==============================================================================
 //-------------------------- determineAssuranceLevels -------------------------
 //==============================================================================
@@ -310,34 +416,44 @@ void IntegrityMonitor::determineAssuranceLevels()
     }
   }
 
-  // grant this thread exclusive access to clear checksUsed_
-  // and access other private data
-  std::lock_guard<std::mutex> lock(monitorMutex_);
-  checksUsed_.clear();
-
-  if (weightScaleFactor > 0)
+  data::AssuranceLevel monitorLevel;
   {
-    // loop through all checks and call the handler for this data type
-    double cumulativeAssuranceValue = 0;
-    for (checkIt = checks_.begin(); checkIt != checks_.end(); ++checkIt)
+    // grant this thread exclusive access to clear checksUsed_
+    // and access other private data
+    std::lock_guard<std::mutex> lock(monitorMutex_);
+    checksUsed_.clear();
+
+    if (weightScaleFactor > 0)
     {
-      if (checkIt->second->isCheckUsed())
+      // loop through all checks and call the handler for this data type
+      double cumulativeAssuranceValue = 0;
+      for (checkIt = checks_.begin(); checkIt != checks_.end(); ++checkIt)
       {
-        double       checkVal = checkIt->second->getAssuranceValue();
-        const double weightedVal =
-          checkVal * (checkIt->second->getWeight() / weightScaleFactor);
-
-        cumulativeAssuranceValue += weightedVal;
-        checksUsed_.push_back(checkIt->second->getName());
+        if (checkIt->second->isCheckUsed())
+        {
+          double       checkVal = checkIt->second->getAssuranceValue();
+          const double weightedVal =
+            checkVal * (checkIt->second->getWeight() / weightScaleFactor);
+
+          cumulativeAssuranceValue += weightedVal;
+          checksUsed_.push_back(checkIt->second->getName());
+        }
       }
+      // now set the overall state with
+      assuranceState_.setWithValue(cumulativeAssuranceValue);
     }
-    // now set the overall state with
-    assuranceState_.setWithValue(cumulativeAssuranceValue);
+    else
+    {
+      // all the checks are unavailable
+      assuranceState_.setWithLevel(data::AssuranceLevel::Unavailable);
+    }
+    monitorLevel = assuranceState_.getAssuranceLevel();
   }
-  else
+
+  // provide the overall level to the checks (outside of the monitor lock)
+  for (checkIt = checks_.begin(); checkIt != checks_.end(); ++checkIt)
   {
-    // all the checks are unavailable
-    assuranceState_.setWithLevel(data::AssuranceLevel::Unavailable);
+    checkIt->second->setMonitorAssuranceLevel(monitorLevel);
   }
 }
 
@@ -39,6 +39,7 @@
 
 #include "pnt_integrity/NavigationDataCheck.hpp"
 #include <algorithm>
+#include <cstring>
 #include <iomanip>  // setfill, setw
 #include "pnt_integrity/GPSAlmanac.hpp"
 #include "pnt_integrity/GPSEphemeris.hpp"
@@ -46,12 +47,75 @@
 
 namespace pnt_integrity
 {
+namespace
+{
+// maximum change in the tow offset between subframes (seconds)
+const double maxTowOffsetDiff = 2.0;
+
+// seconds in a GPS week
+const double secondsPerWeek = 604800.0;
+
+// number of consecutive self-consistent subframes needed to move a PRN's tow
+// anchor after a mismatch
+const size_t towReanchorCount = 3;
+
+// difference between the tow advance and the elapsed time since an anchor,
+// allowing for week rollover
+double towAdvanceError(double anchorTow,
+                       double anchorTimeStamp,
+                       double newTowSec,
+                       double newTimestamp)
+{
+  double towDelta = newTowSec - anchorTow;
+  if (towDelta < -secondsPerWeek / 2)
+  {
+    towDelta += secondsPerWeek;
+  }
+  return towDelta - (newTimestamp - anchorTimeStamp);
+}
+
+// IODC (subframe 1) or IODE (subframes 2 and 3) of an ephemeris subframe
+uint16_t parseIssueOfData(const uint8_t (&subframe)[30], uint16_t subframeId)
+{
+  switch (subframeId)
+  {
+    case 1:
+      return (uint16_t)(((subframe[8] & 0x03) << 8) | subframe[21]);
+    case 2:
+      return subframe[6];
+    default:
+      return subframe[27];
+  }
+}
+
+// first byte of the clock / orbit parameters in an ephemeris subframe, which
+// may only change along with the issue of data (subframe 1 words 7-10,
+// subframes 2 and 3 words 3-10)
+size_t firstParameterByte(uint16_t subframeId)
+{
+  return (subframeId == 1) ? 18 : 6;
+}
+
+// compares subframes from the given byte on, ignoring the two
+// non-information bits at the end of word 10
+bool sameSubframeData(const uint8_t (&lhs)[30],
+                      const uint8_t (&rhs)[30],
+                      size_t firstByte)
+{
+  return (std::memcmp(lhs + firstByte, rhs + firstByte, 29 - firstByte) ==
+          0) &&
+         ((lhs[29] & 0xFC) == (rhs[29] & 0xFC));
+}
+}  // namespace
+
 //==============================================================================
 //--------------------------- handleGnssSubframe -------------------------------
 //==============================================================================
 bool NavigationDataCheck::handleGnssSubframe(
   const data::GNSSSubframe& gnssSubframe)
 {
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
   // Filter out garbage CNAV subframes
   if (*gnssSubframe.subframeData.begin() != 0x8B)
   {
@@ -96,47 +160,9 @@ bool NavigationDataCheck::handleGnssSubframe(
   uint16_t newWeekNumber = std::numeric_limits<uint16_t>::max();
   if ((subframeId >= 1) && (subframeId <= 3))
   {
-    // parse ephemeris
-    GpsEphemeris ephemeris;
-    if (ephemeris.setSubframe(prn, subframeBytes))
-    {
-      // we have a valid ephemeris subframe
-      diagnostics.dataValid = true;
-
-      std::stringstream validMsg;
-      validMsg << "Valid ephem received for prn: " << prn;
-      logMsg_(validMsg.str(), logutils::LogLevel::Debug);
-
-      // extract TOW value from the apropriate subframe
-      switch (subframeId)
-      {
-        case 1:
-        {
-          newTowSec     = ephemeris.getTowSf1();
-          newWeekNumber = ephemeris.getWeekNumber();
-          break;
-        }
-        case 2:
-        {
-          newTowSec = ephemeris.getTowSf2();
-          break;
-        }
-        case 3:
-        {
-          newTowSec = ephemeris.getTowSf3();
-          break;
-        }
-      }
-    }
-    else
-    {
-      // data for this subframe is not valid
-      diagnostics.dataValid = false;
-      std::stringstream dataMsg;
-      dataMsg << getSubframeErrorStr(prn, subframeId, ephemeris);
-      logMsg_(dataMsg.str(), logutils::LogLevel::Warn);
-      diagnostics.dataValidMsg = dataMsg.str();
-    }
+    // update the PRN's cached ephemeris
+    updateEphemeris(
+      prn, subframeId, subframeBytes, diagnostics, newTowSec, newWeekNumber);
   }
   else if ((subframeId >= 4) && (subframeId <= 5))
   {
@@ -228,7 +254,7 @@ bool NavigationDataCheck::handleGnssSubframe(
         // possible week rollovers
         double offsetDiff =
           std::abs(newOffset - towOffset_ - numRollovers * 604800);
-        if (offsetDiff <= 2.0)
+        if (offsetDiff <= maxTowOffsetDiff)
         {
           // offset is acceptable
           diagnostics.towValid = true;
@@ -250,6 +276,14 @@ bool NavigationDataCheck::handleGnssSubframe(
       }
     }
 
+    // check the tow against the previous tow from the same satellite, which
+    // catches a single spoofed satellite that the pooled offset may miss
+    if (!std::isnan(newTowSec) &&
+        (newTowSec != std::numeric_limits<double>::min()))
+    {
+      checkPrnTow(prn, subframeId, newTowSec, newTimestamp, diagnostics);
+    }
+
     // check week number
     if (subframeId == 1)
     {
@@ -304,24 +338,158 @@ bool NavigationDataCheck::handleGnssSubframe(
     }
   }
 
-  // diagnostics_ = diagnostics;
   diagBuffer_.push_back(diagnostics);
-  return true;
+
+  // evaluate on arrival rather than waiting for a polling period
+  return runCheck();
 }
 
 //==============================================================================
-//--------------------------------- runCheck -----------------------------------
+//----------------------------- updateEphemeris --------------------------------
 //==============================================================================
-void NavigationDataCheck::runCheckThread()
+bool NavigationDataCheck::updateEphemeris(int                      prn,
+                                          uint16_t                 subframeId,
+                                          const uint8_t            (&subframe)[30],
+                                          NavDataCheckDiagnostics& diagnostics,
+                                          double&                  newTowSec,
+                                          uint16_t& newWeekNumber)
 {
-  // Calls runCheck() at 1Hz until exitSignal is called in destructor
-  while (futureObj_.wait_for(std::chrono::milliseconds(1000)) ==
-         std::future_status::timeout)
+  PrnNavState&   prnState = prnStates_[prn];
+  const int      idx      = subframeId - 1;
+  const uint16_t issue    = parseIssueOfData(subframe, subframeId);
+
+  if (prnState.hasSubframe[idx] && (prnState.issue[idx] == issue))
   {
-    runCheck();
+    if (sameSubframeData(prnState.subframes[idx], subframe, 6))
+    {
+      // repeated broadcast of the cached subframe, nothing new to decode
+      diagnostics.dataValid = true;
+      newTowSec             = parseTimeOfWeek(subframe);
+      if (subframeId == 1)
+      {
+        newWeekNumber = prnState.ephemeris.getWeekNumber();
+      }
+      return true;
+    }
+
+    if (!sameSubframeData(
+          prnState.subframes[idx], subframe, firstParameterByte(subframeId)))
+    {
+      // the clock / orbit parameters must not change without a new issue
+      diagnostics.dataValid = false;
+      std::stringstream dataMsg;
+      dataMsg << "PRN " << prn << ", SF" << subframeId
+              << ": ephemeris parameters changed without an "
+              << ((subframeId == 1) ? "IODC" : "IODE") << " change ("
+              << issue << ")";
+      diagnostics.dataValidMsg = dataMsg.str();
+      logMsg_(dataMsg.str(), logutils::LogLevel::Warn);
+      return false;
+    }
   }
+
+  // decode the new (or changed) subframe into the cached ephemeris
+  if (prnState.ephemeris.setSubframe(prn, subframe))
+  {
+    // we have a valid ephemeris subframe
+    diagnostics.dataValid = true;
+
+    std::memcpy(prnState.subframes[idx], subframe, 30);
+    prnState.hasSubframe[idx] = true;
+    prnState.issue[idx]       = issue;
+
+    std::stringstream validMsg;
+    validMsg << "Valid ephem received for prn: " << prn;
+    logMsg_(validMsg.str(), logutils::LogLevel::Debug);
+
+    newTowSec = parseTimeOfWeek(subframe);
+    if (subframeId == 1)
+    {
+      newWeekNumber = prnState.ephemeris.getWeekNumber();
+    }
+    return true;
+  }
+
+  // data for this subframe is not valid, and no longer matches the cache
+  prnState.hasSubframe[idx] = false;
+
+  diagnostics.dataValid = false;
+  std::stringstream dataMsg;
+  dataMsg << getSubframeErrorStr(prn, subframeId, prnState.ephemeris);
+  logMsg_(dataMsg.str(), logutils::LogLevel::Warn);
+  diagnostics.dataValidMsg = dataMsg.str();
+  return false;
 }
 
+//==============================================================================
+//------------------------------- checkPrnTow ----------------------------------
+//==============================================================================
+void NavigationDataCheck::checkPrnTow(int                      prn,
+                                      uint16_t                 subframeId,
+                                      double                   newTowSec,
+                                      double                   newTimestamp,
+                                      NavDataCheckDiagnostics& diagnostics)
+{
+  PrnNavState& prnState = prnStates_[prn];
+
+  // the tow should advance with the timestamps
+  if (!std::isnan(prnState.lastTowTimeStamp) &&
+      (std::abs(towAdvanceError(prnState.lastTow,
+                                prnState.lastTowTimeStamp,
+                                newTowSec,
+                                newTimestamp)) > maxTowOffsetDiff))
+  {
+    diagnostics.towValid = false;
+    std::stringstream towMsg;
+    towMsg << "PRN " << prn << ", SF" << subframeId << ": TOW " << newTowSec
+           << " s is inconsistent with TOW " << prnState.lastTow << " s "
+           << (newTimestamp - prnState.lastTowTimeStamp)
+           << " s before from this PRN";
+    if (!diagnostics.towValidMsg.empty())
+    {
+      diagnostics.towValidMsg += ". ";
+    }
+    diagnostics.towValidMsg += towMsg.str();
+    logMsg_(towMsg.str(), logutils::LogLevel::Warn);
+
+    // the mismatching subframes are tracked against each other, and if they
+    // stay self-consistent (e.g. after a receiver clock step or a legitimate
+    // reacquisition) the PRN is re-anchored to them rather than failing for
+    // good
+    if ((prnState.candidateCount > 0) &&
+        (std::abs(towAdvanceError(prnState.candidateTow,
+                                  prnState.candidateTowTimeStamp,
+                                  newTowSec,
+                                  newTimestamp)) <= maxTowOffsetDiff))
+    {
+      prnState.candidateCount++;
+    }
+    else
+    {
+      prnState.candidateCount = 1;
+    }
+    prnState.candidateTow          = newTowSec;
+    prnState.candidateTowTimeStamp = newTimestamp;
+
+    if (prnState.candidateCount < towReanchorCount)
+    {
+      return;
+    }
+
+    std::stringstream anchorMsg;
+    anchorMsg << "PRN " << prn << ": re-anchoring TOW after "
+              << prnState.candidateCount << " consistent subframes";
+    logMsg_(anchorMsg.str(), logutils::LogLevel::Info);
+  }
+
+  prnState.candidateCount   = 0;
+  prnState.lastTow          = newTowSec;
+  prnState.lastTowTimeStamp = newTimestamp;
+}
+
+//==============================================================================
+//--------------------------------- runCheck -----------------------------------
+//==============================================================================
 bool NavigationDataCheck::runCheck()
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
@@ -352,6 +520,13 @@ bool NavigationDataCheck::runCheck()
 
   if (!combinedDiagnostics.dataValid || !combinedDiagnostics.towValid ||
       !combinedDiagnostics.wnValid)
+  {
+    // (re)start the hold on every bad subframe
+    unassuredUntil_ = updateTime + unassuredHoldTime_;
+    scheduleExpiryTimer(updateTime);
+  }
+
+  if (updateTime < unassuredUntil_)
   {
     changeAssuranceLevel(updateTime, data::AssuranceLevel::Unassured);
   }
@@ -367,6 +542,85 @@ bool NavigationDataCheck::runCheck()
   return true;
 }
 
+//==============================================================================
+//------------------------------ setTimerWheel ---------------------------------
+//==============================================================================
+void NavigationDataCheck::setTimerWheel(std::shared_ptr<TimerWheel> wheel)
+{
+  cancelExpiryTimer();
+
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+  timerWheel_ = std::move(wheel);
+
+  // cover a hold that is already in progress
+  if (timerWheel_)
+  {
+    double now = std::chrono::duration<double>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+                   .count();
+    if (getAssuranceLevel() == data::AssuranceLevel::Unassured)
+    {
+      scheduleExpiryTimer(now);
+    }
+  }
+}
+
+//==============================================================================
+//--------------------------- scheduleExpiryTimer ------------------------------
+//==============================================================================
+void NavigationDataCheck::scheduleExpiryTimer(const double& now)
+{
+  // assumes assuranceCheckMutex_ is held. A pending timer is left in place
+  // (and re-armed when it fires) rather than cancelled, since cancelling
+  // here could wait on a callback that is itself waiting on this lock.
+  if (!timerWheel_ || (expiryTimerId_ != 0))
+  {
+    return;
+  }
+
+  // the level can only be raised once both the hold and the base class's
+  // assurance level period have passed
+  const double expiryTime =
+    std::max(unassuredUntil_, lastAssuranceUpdate_ + assuranceLevelPeriod_);
+
+  expiryTimerId_ = timerWheel_->schedule(expiryTime - now, [this]() {
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    expiryTimerId_ = 0;
+
+    double firedTime = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+    runCheck();
+
+    // re-arm if the hold was extended by a later bad subframe
+    if (getAssuranceLevel() == data::AssuranceLevel::Unassured)
+    {
+      scheduleExpiryTimer(firedTime);
+    }
+  });
+}
+
+//==============================================================================
+//---------------------------- cancelExpiryTimer -------------------------------
+//==============================================================================
+void NavigationDataCheck::cancelExpiryTimer()
+{
+  std::shared_ptr<TimerWheel> wheel;
+  TimerWheel::TimerId         timerId;
+  {
+    // detach first so a running callback cannot re-arm the timer
+    std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+    wheel.swap(timerWheel_);
+    timerId        = expiryTimerId_;
+    expiryTimerId_ = 0;
+  }
+  // cancel outside the lock, it waits for a callback that is running
+  if (wheel && (timerId != 0))
+  {
+    wheel->cancel(timerId);
+  }
+}
+
 std::string NavigationDataCheck::getSubframeErrorStr(int      prn,
                                                      uint16_t subframeId,
                                                      const GpsEphemeris& ephem)
@@ -0,0 +1,417 @@
+//============================================================================//
+//---------------- pnt_integrity/OrbitBatch.cpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Batched satellite orbit and clock propagation
+// October 16, 2026
+//============================================================================//
+#include "pnt_integrity/OrbitBatch.hpp"
+#include "pnt_integrity/VectorMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+// The number of Newton iterations used to solve Kepler's equation. Starting
+// from E = M + e * sin(M), the error after two iterations is below 1e-18 rad
+// for the eccentricities allowed by IS-GPS-200 (e < 0.03); the third is margin.
+const unsigned int keplerIterations = 3;
+
+// The number of satellites evaluated together
+const size_t blockSize = 64;
+
+const double secondsInWeek = 604800.0;
+
+// Accounts for beginning or end of week crossover, as in
+// GpsEphemeris::weekCrossoverCheck(), by subtracting the nearest whole
+// number of weeks (rounding without branches)
+inline double weekCrossover(const double& time)
+{
+  using pnt_integrity::vector_math::roundMagic;
+  double weeks = (time * (1.0 / secondsInWeek) + roundMagic) - roundMagic;
+  return time - weeks * secondsInWeek;
+}
+}  // namespace
+
+namespace pnt_integrity
+{
+//==============================================================================
+//------------------------------- reserve --------------------------------------
+//==============================================================================
+void OrbitParameterBatch::reserve(const size_t& capacity)
+{
+  prn_.reserve(capacity);
+  for (auto vec : {&toc_,           &af0_,          &af1_,
+                   &af2_,           &tgd_,          &toe_,
+                   &semiMajorAxis_, &eccentricity_, &m0_,
+                   &meanMotion_,    &sqrtOneMinusEccSq_,
+                   &cosPerigee_,    &sinPerigee_,   &eFsqrtA_,
+                   &lonAscNode0_,   &lonAscNodeDot_, &i0_,
+                   &iDot_,          &cuc_,          &cus_,
+                   &crc_,           &crs_,          &cic_,
+                   &cis_,           &validScale_})
+  {
+    vec->reserve(capacity);
+  }
+}
+
+//==============================================================================
+//-------------------------------- clear ---------------------------------------
+//==============================================================================
+void OrbitParameterBatch::clear()
+{
+  prn_.clear();
+  for (auto vec : {&toc_,           &af0_,          &af1_,
+                   &af2_,           &tgd_,          &toe_,
+                   &semiMajorAxis_, &eccentricity_, &m0_,
+                   &meanMotion_,    &sqrtOneMinusEccSq_,
+                   &cosPerigee_,    &sinPerigee_,   &eFsqrtA_,
+                   &lonAscNode0_,   &lonAscNodeDot_, &i0_,
+                   &iDot_,          &cuc_,          &cus_,
+                   &crc_,           &crs_,          &cic_,
+                   &cis_,           &validScale_})
+  {
+    vec->clear();
+  }
+}
+
+//==============================================================================
+//------------------------------ push_back -------------------------------------
+//==============================================================================
+void OrbitParameterBatch::push_back(const GpsEphemeris& ephemeris)
+{
+  EphemerisParameters eph = ephemeris.getEphemeris();
+
+  push_back(eph.prn,
+            eph.clockCorrectionTime,
+            eph.clockAging1,
+            eph.clockAging2,
+            eph.clockAging3,
+            eph.groupDelay,
+            eph.timeOfEphemeris,
+            eph.sqrtSemiMajorAxis,
+            eph.eccentricity,
+            eph.meanAnomaly,
+            eph.meanMotionDifference,
+            eph.argumentOfPerigee,
+            eph.rightAscension,
+            eph.ascensionRate,
+            eph.inclinationAngle,
+            eph.inclinationRate,
+            eph.cosLatitude,
+            eph.sinLatitude,
+            eph.cosOrbitRadius,
+            eph.sinOrbitRadius,
+            eph.cosInclination,
+            eph.sinInclination);
+}
+
+//------------------------------------------------------------------------------
+void OrbitParameterBatch::push_back(const GpsAlmanac& almanac)
+{
+  AlmanacParameters alm = almanac.getAlmanac();
+
+  // the almanac inclination is relative to 0.3 semicircles, and the
+  // almanac has no harmonic corrections (see GpsAlmanac::getSvState())
+  push_back(alm.prn,
+            alm.toa,
+            alm.af0,
+            alm.af1,
+            0.0,
+            0.0,
+            alm.toa,
+            alm.sqrtA,
+            alm.eccentricity,
+            alm.m0,
+            0.0,
+            alm.omega,
+            alm.omega0,
+            alm.omegaDot,
+            alm.deltaI + 0.3 * gpsPi,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0,
+            0.0);
+}
+
+//------------------------------------------------------------------------------
+void OrbitParameterBatch::push_back(const uint16_t& prn,
+                                    const double&   clockCorrectionTime,
+                                    const double&   clockAging1,
+                                    const double&   clockAging2,
+                                    const double&   clockAging3,
+                                    const double&   groupDelay,
+                                    const double&   timeOfEphemeris,
+                                    const double&   sqrtSemiMajorAxis,
+                                    const double&   eccentricity,
+                                    const double&   meanAnomaly,
+                                    const double&   meanMotionDifference,
+                                    const double&   argumentOfPerigee,
+                                    const double&   rightAscension,
+                                    const double&   ascensionRate,
+                                    const double&   inclinationAngle,
+                                    const double&   inclinationRate,
+                                    const double&   cosLatitude,
+                                    const double&   sinLatitude,
+                                    const double&   cosOrbitRadius,
+                                    const double&   sinOrbitRadius,
+                                    const double&   cosInclination,
+                                    const double&   sinInclination)
+{
+  double semiMajorAxis = sqrtSemiMajorAxis * sqrtSemiMajorAxis;
+
+  prn_.push_back(prn);
+
+  toc_.push_back(clockCorrectionTime);
+  af0_.push_back(clockAging1);
+  af1_.push_back(clockAging2);
+  af2_.push_back(clockAging3);
+  tgd_.push_back(groupDelay);
+
+  toe_.push_back(timeOfEphemeris);
+  semiMajorAxis_.push_back(semiMajorAxis);
+  eccentricity_.push_back(eccentricity);
+  m0_.push_back(meanAnomaly);
+  // an empty orbit cannot be propagated; a zero mean motion keeps its
+  // propagation finite so that the state can be zeroed by the scale factor
+  validScale_.push_back((semiMajorAxis != 0.0) ? 1.0 : 0.0);
+  meanMotion_.push_back(
+    (semiMajorAxis != 0.0)
+      ? sqrt(gpsGM / pow(semiMajorAxis, 3.0)) + meanMotionDifference
+      : 0.0);
+  sqrtOneMinusEccSq_.push_back(sqrt(1.0 - eccentricity * eccentricity));
+  cosPerigee_.push_back(cos(argumentOfPerigee));
+  sinPerigee_.push_back(sin(argumentOfPerigee));
+  eFsqrtA_.push_back(eccentricity * gpsF * sqrtSemiMajorAxis);
+  lonAscNode0_.push_back(rightAscension -
+                         gpsEarthRotationRate * timeOfEphemeris);
+  lonAscNodeDot_.push_back(ascensionRate - gpsEarthRotationRate);
+  i0_.push_back(inclinationAngle);
+  iDot_.push_back(inclinationRate);
+  cuc_.push_back(cosLatitude);
+  cus_.push_back(sinLatitude);
+  crc_.push_back(cosOrbitRadius);
+  crs_.push_back(sinOrbitRadius);
+  cic_.push_back(cosInclination);
+  cis_.push_back(sinInclination);
+}
+
+//==============================================================================
+//----------------------------- getSvStates ------------------------------------
+//==============================================================================
+void OrbitParameterBatch::getSvStates(const double&              receiveTime,
+                                      const std::vector<double>& pseudoranges,
+                                      SvStateBatch&              states) const
+{
+  using vector_math::sinCos;
+
+  const size_t num = size();
+  states.x.resize(num);
+  states.y.resize(num);
+  states.z.resize(num);
+  states.vx.resize(num);
+  states.vy.resize(num);
+  states.vz.resize(num);
+  states.clockCorrection.resize(num);
+  states.valid.resize(num);
+
+  const bool hasRanges = (pseudoranges.size() == num);
+
+  // per-satellite parameters
+  const double* toc               = toc_.data();
+  const double* af0               = af0_.data();
+  const double* af1               = af1_.data();
+  const double* af2               = af2_.data();
+  const double* tgd               = tgd_.data();
+  const double* toe               = toe_.data();
+  const double* semiMajorAxis     = semiMajorAxis_.data();
+  const double* eccentricity      = eccentricity_.data();
+  const double* m0                = m0_.data();
+  const double* meanMotion        = meanMotion_.data();
+  const double* sqrtOneMinusEccSq = sqrtOneMinusEccSq_.data();
+  const double* cosPerigee        = cosPerigee_.data();
+  const double* sinPerigee        = sinPerigee_.data();
+  const double* eFsqrtA           = eFsqrtA_.data();
+  const double* lonAscNode0       = lonAscNode0_.data();
+  const double* lonAscNodeRate    = lonAscNodeDot_.data();
+  const double* i0                = i0_.data();
+  const double* inclinationRate   = iDot_.data();
+  const double* cuc               = cuc_.data();
+  const double* cus               = cus_.data();
+  const double* crc               = crc_.data();
+  const double* crs               = crs_.data();
+  const double* cic               = cic_.data();
+  const double* cis               = cis_.data();
+  const double* validScale        = validScale_.data();
+
+  // Satellites are evaluated in blocks written to stack arrays, so that the
+  // compiler can prove the outputs do not alias the parameters and
+  // vectorize the loop
+  double  transitBlock[blockSize];
+  double  x[blockSize], y[blockSize], z[blockSize];
+  double  vx[blockSize], vy[blockSize], vz[blockSize];
+  double  clock[blockSize];
+  uint8_t valid[blockSize];
+
+  for (size_t start = 0; start < num; start += blockSize)
+  {
+    const size_t count = std::min(blockSize, num - start);
+
+    for (size_t jj = 0; jj < count; ++jj)
+    {
+      transitBlock[jj] =
+        hasRanges ? pseudoranges[start + jj] / speedOfLight : 0.0;
+    }
+
+    for (size_t jj = 0; jj < count; ++jj)
+    {
+      const size_t ii = start + jj;
+      const double e  = eccentricity[ii];
+      const double A  = semiMajorAxis[ii];
+      const double n  = meanMotion[ii];
+
+      double transitTime  = transitBlock[jj];
+      double transmitTime = receiveTime - transitTime;
+
+      // clock polynomial and time from the reference epoch
+      double dt         = weekCrossover(transmitTime - toc[ii]);
+      double dtClkModel = (af2[ii] * dt + af1[ii]) * dt + af0[ii] - tgd[ii];
+      double tk         = weekCrossover(transmitTime - dtClkModel - toe[ii]);
+
+      // Kepler's equation by a fixed number of Newton iterations
+      double M = m0[ii] + n * tk;
+      double sinE, cosE;
+      sinCos(M, sinE, cosE);
+      double E = M + e * sinE;
+      for (unsigned int kk = 0; kk < keplerIterations; ++kk)
+      {
+        sinCos(E, sinE, cosE);
+        E = E - (E - e * sinE - M) / (1.0 - e * cosE);
+      }
+      sinCos(E, sinE, cosE);
+
+      double oneMinusECosE = 1.0 - e * cosE;
+
+      // true anomaly plus the argument of perigee, from its sine and cosine
+      double cosNu  = (cosE - e) / oneMinusECosE;
+      double sinNu  = sqrtOneMinusEccSq[ii] * sinE / oneMinusECosE;
+      double cosPhi = cosNu * cosPerigee[ii] - sinNu * sinPerigee[ii];
+      double sinPhi = sinNu * cosPerigee[ii] + cosNu * sinPerigee[ii];
+      double cos2p  = cosPhi * cosPhi - sinPhi * sinPhi;
+      double sin2p  = 2.0 * sinPhi * cosPhi;
+
+      // corrected argument of latitude, radius, and inclination
+      double du = cuc[ii] * cos2p + cus[ii] * sin2p;
+      double sinDu, cosDu;
+      sinCos(du, sinDu, cosDu);
+      double cosu = cosPhi * cosDu - sinPhi * sinDu;
+      double sinu = sinPhi * cosDu + cosPhi * sinDu;
+
+      double r = A * oneMinusECosE + crc[ii] * cos2p + crs[ii] * sin2p;
+      double i =
+        i0[ii] + inclinationRate[ii] * tk + cic[ii] * cos2p + cis[ii] * sin2p;
+      double sini, cosi;
+      sinCos(i, sini, cosi);
+
+      // angle between ascending node and Greenwich meridian
+      double lonAscNodeDot = lonAscNodeRate[ii];
+      double lonAscNode    = lonAscNode0[ii] + lonAscNodeDot * tk -
+                          gpsEarthRotationRate * transitTime;
+      double sino, coso;
+      sinCos(lonAscNode, sino, coso);
+
+      double xOrbitalPlane = r * cosu;
+      double yOrbitalPlane = r * sinu;
+
+      double px = xOrbitalPlane * coso - yOrbitalPlane * cosi * sino;
+      double py = xOrbitalPlane * sino + yOrbitalPlane * cosi * coso;
+      double pz = yOrbitalPlane * sini;
+
+      // velocity
+      double EDot         = n / oneMinusECosE;
+      double argLatDot    = EDot * sqrtOneMinusEccSq[ii] / oneMinusECosE;
+      double twoArgLatDot = 2.0 * argLatDot;
+
+      double uDot =
+        twoArgLatDot * (cus[ii] * cos2p - cuc[ii] * sin2p) + argLatDot;
+      double rDot = twoArgLatDot * (crs[ii] * cos2p - crc[ii] * sin2p) +
+                    A * e * sinE * EDot;
+      double iDot =
+        twoArgLatDot * (cis[ii] * cos2p - cic[ii] * sin2p) + inclinationRate[ii];
+
+      double vxOrbitalPlane = rDot * cosu - r * sinu * uDot;
+      double vyOrbitalPlane = rDot * sinu + r * cosu * uDot;
+
+      double velX = vxOrbitalPlane * coso - vyOrbitalPlane * cosi * sino +
+                    yOrbitalPlane * sini * sino * iDot - py * lonAscNodeDot;
+      double velY = vxOrbitalPlane * sino + vyOrbitalPlane * cosi * coso -
+                    yOrbitalPlane * sini * coso * iDot + px * lonAscNodeDot;
+      double velZ = vyOrbitalPlane * sini + yOrbitalPlane * cosi * iDot;
+
+      double clockCorrection = dtClkModel + eFsqrtA[ii] * sinE;
+
+      // states that cannot be computed are zeroed, as in the scalar path
+      double isValid = validScale[ii];
+
+      x[jj]     = isValid * px;
+      y[jj]     = isValid * py;
+      z[jj]     = isValid * pz;
+      vx[jj]    = isValid * velX;
+      vy[jj]    = isValid * velY;
+      vz[jj]    = isValid * velZ;
+      clock[jj] = isValid * clockCorrection;
+    }
+
+    for (size_t jj = 0; jj < count; ++jj)
+    {
+      valid[jj] = (validScale[start + jj] != 0.0) ? 1 : 0;
+    }
+
+    std::memcpy(states.x.data() + start, x, count * sizeof(double));
+    std::memcpy(states.y.data() + start, y, count * sizeof(double));
+    std::memcpy(states.z.data() + start, z, count * sizeof(double));
+    std::memcpy(states.vx.data() + start, vx, count * sizeof(double));
+    std::memcpy(states.vy.data() + start, vy, count * sizeof(double));
+    std::memcpy(states.vz.data() + start, vz, count * sizeof(double));
+    std::memcpy(
+      states.clockCorrection.data() + start, clock, count * sizeof(double));
+    std::memcpy(states.valid.data() + start, valid, count * sizeof(uint8_t));
+  }
+}
+
+}  // namespace pnt_integrity
@@ -114,6 +114,9 @@ bool PositionVelocityConsistencyCheck::posVelCheck(
 
   PosVelConsCheckDiagnostics checkData;
 
+  measuredPositions_.clear();
+  propagatedPositions_.clear();
+
   for (auto it = timeEntryVec.begin(); it != (timeEntryVec.end() - 1); ++it)
   {
     it->localData_.getData(firstPv);
@@ -136,18 +139,28 @@ bool PositionVelocityConsistencyCheck::posVelCheck(
                                 pow(firstPv.covariance[4][4], 2) +
                                 pow(firstPv.covariance[5][5], 2));
 
-      double error  = calculateDistance(secondPos, firstPosPropd);
-      double thresh = errorThreshScaleFactor_ * sqrt(firstVelVar);
-      checkData.errorVals.push_back(error);
-      checkData.errorThresh.push_back(thresh);
-      std::stringstream msg;
-      msg << "Pos-Vel Consistency Check: error: " << error
-          << " (m), thresh: " << thresh;
-      logMsg_(msg.str(), logutils::LogLevel::Debug);
-      if (!checkDistance(error, thresh))
-      {
-        ++percentConfident;
-      }
+      measuredPositions_.push_back(secondPos);
+      propagatedPositions_.push_back(firstPosPropd);
+      checkData.errorThresh.push_back(errorThreshScaleFactor_ *
+                                      sqrt(firstVelVar));
+    }
+  }
+
+  // compute the error of every examined pair in a single batch
+  calculateDistances(measuredPositions_, propagatedPositions_, pairErrors_);
+
+  for (size_t ii = 0; ii < pairErrors_.size(); ++ii)
+  {
+    double error  = pairErrors_[ii];
+    double thresh = checkData.errorThresh[ii];
+    checkData.errorVals.push_back(error);
+    std::stringstream msg;
+    msg << "Pos-Vel Consistency Check: error: " << error
+        << " (m), thresh: " << thresh;
+    logMsg_(msg.str(), logutils::LogLevel::Debug);
+    if (!checkDistance(error, thresh))
+    {
+      ++percentConfident;
     }
   }
 
@@ -0,0 +1,653 @@
+//============================================================================//
+//--------- pnt_integrity/PseudorangeResidualCheck.cpp ---------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//----------------------------------------------------------------------------//
+//
+// Assurance check on the residuals of a pseudorange solution
+// October 16, 2026
+//============================================================================//
+#include "pnt_integrity/PseudorangeResidualCheck.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "pnt_integrity/GPSNavDataCommon.hpp"
+
+using namespace pnt_integrity;
+
+constexpr int PseudorangeResidualCheck::maxSatellites;
+
+namespace
+{
+// The number of unknowns in the solution (ECEF position and clock bias)
+const int numStates = 4;
+
+// The smallest number of satellites for which the residuals are tested
+const int minTestSatellites = numStates + 1;
+
+// The largest number of Gauss-Newton iterations, and the position update
+// below which the solution is considered converged (m). Starting from the
+// center of the Earth the solution converges in about six iterations.
+const int    maxSolutionIterations = 10;
+const double convergenceThreshold  = 1e-3;
+
+// Ephemerides further than this from their reference time are not used (s)
+const double maxEphemerisAge = 14400.0;
+
+const double secondsInWeek = 604800.0;
+
+// Regularized upper incomplete gamma function Q(a, x), evaluated with its
+// series expansion for x < a + 1 and its continued fraction otherwise
+double upperIncompleteGammaRatio(const double& a, const double& x)
+{
+  if (x <= 0.0)
+  {
+    return 1.0;
+  }
+
+  const double logPrefix = -x + a * std::log(x) - std::lgamma(a);
+  const double eps       = 1e-15;
+  const double tiny      = 1e-300;
+  if (x < a + 1.0)
+  {
+    double term = 1.0 / a;
+    double sum  = term;
+    for (int n = 1; n < 1000; ++n)
+    {
+      term *= x / (a + n);
+      sum += term;
+      if (std::fabs(term) < std::fabs(sum) * eps)
+      {
+        break;
+      }
+    }
+    return 1.0 - sum * std::exp(logPrefix);
+  }
+
+  // modified Lentz's method
+  double b = x + 1.0 - a;
+  double c = 1.0 / tiny;
+  double d = 1.0 / b;
+  double h = d;
+  for (int n = 1; n < 1000; ++n)
+  {
+    double an = -n * (n - a);
+    b += 2.0;
+    d = an * d + b;
+    d = (std::fabs(d) < tiny) ? tiny : d;
+    c = b + an / c;
+    c = (std::fabs(c) < tiny) ? tiny : c;
+    d           = 1.0 / d;
+    double step = d * c;
+    h *= step;
+    if (std::fabs(step - 1.0) < eps)
+    {
+      break;
+    }
+  }
+  return std::exp(logPrefix) * h;
+}
+
+// Returns the value a chi-square variable with the provided degrees of
+// freedom exceeds with the provided probability
+double chiSquareThreshold(const int& dof, const double& probability)
+{
+  const double a = 0.5 * dof;
+
+  double low  = 0.0;
+  double high = dof + 10.0;
+  while (upperIncompleteGammaRatio(a, 0.5 * high) > probability)
+  {
+    low = high;
+    high *= 2.0;
+  }
+
+  for (int ii = 0; ii < 100; ++ii)
+  {
+    double mid = 0.5 * (low + high);
+    if (upperIncompleteGammaRatio(a, 0.5 * mid) > probability)
+    {
+      low = mid;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  return 0.5 * (low + high);
+}
+}  // namespace
+
+//==============================================================================
+//------------------------------- Constructor ----------------------------------
+//==============================================================================
+PseudorangeResidualCheck::PseudorangeResidualCheck(
+  const std::string&           name,
+  const double&                falseAlarmProbability,
+  const double&                defaultPseudorangeSigma,
+  const int&                   maxExclusions,
+  const logutils::LogCallback& log)
+  : AssuranceCheck::AssuranceCheck(true, name, log)
+  , falseAlarmProbability_(falseAlarmProbability)
+  , defaultPseudorangeSigma_(defaultPseudorangeSigma)
+  , maxExclusions_(maxExclusions)
+  , hasEpoch_(false)
+  , epochTime_(0.0)
+  , checkTime_(0.0)
+  , numSatellites_(0)
+  , solution_(Eigen::Vector4d::Zero())
+  , solutionValid_(false)
+  , lastFaultState_(0)
+{
+  setFalseAlarmProbability(falseAlarmProbability);
+
+  // sized once so that publishing diagnostics does not allocate
+  diagnostics_.excludedPrns.reserve(maxSatellites);
+  diagnostics_.residuals.reserve(maxSatellites);
+
+  std::stringstream initMsg;
+  initMsg << "Initializing Pseudorange Residual Check (" << name
+          << ") with parameters: " << std::endl;
+  initMsg << "false alarm probability: " << falseAlarmProbability
+          << std::endl;
+  initMsg << "default pseudorange sigma (m): " << defaultPseudorangeSigma
+          << std::endl;
+  initMsg << "max exclusions: " << maxExclusions;
+  logMsg_(initMsg.str(), logutils::LogLevel::Info);
+}
+
+//==============================================================================
+//------------------------ setFalseAlarmProbability ----------------------------
+//==============================================================================
+void PseudorangeResidualCheck::setFalseAlarmProbability(
+  const double& falseAlarmProbability)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+  falseAlarmProbability_ = falseAlarmProbability;
+
+  chiSquareThresholds_[0] = 0.0;
+  for (size_t dof = 1; dof < chiSquareThresholds_.size(); ++dof)
+  {
+    chiSquareThresholds_[dof] =
+      chiSquareThreshold((int)dof, falseAlarmProbability);
+  }
+}
+
+//==============================================================================
+//--------------------------- handleGnssSubframe -------------------------------
+//==============================================================================
+bool PseudorangeResidualCheck::handleGnssSubframe(
+  const data::GNSSSubframe& gnssSubframe)
+{
+  // only LNAV subframes carry the ephemeris
+  if ((gnssSubframe.subframeData.size() != 30) ||
+      (gnssSubframe.subframeData[0] != 0x8B))
+  {
+    return false;
+  }
+
+  uint8_t subframeBytes[30];
+  std::copy(gnssSubframe.subframeData.begin(),
+            gnssSubframe.subframeData.end(),
+            subframeBytes);
+
+  uint16_t subframeId = parseSubframeID(subframeBytes);
+  if ((subframeId < 1) || (subframeId > 3))
+  {
+    return false;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  const int          prn   = gnssSubframe.prn;
+  const int          idx   = subframeId - 1;
+  PrnEphemerisState& state = prnEphemerides_[prn];
+  if (!state.ephemeris.setSubframe(gnssSubframe.prn, subframeBytes))
+  {
+    state.hasSubframe[idx] = false;
+    return false;
+  }
+
+  // the subframes belong to one ephemeris when the IODEs match the 8 LSBs of
+  // the IODC
+  state.hasSubframe[idx] = true;
+  if (subframeId == 1)
+  {
+    state.issue[idx] = extractNavRaw(subframeBytes, lnav::sf1::iodc) & 0xFF;
+  }
+  else
+  {
+    state.issue[idx] = extractNavRaw(
+      subframeBytes, (subframeId == 2) ? lnav::sf2::iode : lnav::sf3::iode);
+  }
+
+  if (state.hasSubframe[0] && state.hasSubframe[1] && state.hasSubframe[2] &&
+      (state.issue[0] == state.issue[1]) &&
+      (state.issue[0] == state.issue[2]) &&
+      (state.issue[0] != state.cachedIssue))
+  {
+    cacheEphemeris(prn, state);
+  }
+  return true;
+}
+
+//==============================================================================
+//------------------------------ setEphemeris ----------------------------------
+//==============================================================================
+void PseudorangeResidualCheck::setEphemeris(const GpsEphemeris& ephemeris)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  const int          prn   = ephemeris.getPrn();
+  PrnEphemerisState& state = prnEphemerides_[prn];
+  state.ephemeris          = ephemeris;
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    state.hasSubframe[ii] = true;
+    state.issue[ii]       = ephemeris.getIode();
+  }
+  cacheEphemeris(prn, state);
+}
+
+//==============================================================================
+//----------------------------- cacheEphemeris ---------------------------------
+//==============================================================================
+void PseudorangeResidualCheck::cacheEphemeris(const int&         prn,
+                                              PrnEphemerisState& state)
+{
+  if (state.ephemeris.isSvHealthy())
+  {
+    svStateCache_.setEphemeris(state.ephemeris);
+    state.cachedIssue = state.issue[0];
+  }
+  else
+  {
+    svStateCache_.removePrn((uint16_t)prn);
+    state.cachedIssue = -1;
+  }
+}
+
+//==============================================================================
+//------------------------ handleGnssObservables -------------------------------
+//==============================================================================
+bool PseudorangeResidualCheck::handleGnssObservables(
+  const data::GNSSObservables& gnssObs,
+  const double&                time)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  checkTime_ = time;
+  loadEpoch(gnssObs);
+  return runCheck();
+}
+
+//==============================================================================
+//------------------------------- loadEpoch ------------------------------------
+//==============================================================================
+void PseudorangeResidualCheck::loadEpoch(const data::GNSSObservables& gnssObs)
+{
+  hasEpoch_      = true;
+  epochTime_     = gnssObs.gnssTime.secondsOfWeek;
+  numSatellites_ = 0;
+
+  for (auto prnIt = prnAssuranceLevels_.begin();
+       prnIt != prnAssuranceLevels_.end();
+       ++prnIt)
+  {
+    prnIt->second = data::AssuranceLevel::Unavailable;
+  }
+
+  for (auto obsIt = gnssObs.observables.begin();
+       obsIt != gnssObs.observables.end();
+       ++obsIt)
+  {
+    const data::GNSSObservable& obs = obsIt->second;
+    if (obs.satelliteType != data::SatelliteSystem::GPS)
+    {
+      continue;
+    }
+    prnAssuranceLevels_[obs.prn] = data::AssuranceLevel::Unavailable;
+
+    // the broadcast clock correction includes the L1 group delay
+    if ((obs.frequencyType != data::FrequencyBand::Band1) ||
+        (!obs.pseudorangeValid) || (!std::isfinite(obs.pseudorange)) ||
+        (numSatellites_ == maxSatellites))
+    {
+      continue;
+    }
+
+    // use one observable per satellite
+    if (std::find(prns_.begin(), prns_.begin() + numSatellites_, obs.prn) !=
+        prns_.begin() + numSatellites_)
+    {
+      continue;
+    }
+
+    auto ephIt = prnEphemerides_.find(obs.prn);
+    if ((ephIt == prnEphemerides_.end()) || (ephIt->second.cachedIssue < 0))
+    {
+      continue;
+    }
+
+    double age = epochTime_ - ephIt->second.ephemeris.getTimeOfEphemeris();
+    age -= secondsInWeek * std::round(age / secondsInWeek);
+    if (std::fabs(age) > maxEphemerisAge)
+    {
+      continue;
+    }
+
+    double px, py, pz, vx, vy, vz, clockCorrection;
+    if (!svStateCache_.getSvState(obs.prn,
+                                  epochTime_,
+                                  px,
+                                  py,
+                                  pz,
+                                  vx,
+                                  vy,
+                                  vz,
+                                  clockCorrection,
+                                  obs.pseudorange))
+    {
+      continue;
+    }
+
+    const int idx               = numSatellites_++;
+    prns_[idx]                  = obs.prn;
+    satellitePositions_(idx, 0) = px;
+    satellitePositions_(idx, 1) = py;
+    satellitePositions_(idx, 2) = pz;
+    correctedPseudoranges_(idx) =
+      obs.pseudorange + speedOfLight * clockCorrection;
+
+    bool hasVariance = (obs.pseudorangeVariance > 0.0) &&
+                       std::isfinite(obs.pseudorangeVariance);
+    variances_(idx)  = hasVariance
+                        ? obs.pseudorangeVariance
+                        : defaultPseudorangeSigma_ * defaultPseudorangeSigma_;
+  }
+}
+
+//==============================================================================
+//-------------------------------- runCheck ------------------------------------
+//==============================================================================
+bool PseudorangeResidualCheck::runCheck()
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  if (!hasEpoch_)
+  {
+    return false;
+  }
+
+  std::fill(inUse_.begin(), inUse_.begin() + numSatellites_, true);
+
+  int    numUsed       = numSatellites_;
+  int    numExcluded   = 0;
+  bool   evaluated     = false;
+  bool   passed        = false;
+  double testStatistic = 0.0;
+  double threshold     = 0.0;
+  while ((numUsed >= minTestSatellites) && solve())
+  {
+    evaluated     = true;
+    testStatistic = 0.0;
+    for (int ii = 0; ii < numSatellites_; ++ii)
+    {
+      if (inUse_[ii])
+      {
+        testStatistic += residuals_(ii) * residuals_(ii) / variances_(ii);
+      }
+    }
+    threshold = chiSquareThresholds_[numUsed - numStates];
+
+    if (testStatistic <= threshold)
+    {
+      passed = true;
+      break;
+    }
+
+    // exclude the satellite most likely to be faulted and try again
+    if ((numExcluded >= maxExclusions_) ||
+        (numUsed - 1 < minTestSatellites))
+    {
+      break;
+    }
+    int worst = findLargestNormalizedResidual();
+    if (worst < 0)
+    {
+      break;
+    }
+    inUse_[worst] = false;
+    --numUsed;
+    ++numExcluded;
+  }
+
+  // determine the satellite and check assurance levels
+  data::AssuranceLevel checkLevel = data::AssuranceLevel::Unavailable;
+  if (evaluated)
+  {
+    if (passed)
+    {
+      checkLevel = (numExcluded > 0) ? data::AssuranceLevel::Inconsistent
+                                     : data::AssuranceLevel::Assured;
+    }
+    else
+    {
+      checkLevel = data::AssuranceLevel::Unassured;
+    }
+
+    for (int ii = 0; ii < numSatellites_; ++ii)
+    {
+      if (!inUse_[ii])
+      {
+        prnAssuranceLevels_[prns_[ii]] = data::AssuranceLevel::Unassured;
+      }
+      else
+      {
+        prnAssuranceLevels_[prns_[ii]] = passed
+                                           ? data::AssuranceLevel::Assured
+                                           : data::AssuranceLevel::Inconsistent;
+      }
+    }
+  }
+  changeAssuranceLevel(checkTime_, checkLevel);
+
+  // log changes in the fault state
+  int faultState = evaluated ? (passed ? numExcluded : -1) : -2;
+  if (faultState != lastFaultState_)
+  {
+    std::stringstream faultMsg;
+    faultMsg << checkName_ << ": ";
+    if (faultState == -2)
+    {
+      faultMsg << "fewer than " << minTestSatellites
+               << " satellites available for the residual test";
+    }
+    else if (faultState == -1)
+    {
+      faultMsg << "residual test failed (" << testStatistic << " > "
+               << threshold << ") with " << numUsed << " satellites";
+    }
+    else if (faultState > 0)
+    {
+      faultMsg << "residual test passed after excluding PRN(s)";
+      for (int ii = 0; ii < numSatellites_; ++ii)
+      {
+        if (!inUse_[ii])
+        {
+          faultMsg << " " << prns_[ii];
+        }
+      }
+    }
+    else
+    {
+      faultMsg << "residual test passed with " << numUsed << " satellites";
+    }
+    logMsg_(faultMsg.str(),
+            (faultState == 0) ? logutils::LogLevel::Info
+                              : logutils::LogLevel::Warn);
+    lastFaultState_ = faultState;
+  }
+
+  if (publishDiagnostics_)
+  {
+    diagnostics_.numSatellites   = numSatellites_;
+    diagnostics_.numExcluded     = numExcluded;
+    diagnostics_.testStatistic   = testStatistic;
+    diagnostics_.threshold       = threshold;
+    diagnostics_.positionEcef[0] = solution_(0);
+    diagnostics_.positionEcef[1] = solution_(1);
+    diagnostics_.positionEcef[2] = solution_(2);
+    diagnostics_.clockBias       = solution_(3);
+    diagnostics_.excludedPrns.clear();
+    diagnostics_.residuals.clear();
+    for (int ii = 0; ii < numSatellites_; ++ii)
+    {
+      if (!inUse_[ii])
+      {
+        diagnostics_.excludedPrns.push_back(prns_[ii]);
+      }
+      else if (evaluated)
+      {
+        diagnostics_.residuals.push_back(
+          std::make_pair(prns_[ii], residuals_(ii)));
+      }
+    }
+    publishDiagnostics_(checkTime_, diagnostics_);
+  }
+
+  return evaluated;
+}
+
+//==============================================================================
+//--------------------------------- solve --------------------------------------
+//==============================================================================
+bool PseudorangeResidualCheck::solve()
+{
+  // start from the previous solution, or the center of the Earth
+  if (!solutionValid_)
+  {
+    solution_.setZero();
+  }
+
+  for (int iter = 0; iter < maxSolutionIterations; ++iter)
+  {
+    linearize();
+
+    Eigen::LDLT<Eigen::Matrix4d> ldlt(normalMatrix_);
+    if ((ldlt.info() != Eigen::Success) || (ldlt.rcond() < 1e-12))
+    {
+      // the geometry does not determine the solution
+      break;
+    }
+
+    Eigen::Vector4d update = ldlt.solve(normalVector_);
+    solution_ += update;
+    if (update.head<3>().norm() < convergenceThreshold)
+    {
+      // residuals at the converged solution
+      linearize();
+      solutionValid_ = true;
+      return true;
+    }
+  }
+
+  solutionValid_ = false;
+  return false;
+}
+
+//==============================================================================
+//------------------------------- linearize ------------------------------------
+//==============================================================================
+void PseudorangeResidualCheck::linearize()
+{
+  normalMatrix_.setZero();
+  normalVector_.setZero();
+
+  for (int ii = 0; ii < numSatellites_; ++ii)
+  {
+    Eigen::Vector3d lineOfSight =
+      satellitePositions_.row(ii).transpose() - solution_.head<3>();
+    double range = lineOfSight.norm();
+
+    geometry_.block<1, 3>(ii, 0) = -lineOfSight.transpose() / range;
+    geometry_(ii, 3)             = 1.0;
+    residuals_(ii) = correctedPseudoranges_(ii) - range - solution_(3);
+
+    if (inUse_[ii])
+    {
+      const double weight = 1.0 / variances_(ii);
+      normalMatrix_.noalias() +=
+        weight * geometry_.row(ii).transpose() * geometry_.row(ii);
+      normalVector_.noalias() +=
+        weight * geometry_.row(ii).transpose() * residuals_(ii);
+    }
+  }
+}
+
+//==============================================================================
+//---------------------- findLargestNormalizedResidual -------------------------
+//==============================================================================
+int PseudorangeResidualCheck::findLargestNormalizedResidual()
+{
+  // the residual of satellite i has variance sigma_i^2 - h_i (H'WH)^-1 h_i'
+  const Eigen::Matrix4d covariance = normalMatrix_.inverse();
+
+  int    worst         = -1;
+  double worstResidual = 0.0;
+  for (int ii = 0; ii < numSatellites_; ++ii)
+  {
+    if (!inUse_[ii])
+    {
+      continue;
+    }
+
+    double residualVariance =
+      variances_(ii) -
+      geometry_.row(ii) * covariance * geometry_.row(ii).transpose();
+    if (residualVariance <= 0.0)
+    {
+      // the satellite's residual is not observable
+      continue;
+    }
+
+    double normalized = std::fabs(residuals_(ii)) / std::sqrt(residualVariance);
+    if (normalized > worstResidual)
+    {
+      worst         = ii;
+      worstResidual = normalized;
+    }
+  }
+  return worst;
+}
@@ -114,8 +114,11 @@ void RangePositionCheck::rangePositionCheck(
   localEntry.getData(localPosVel);
   if (localPosVel.isPositionValid() && localPosVel.isPositionCovarianceValid())
   {
-    // go through each remote and compare the differenced position to the
-    // measured range (if available)
+    remotePositions_.clear();
+    remoteEntries_.clear();
+
+    // go through each remote and collect the ones with a valid range and
+    // position
     for (auto remoteIt = remoteEntries.begin(); remoteIt != remoteEntries.end();
          ++remoteIt)
     {
@@ -133,21 +136,8 @@ void RangePositionCheck::rangePositionCheck(
       if (range.rangeValid && remotePosVel.isPositionValid() &&
           remotePosVel.isPositionCovarianceValid())
       {
-        RngPosCheckNodeDiagnostic nodeDiagnosticData;
-        // compare the measured range to the computed range
-        // if function returns true, then range positions and range measurement
-        // appear to be valid
-        if (compareRanges(localPosVel, remotePosVel, range, nodeDiagnosticData))
-        {
-          // range measurement checks out
-          rangeCheckLevels_[remoteIt->first] = data::AssuranceLevel::Assured;
-        }
-        else
-        {
-          // range measurement does not check out
-          rangeCheckLevels_[remoteIt->first] = data::AssuranceLevel::Unassured;
-        }
-        diagnostics[remoteIt->first] = nodeDiagnosticData;
+        remotePositions_.push_back(remotePosVel.position);
+        remoteEntries_.push_back(remoteIt);
       }
       else
       {
@@ -157,6 +147,43 @@ void RangePositionCheck::rangePositionCheck(
           logutils::LogLevel::Debug);
       }
     }
+
+    // compute the distance from the local node to every remote in a single
+    // batch
+    EcefReference localPosition(localPosVel.position);
+    localPosition.distances(remotePositions_, remoteDistances_);
+
+    // compare the differenced position to the measured range for each
+    for (size_t ii = 0; ii < remoteEntries_.size(); ++ii)
+    {
+      auto remoteIt = remoteEntries_[ii];
+
+      data::MeasuredRange range;
+      remoteIt->second.getData(range);
+
+      data::PositionVelocity remotePosVel;
+      remoteIt->second.getData(remotePosVel);
+
+      RngPosCheckNodeDiagnostic nodeDiagnosticData;
+      // compare the measured range to the computed range
+      // if function returns true, then range positions and range measurement
+      // appear to be valid
+      if (compareRanges(localPosVel,
+                        remotePosVel,
+                        remoteDistances_[ii],
+                        range,
+                        nodeDiagnosticData))
+      {
+        // range measurement checks out
+        rangeCheckLevels_[remoteIt->first] = data::AssuranceLevel::Assured;
+      }
+      else
+      {
+        // range measurement does not check out
+        rangeCheckLevels_[remoteIt->first] = data::AssuranceLevel::Unassured;
+      }
+      diagnostics[remoteIt->first] = nodeDiagnosticData;
+    }
   }
 
   calculateAssuranceLevel(checkTime);
@@ -176,17 +203,16 @@ void RangePositionCheck::rangePositionCheck(
 //==============================================================================
 //------------------------------- compareRanges --------------------------------
 //==============================================================================
-bool RangePositionCheck::compareRanges(const data::PositionVelocity& posVel1,
-                                       const data::PositionVelocity& posVel2,
-                                       const data::MeasuredRange&    measRange,
-                                       RngPosCheckNodeDiagnostic&    diagnostic)
+bool RangePositionCheck::compareRanges(
+  const data::PositionVelocity& posVel1,
+  const data::PositionVelocity& posVel2,
+  const double&                 calculatedRange,
+  const data::MeasuredRange&    measRange,
+  RngPosCheckNodeDiagnostic&    diagnostic)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  // calculate the range based on the 2 positions
-  double calculatedRange =
-    calculateDistance(posVel1.position, posVel2.position);
-
+  // the range based on the 2 positions is calculated by the caller
   if (std::isnan(calculatedRange))
   {
     std::stringstream msg;
@@ -86,11 +86,11 @@ bool StaticPositionCheck::runCheck()
         // if we need to initialize, perform survey
         if (!staticPositionInitialized_)
         {
-          positionsToSurvey_.push_back(pv.position);
+          addSurveyPosition(pv.position);
 
-          if (positionsToSurvey_.size() >= numPositionsForInit_)
+          if (surveyState_.numPositions >= numPositionsForInit_)
           {
-            setStaticPosition(computeSurveyedPosition(positionsToSurvey_));
+            setStaticPosition(computeSurveyedPosition());
           }
         }
         // we are initialized, run check
@@ -113,6 +113,10 @@ void StaticPositionCheck::setStaticPosition(
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
   staticPosition_ = staticPos;
+  staticReference_.setPosition(staticPos);
+
+  // flags in the window were evaluated against the previous position
+  clearWindow();
 
   staticPositionInitialized_ = true;
 
@@ -125,34 +129,181 @@ void StaticPositionCheck::setStaticPosition(
   logMsg_(initMsg.str(), logutils::LogLevel::Info);
 }
 
+//==============================================================================
+//---------------------------- setSurveyNumGroups ------------------------------
+//==============================================================================
+void StaticPositionCheck::setSurveyNumGroups(const size_t& numGroups)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  surveyNumGroups_ = numGroups;
+
+  // restart the survey with the new grouping
+  surveyState_ = StaticPositionSurveyState();
+  if (surveyNumGroups_ > 1)
+  {
+    surveyState_.groupSize =
+      (numPositionsForInit_ + surveyNumGroups_ - 1) / surveyNumGroups_;
+    surveyState_.groupMeans.reserve(surveyNumGroups_);
+  }
+}
+
+//==============================================================================
+//------------------------------ getSurveyState --------------------------------
+//==============================================================================
+StaticPositionSurveyState StaticPositionCheck::getSurveyState()
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+  return surveyState_;
+}
+
+//==============================================================================
+//------------------------------ setSurveyState --------------------------------
+//==============================================================================
+void StaticPositionCheck::setSurveyState(
+  const StaticPositionSurveyState& state)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  surveyState_     = state;
+  surveyNumGroups_ = (state.groupSize > 0)
+                       ? (numPositionsForInit_ + state.groupSize - 1) /
+                           state.groupSize
+                       : 0;
+
+  std::stringstream restoreMsg;
+  restoreMsg << "StaticPositionCheck::setSurveyState(): restored survey with "
+             << state.numPositions << " of " << numPositionsForInit_
+             << " positions";
+  logMsg_(restoreMsg.str(), logutils::LogLevel::Info);
+
+  if ((surveyState_.numPositions >= numPositionsForInit_) &&
+      (surveyState_.numPositions > 0))
+  {
+    setStaticPosition(computeSurveyedPosition());
+  }
+}
+
+//==============================================================================
+//---------------------------- addSurveyPosition -------------------------------
+//==============================================================================
+void StaticPositionCheck::addSurveyPosition(
+  const data::GeodeticPosition3d& position)
+{
+  std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
+
+  double ecef[3];
+  if (!position.getECEF(ecef))
+  {
+    return;
+  }
+
+  // Welford update of the mean and the sum of deviation outer products
+  StaticPositionSurveyState& state = surveyState_;
+  ++state.numPositions;
+
+  double deltaOld[3];
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    deltaOld[ii] = ecef[ii] - state.mean[ii];
+    state.mean[ii] += deltaOld[ii] / state.numPositions;
+  }
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    for (int jj = 0; jj < 3; ++jj)
+    {
+      state.sumSqDev[ii][jj] += deltaOld[ii] * (ecef[jj] - state.mean[jj]);
+    }
+  }
+
+  // running mean of the current median-of-means group
+  if (state.groupSize > 0)
+  {
+    ++state.groupNumPositions;
+    for (int ii = 0; ii < 3; ++ii)
+    {
+      state.groupMean[ii] +=
+        (ecef[ii] - state.groupMean[ii]) / state.groupNumPositions;
+    }
+
+    if (state.groupNumPositions >= state.groupSize)
+    {
+      state.groupMeans.push_back(
+        {{state.groupMean[0], state.groupMean[1], state.groupMean[2]}});
+      state.groupNumPositions = 0;
+      state.groupMean[0]      = 0.0;
+      state.groupMean[1]      = 0.0;
+      state.groupMean[2]      = 0.0;
+    }
+  }
+}
+
 //==============================================================================
 //--------------------------- computeSurveyedPosition---------------------------
 //==============================================================================
-data::GeodeticPosition3d StaticPositionCheck::computeSurveyedPosition(
-  const std::vector<data::GeodeticPosition3d>& positions)
+data::GeodeticPosition3d StaticPositionCheck::computeSurveyedPosition()
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
+  const StaticPositionSurveyState& state = surveyState_;
+
+  double surveyEcef[3] = {state.mean[0], state.mean[1], state.mean[2]};
+
+  // median-of-means, including a partially filled final group
+  std::vector<std::array<double, 3> > groupMeans = state.groupMeans;
+  if (state.groupNumPositions > 0)
+  {
+    groupMeans.push_back(
+      {{state.groupMean[0], state.groupMean[1], state.groupMean[2]}});
+  }
+  if (groupMeans.size() > 1)
+  {
+    std::vector<double> axis(groupMeans.size());
+    for (int ii = 0; ii < 3; ++ii)
+    {
+      for (size_t jj = 0; jj < groupMeans.size(); ++jj)
+      {
+        axis[jj] = groupMeans[jj][ii];
+      }
+
+      size_t mid = axis.size() / 2;
+      std::nth_element(axis.begin(), axis.begin() + mid, axis.end());
+      surveyEcef[ii] = axis[mid];
+      if (axis.size() % 2 == 0)
+      {
+        surveyEcef[ii] =
+          0.5 * (surveyEcef[ii] +
+                 *std::max_element(axis.begin(), axis.begin() + mid));
+      }
+    }
+  }
+
   data::GeodeticPosition3d surveyPos;
-  surveyPos.latitude  = 0.0;
-  surveyPos.longitude = 0.0;
-  surveyPos.altitude  = 0.0;
+  geodeticConverter_.ecef2Geodetic(surveyEcef[0],
+                                   surveyEcef[1],
+                                   surveyEcef[2],
+                                   &surveyPos.latitude,
+                                   &surveyPos.longitude,
+                                   &surveyPos.altitude);
 
   std::stringstream surveyMsg;
   surveyMsg << std::setprecision(10);
-  surveyMsg << "StaticPositionCheck::computeSurveyedPosition() : averaging ";
-
-  for (auto posIt = positions.begin(); posIt != positions.end(); ++posIt)
+  surveyMsg << "StaticPositionCheck::computeSurveyedPosition() : surveyed "
+            << state.numPositions << " positions";
+  if (groupMeans.size() > 1)
+  {
+    surveyMsg << " (median of " << groupMeans.size() << " group means)";
+  }
+  if (state.numPositions > 1)
   {
     surveyMsg << std::endl
-              << "lat: " << posIt->latitude << ", lon: " << posIt->longitude
-              << ", alt: " << posIt->altitude;
-    surveyPos = addTwoPositions(surveyPos, *posIt);
+              << "ECEF std dev (m): x: "
+              << sqrt(state.sumSqDev[0][0] / (state.numPositions - 1))
+              << ", y: "
+              << sqrt(state.sumSqDev[1][1] / (state.numPositions - 1))
+              << ", z: "
+              << sqrt(state.sumSqDev[2][2] / (state.numPositions - 1));
   }
-  surveyPos.latitude  = surveyPos.latitude / positions.size();
-  surveyPos.longitude = surveyPos.longitude / positions.size();
-  surveyPos.altitude  = surveyPos.altitude / positions.size();
-
   surveyMsg << std::endl
             << "Surveyed position: lat: " << surveyPos.latitude
             << ", long:" << surveyPos.longitude
@@ -174,14 +325,11 @@ void StaticPositionCheck::posHistoryCheck(TimeEntry& timeEntry)
   timeEntry.localData_.getData(pv);
   if (pv.isPositionValid())
   {
-    positionsToCheck_.push_back(pv.position);
+    pushWindowFlag(staticReference_.distance(pv.position) <= posChangeThresh_);
 
-    if (positionsToCheck_.size() >= checkWindowSize_)
+    if (windowCount_ >= checkWindowSize_)
     {
-      double percentNearStart =
-        percentNearPos(staticPosition_,
-                       {positionsToCheck_.begin(), positionsToCheck_.end()},
-                       posChangeThresh_);
+      double percentNearStart    = (double)windowNumNear_ / windowCount_;
       double percentNotNearStart = 1 - percentNearStart;
 
       if (percentNotNearStart >= assuranceUnassuredThresh_)
@@ -218,67 +366,51 @@ void StaticPositionCheck::posHistoryCheck(TimeEntry& timeEntry)
                            data::AssuranceLevel::Unavailable);
     }
   }
-  if (positionsToCheck_.size() > checkWindowSize_)
-  {
-    positionsToCheck_.pop_front();
-  }
 }
 
 //==============================================================================
-//-------------------------------- addTwoPositions -----------------------------
+//------------------------------ pushWindowFlag --------------------------------
 //==============================================================================
-
-data::GeodeticPosition3d StaticPositionCheck::addTwoPositions(
-  data::GeodeticPosition3d a,
-  data::GeodeticPosition3d b)
+void StaticPositionCheck::pushWindowFlag(const bool& nearStatic)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  data::GeodeticPosition3d retPos;
-  retPos.latitude  = a.latitude + b.latitude;
-  retPos.longitude = a.longitude + b.longitude;
-  retPos.altitude  = a.altitude + b.altitude;
-  return retPos;
+  // the window holds one sample beyond checkWindowSize_ once full
+  if (windowCount_ == windowFlags_.size())
+  {
+    windowNumNear_ -= windowFlags_[windowHead_];
+    windowHead_ = (windowHead_ + 1) % windowFlags_.size();
+    --windowCount_;
+  }
+
+  size_t tail        = (windowHead_ + windowCount_) % windowFlags_.size();
+  windowFlags_[tail] = nearStatic ? 1 : 0;
+  windowNumNear_ += windowFlags_[tail];
+  ++windowCount_;
 }
 
 //==============================================================================
-//---------------------------- isWithinThreshold -------------------------------
+//-------------------------------- clearWindow ---------------------------------
 //==============================================================================
-bool StaticPositionCheck::isWithinThreshold(data::GeodeticPosition3d p,
-                                            data::GeodeticPosition3d mean,
-                                            double                   thresh)
+void StaticPositionCheck::clearWindow()
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  double pEcef[3];
-  p.getECEF(pEcef);
-  double meanEcef[3];
-  mean.getECEF(meanEcef);
-  double dist =
-    sqrt(pow(pEcef[0] - meanEcef[0], 2.0) + pow(pEcef[1] - meanEcef[1], 2.0) +
-         pow(pEcef[2] - meanEcef[2], 2.0));
-  return dist <= thresh;
+  windowHead_    = 0;
+  windowCount_   = 0;
+  windowNumNear_ = 0;
 }
 
 //==============================================================================
-//------------------------------ percentNearPos --------------------------------
+//---------------------------- isWithinThreshold -------------------------------
 //==============================================================================
-double StaticPositionCheck::percentNearPos(
-  const data::GeodeticPosition3d&              center,
-  const std::vector<data::GeodeticPosition3d>& positions,
-  double                                       thresh)
+bool StaticPositionCheck::isWithinThreshold(data::GeodeticPosition3d p,
+                                            data::GeodeticPosition3d mean,
+                                            double                   thresh)
 {
   std::lock_guard<std::recursive_mutex> lock(assuranceCheckMutex_);
 
-  double percent = 0.0;
-  for (auto it = positions.begin(); it != positions.end(); ++it)
-  {
-    if (isWithinThreshold(*it, center, thresh))
-    {
-      percent += 1.0;
-    }
-  }
-  percent = percent / positions.size();
-  return percent;
+  return calculateDistance(p, mean) <= thresh;
 }
+
 }  // namespace pnt_integrity
@@ -0,0 +1,245 @@
+//============================================================================//
+//--------------- pnt_integrity/SvStateCache.cpp ---------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Interpolating cache of satellite position, velocity, and clock
+// October 16, 2026
+//============================================================================//
+#include "pnt_integrity/SvStateCache.hpp"
+
+#include <cmath>
+
+namespace pnt_integrity
+{
+//-----------------------------------------------------------------------------
+SvStateCache::SvStateCache(const double& knotSpacing)
+  : knotSpacing_(knotSpacing), numKnotEvaluations_(0), numInterpolations_(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+void SvStateCache::setKnotSpacing(const double& knotSpacing)
+{
+  knotSpacing_ = knotSpacing;
+  for (auto& prnEntry : prns_)
+  {
+    prnEntry.second.knotsValid = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void SvStateCache::setEphemeris(const GpsEphemeris& ephemeris)
+{
+  PrnEntry& entry = prns_[ephemeris.getPrn()];
+
+  bool sameEphemeris =
+    entry.hasEphemeris && (entry.ephemeris.getIode() == ephemeris.getIode()) &&
+    (entry.ephemeris.getTimeOfEphemeris() == ephemeris.getTimeOfEphemeris());
+
+  if (!sameEphemeris)
+  {
+    entry.ephemeris    = ephemeris;
+    entry.hasEphemeris = true;
+    entry.knotsValid   = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void SvStateCache::setAlmanac(const GpsAlmanac& almanac)
+{
+  PrnEntry& entry = prns_[(uint16_t)almanac.getPrn()];
+
+  // an ephemeris always takes precedence over the almanac
+  if (entry.hasEphemeris)
+  {
+    return;
+  }
+
+  bool sameAlmanac =
+    entry.hasAlmanac &&
+    (entry.almanac.getReferenceWeek() == almanac.getReferenceWeek()) &&
+    (entry.almanac.getTimeOfAlmanac() == almanac.getTimeOfAlmanac());
+
+  if (!sameAlmanac)
+  {
+    entry.almanac    = almanac;
+    entry.hasAlmanac = true;
+    entry.knotsValid = false;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void SvStateCache::removePrn(const uint16_t& prn)
+{
+  prns_.erase(prn);
+}
+
+//-----------------------------------------------------------------------------
+bool SvStateCache::getSvState(const uint16_t& prn,
+                              const double&   receiveTime,
+                              double&         positionEcefX,
+                              double&         positionEcefY,
+                              double&         positionEcefZ,
+                              double&         velocityEcefX,
+                              double&         velocityEcefY,
+                              double&         velocityEcefZ,
+                              double&         svClockCorrection,
+                              const double&   pseudorange)
+{
+  auto entryIt = prns_.find(prn);
+  if (entryIt == prns_.end())
+  {
+    return false;
+  }
+  PrnEntry& entry = entryIt->second;
+
+  double transitTime  = pseudorange / speedOfLight;
+  double transmitTime = receiveTime - transitTime;
+
+  long index = (long)floor(transmitTime / knotSpacing_);
+  if (!updateKnots(entry, index))
+  {
+    return false;
+  }
+
+  // cubic Hermite basis functions and their derivatives on [0, 1]
+  double s   = (transmitTime - index * knotSpacing_) / knotSpacing_;
+  double s2  = s * s;
+  double s3  = s2 * s;
+  double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  double h10 = (s3 - 2.0 * s2 + s) * knotSpacing_;
+  double h01 = -2.0 * s3 + 3.0 * s2;
+  double h11 = (s3 - s2) * knotSpacing_;
+  double d00 = (6.0 * s2 - 6.0 * s) / knotSpacing_;
+  double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+  double d01 = (-6.0 * s2 + 6.0 * s) / knotSpacing_;
+  double d11 = 3.0 * s2 - 2.0 * s;
+
+  const SvKnot& k0 = entry.knots[0];
+  const SvKnot& k1 = entry.knots[1];
+
+  double pos[3];
+  double vel[3];
+  for (size_t ii = 0; ii < 3; ++ii)
+  {
+    pos[ii] = h00 * k0.position[ii] + h10 * k0.velocity[ii] +
+              h01 * k1.position[ii] + h11 * k1.velocity[ii];
+    vel[ii] = d00 * k0.position[ii] + d10 * k0.velocity[ii] +
+              d01 * k1.position[ii] + d11 * k1.velocity[ii];
+  }
+
+  svClockCorrection =
+    (1.0 - s) * k0.clockCorrection + s * k1.clockCorrection;
+
+  // rotate from the ECEF frame at transmit time to the frame at receive time
+  // (the angle is a few microradians, where these series are exact to
+  // double precision)
+  double theta    = gpsEarthRotationRate * transitTime;
+  double theta2   = theta * theta;
+  double cosTheta = 1.0 - 0.5 * theta2;
+  double sinTheta = theta * (1.0 - theta2 / 6.0);
+
+  positionEcefX = pos[0] * cosTheta + pos[1] * sinTheta;
+  positionEcefY = -pos[0] * sinTheta + pos[1] * cosTheta;
+  positionEcefZ = pos[2];
+  velocityEcefX = vel[0] * cosTheta + vel[1] * sinTheta;
+  velocityEcefY = -vel[0] * sinTheta + vel[1] * cosTheta;
+  velocityEcefZ = vel[2];
+
+  ++numInterpolations_;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SvStateCache::evaluateKnot(const PrnEntry& entry,
+                                const long&     index,
+                                SvKnot&         knot)
+{
+  ++numKnotEvaluations_;
+
+  double knotTime = index * knotSpacing_;
+  if (entry.hasEphemeris)
+  {
+    return entry.ephemeris.getSvState(knotTime,
+                                      knot.position[0],
+                                      knot.position[1],
+                                      knot.position[2],
+                                      knot.velocity[0],
+                                      knot.velocity[1],
+                                      knot.velocity[2],
+                                      knot.clockCorrection);
+  }
+
+  entry.almanac.getSvState(knotTime,
+                           knot.position[0],
+                           knot.position[1],
+                           knot.position[2],
+                           knot.velocity[0],
+                           knot.velocity[1],
+                           knot.velocity[2],
+                           knot.clockCorrection);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SvStateCache::updateKnots(PrnEntry& entry, const long& index)
+{
+  if (entry.knotsValid && (index == entry.knotIndex))
+  {
+    return true;
+  }
+
+  // reuse the shared knot when stepping to an adjacent interval
+  bool valid = true;
+  if (entry.knotsValid && (index == entry.knotIndex + 1))
+  {
+    entry.knots[0] = entry.knots[1];
+    valid          = evaluateKnot(entry, index + 1, entry.knots[1]);
+  }
+  else if (entry.knotsValid && (index == entry.knotIndex - 1))
+  {
+    entry.knots[1] = entry.knots[0];
+    valid          = evaluateKnot(entry, index, entry.knots[0]);
+  }
+  else
+  {
+    valid = evaluateKnot(entry, index, entry.knots[0]) &&
+            evaluateKnot(entry, index + 1, entry.knots[1]);
+  }
+
+  entry.knotIndex  = index;
+  entry.knotsValid = valid;
+  return valid;
+}
+
+}  // namespace pnt_integrity
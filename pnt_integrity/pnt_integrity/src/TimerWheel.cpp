@@ -0,0 +1,267 @@
+//============================================================================//
+//---------------- pnt_integrity/TimerWheel.cpp ----------------*- C++ -*-----//
+//============================================================================//
+// BSD 3-Clause License
+//
+// Copyright (C) 2026 Integrated Solutions for Systems, Inc
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software without
+// specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------//
+//
+// Hashed timer wheel for time-based check expiry
+// October 16, 2026
+//============================================================================//
+
+#include "pnt_integrity/TimerWheel.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace pnt_integrity
+{
+//==============================================================================
+//-------------------------- Constructor / Destructor --------------------------
+//==============================================================================
+TimerWheel::TimerWheel(const double& tickPeriod, const size_t& numSlots)
+  : startTime_(Clock::now())
+  , tickPeriod_(tickPeriod > 0 ? tickPeriod : 0.1)
+  , slots_(std::max(numSlots, (size_t)1))
+  , lastTick_(0)
+  , nextId_(1)
+  , runningId_(0)
+  , stopDrive_(false)
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+  stop();
+}
+
+//==============================================================================
+//------------------------------- currentTick ----------------------------------
+//==============================================================================
+uint64_t TimerWheel::currentTick() const
+{
+  const double elapsed =
+    std::chrono::duration<double>(Clock::now() - startTime_).count();
+  return (uint64_t)(elapsed / tickPeriod_);
+}
+
+//==============================================================================
+//--------------------------------- schedule -----------------------------------
+//==============================================================================
+TimerWheel::TimerId TimerWheel::schedule(const double&         delay,
+                                         std::function<void()> callback)
+{
+  // round the delay up to whole ticks so a timer never fires early
+  const double   ticks    = std::ceil(std::max(delay, 0.0) / tickPeriod_);
+  const uint64_t numTicks = std::max((uint64_t)ticks, (uint64_t)1);
+
+  std::lock_guard<std::mutex> lock(wheelMutex_);
+
+  Timer timer;
+  timer.id         = nextId_++;
+  timer.expiryTick = std::max(currentTick(), lastTick_) + numTicks;
+  timer.callback   = std::move(callback);
+
+  pendingTicks_[timer.id] = timer.expiryTick;
+  slots_[timer.expiryTick % slots_.size()].push_back(std::move(timer));
+
+  return nextId_ - 1;
+}
+
+//==============================================================================
+//---------------------------------- cancel ------------------------------------
+//==============================================================================
+bool TimerWheel::cancel(const TimerId& id)
+{
+  std::unique_lock<std::mutex> lock(wheelMutex_);
+
+  auto pendingIt = pendingTicks_.find(id);
+  if (pendingIt != pendingTicks_.end())
+  {
+    std::vector<Timer>& slot = slots_[pendingIt->second % slots_.size()];
+    pendingTicks_.erase(pendingIt);
+
+    auto timerIt = std::find_if(slot.begin(), slot.end(), [&](const Timer& t) {
+      return t.id == id;
+    });
+    if (timerIt != slot.end())
+    {
+      std::swap(*timerIt, slot.back());
+      slot.pop_back();
+      return true;
+    }
+  }
+
+  auto firingIt = std::find_if(firing_.begin(), firing_.end(),
+                               [&](const Timer& t) { return t.id == id; });
+  if (firingIt != firing_.end())
+  {
+    firing_.erase(firingIt);
+    return true;
+  }
+
+  // wait for a running callback to finish, unless it is cancelling itself
+  if (runningThread_ != std::this_thread::get_id())
+  {
+    callbackDone_.wait(lock, [&] { return runningId_ != id; });
+  }
+  return false;
+}
+
+//==============================================================================
+//--------------------------------- advance ------------------------------------
+//==============================================================================
+size_t TimerWheel::advance()
+{
+  std::lock_guard<std::mutex>  advanceLock(advanceMutex_);
+  std::unique_lock<std::mutex> lock(wheelMutex_);
+
+  const uint64_t now = currentTick();
+  if (now > lastTick_)
+  {
+    // visit each slot between the last tick and now, or every slot once if
+    // the wheel has not been advanced for a full revolution
+    const uint64_t numTicks = std::min(now - lastTick_, (uint64_t)slots_.size());
+    for (uint64_t tick = now - numTicks + 1; tick <= now; ++tick)
+    {
+      std::vector<Timer>& slot = slots_[tick % slots_.size()];
+      for (size_t i = 0; i < slot.size();)
+      {
+        if (slot[i].expiryTick <= now)
+        {
+          pendingTicks_.erase(slot[i].id);
+          firing_.push_back(std::move(slot[i]));
+          std::swap(slot[i], slot.back());
+          slot.pop_back();
+        }
+        else
+        {
+          ++i;
+        }
+      }
+    }
+    lastTick_ = now;
+
+    // run in order of expiry, popping from the back
+    std::sort(firing_.begin(), firing_.end(),
+              [](const Timer& a, const Timer& b) {
+                return a.expiryTick > b.expiryTick;
+              });
+  }
+
+  size_t numFired = 0;
+  while (!firing_.empty())
+  {
+    Timer timer = std::move(firing_.back());
+    firing_.pop_back();
+
+    runningId_     = timer.id;
+    runningThread_ = std::this_thread::get_id();
+    lock.unlock();
+
+    timer.callback();
+    ++numFired;
+
+    lock.lock();
+    runningId_     = 0;
+    runningThread_ = std::thread::id();
+    callbackDone_.notify_all();
+  }
+
+  std::function<void()> firedHandler = firedHandler_;
+  lock.unlock();
+
+  if ((numFired > 0) && firedHandler)
+  {
+    firedHandler();
+  }
+  return numFired;
+}
+
+//==============================================================================
+//----------------------------- setFiredHandler --------------------------------
+//==============================================================================
+void TimerWheel::setFiredHandler(std::function<void()> handler)
+{
+  std::lock_guard<std::mutex> lock(wheelMutex_);
+  firedHandler_ = std::move(handler);
+}
+
+//==============================================================================
+//------------------------------- start / stop ---------------------------------
+//==============================================================================
+void TimerWheel::start()
+{
+  std::lock_guard<std::mutex> lock(driveMutex_);
+  if (driveThread_.joinable())
+  {
+    return;
+  }
+  stopDrive_   = false;
+  driveThread_ = std::thread([this] {
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(tickPeriod_));
+
+    std::unique_lock<std::mutex> driveLock(driveMutex_);
+    while (!driveSignal_.wait_for(driveLock, period,
+                                  [this] { return stopDrive_; }))
+    {
+      driveLock.unlock();
+      advance();
+      driveLock.lock();
+    }
+  });
+}
+
+void TimerWheel::stop()
+{
+  std::thread driveThread;
+  {
+    std::lock_guard<std::mutex> lock(driveMutex_);
+    stopDrive_ = true;
+    driveThread.swap(driveThread_);
+  }
+  driveSignal_.notify_all();
+  if (driveThread.joinable())
+  {
+    driveThread.join();
+  }
+}
+
+//==============================================================================
+//------------------------------ getNumPending ---------------------------------
+//==============================================================================
+size_t TimerWheel::getNumPending()
+{
+  std::lock_guard<std::mutex> lock(wheelMutex_);
+  return pendingTicks_.size() + firing_.size();
+}
+
+}  // namespace pnt_integrity